@@ -92,6 +92,11 @@
 #define traceTASK_SWITCHED_OUT()      \
     extern void EndIdleMonitor(void); \
     EndIdleMonitor()
+/* run-time stats counted by DWT cycle counter (sysprof.c) */
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() \
+    extern void sysprof_init(void);              \
+    sysprof_init()
+#define portGET_RUN_TIME_COUNTER_VALUE() (*(volatile uint32_t *)0xE0001004) // DWT->CYCCNT
 /* USER CODE END Includes */
 
 /* Ensure stdint is only used by the compiler, and not the assembler. */
@@ -114,6 +119,8 @@ extern uint32_t SystemCoreClock;
 #define configUSE_16_BIT_TICKS                  0
 #define configUSE_MUTEXES                       1
 #define configQUEUE_REGISTRY_SIZE               8
+#define configUSE_TRACE_FACILITY                1
+#define configGENERATE_RUN_TIME_STATS           1
 #define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
 
 /* Co-routine definitions. */
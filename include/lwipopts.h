@@ -118,7 +118,9 @@ extern "C" {
     /*----- Default Value for LWIP_HTTPD: 0 ---*/
     #define LWIP_HTTPD 1
     /*----- Value in opt.h for LWIP_STATS: 1 -----*/
-    #define LWIP_STATS 0
+    #ifndef LWIP_STATS
+        #define LWIP_STATS 0 // -DLWIP_STATS=1 enables /api/netstats (tapif benchmark)
+    #endif
     /*----- Value in opt.h for CHECKSUM_GEN_IP: 1 -----*/
     #define CHECKSUM_GEN_IP 0
     /*----- Value in opt.h for CHECKSUM_GEN_UDP: 1 -----*/
@@ -146,8 +148,19 @@ extern "C" {
     #define LWIP_NETIF_API             1 // enable LWIP_NETIF_API==1: Support netif api (in netifapi.c)
     #define LWIP_NETIF_LINK_CALLBACK   1 //LWIP_NETIF_LINK_CALLBACK==1: Support a callback function from an interface
     #define LWIP_HTTPD_DYNAMIC_HEADERS 1
+    #define LWIP_HTTPD_SUPPORT_POST    1 // file upload (wui_upload.c)
+    #define LWIP_HTTPD_POST_MANUAL_WND 1 // upload throttled by USB write speed
     #define LWIP_NETIF_STATUS_CALLBACK 1
     #define LWIP_NETIF_HOSTNAME        1
+    #define LWIP_SUPPORT_CUSTOM_PBUF   1 // zero-copy receive (ethernetif.c)
+    #define PBUF_POOL_SIZE             6 // only for received frames copied when zero-copy buffers are held by lwIP
+
+    // persistent connections: idle connection is closed after HTTPD_MAX_RETRIES * HTTPD_POLL_INTERVAL * 500ms (8s)
+    #define LWIP_HTTPD_SUPPORT_11_KEEPALIVE             1 // keep-alive and pipelined requests
+    #define HTTPD_USE_MEM_POOL                          1 // http_state from static pool, not from heap
+    #define MEMP_NUM_PARALLEL_HTTPD_CONNS               4 // one tcp pcb (MEMP_NUM_TCP_PCB 5) left for accept
+    #define MEMP_NUM_PARALLEL_HTTPD_SSI_CONNS           1 // no .shtml in WUI resources
+    #define LWIP_HTTPD_KILL_OLD_ON_CONNECTIONS_EXCEEDED 1 // least recently used connection is closed for new one
 
 /* USER CODE END 1 */
 
@@ -1143,7 +1143,8 @@
 #if EITHER(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR)
 
     // Set the number of grid points per dimension.
-    #define GRID_MAX_POINTS_X 4
+    // Don't use more than 15 points per axis (MARLIN_MAX_MESH_POINTS).
+    #define GRID_MAX_POINTS_X 7
     #define GRID_MAX_POINTS_Y GRID_MAX_POINTS_X
 
 // Set the boundaries for probing (where the probe can reach).
@@ -1171,6 +1172,13 @@
             #define BILINEAR_SUBDIVISIONS 3
         #endif
 
+        //
+        // Bicubic interpolation with precomputed per-cell coefficients (src/marlin_stubs/abl_bicubic.cpp,
+        // called from bilinear ABL override src/marlin_stubs/abl.cpp, ABL_BILINEAR_SUBDIVISION not supported).
+        // Smooth surface through the probed points, costs 15 multiply-adds per segment.
+        //
+        #define ABL_BICUBIC
+
     #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
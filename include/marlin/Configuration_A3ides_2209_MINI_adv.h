@@ -1084,7 +1084,12 @@
 //
 #define ARC_SUPPORT // Disable this feature to save ~3226 bytes
 #if ENABLED(ARC_SUPPORT)
-    #define MM_PER_ARC_SEGMENT 1 // Length of each arc segment
+    // Segment length is adaptive (src/marlin_stubs/G2_G3.cpp): longest chord within ARC_SEGMENT_TOLERANCE,
+    // but at least feedrate * ARC_SEGMENT_MIN_TIME while the planner is not full
+    #define ARC_SEGMENT_TOLERANCE 0.005 // (mm) Maximum deviation of chord from arc
+    #define MIN_ARC_SEGMENT_MM 0.1      // (mm) Minimum length of each arc segment
+    #define MAX_ARC_SEGMENT_MM 2.0      // (mm) Maximum length of each arc segment
+    #define ARC_SEGMENT_MIN_TIME 0.002  // (s) Minimum duration of segment with empty planner
     #define N_ARC_CORRECTION 25 // Number of intertpolated segments between corrections
 //#define ARC_P_CIRCLES         // Enable the 'P' parameter to specify complete circles
 //#define CNC_WORKSPACE_PLANES  // Allow G2/G3 to operate in XY, ZX, or YZ planes
@@ -1163,17 +1168,22 @@
 
 // The number of linear motions that can be in the plan at any give time.
 // THE BLOCK_BUFFER_SIZE NEEDS TO BE A POWER OF 2 (e.g. 8, 16, 32) because shifts and ors are used to do the ring-buffering.
+// Planner block buffer is placed to CCMRAM by linker script (see STM32F407VG_FLASH.ld, section .ccmbss),
+// so the size does not cost main RAM. One block_t is ~90 bytes (LIN_ADVANCE, 4 axes), 64 blocks take ~5.6kB
+// of CCMRAM instead of ~1.4kB for 16 blocks. CCMRAM left after .ccmbss is png decoder heap (min. 40kB, linker assert).
 #if ENABLED(SDSUPPORT)
-    #define BLOCK_BUFFER_SIZE 16 // SD,LCD,Buttons take more memory, block buffer needs to be smaller
+    #define BLOCK_BUFFER_SIZE 64 // deep look-ahead for short segments (arcs, curved infill), see CCMRAM note above
 #else
-    #define BLOCK_BUFFER_SIZE 16 // maximize block buffer
+    #define BLOCK_BUFFER_SIZE 64 // maximize block buffer
 #endif
 
 // @section serial
 
 // The ASCII buffer for serial input
+// Command buffer is placed to CCMRAM by linker script (see STM32F407VG_FLASH.ld, section .ccmbss),
+// BUFSIZE * MAX_CMD_SIZE = 3kB of CCMRAM (768 bytes for previous BUFSIZE 8)
 #define MAX_CMD_SIZE 96
-#define BUFSIZE 8
+#define BUFSIZE 32
 
 // Transmission to Host Buffer Size
 // To save 386 bytes of PROGMEM (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
@@ -1219,7 +1229,8 @@
 //#define NO_TIMEOUTS 1000 // Milliseconds
 
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
-//#define ADVANCED_OK
+// "ok N P B" reports free planner/command slots - host can keep multiple lines in flight (USB CDC)
+#define ADVANCED_OK
 
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
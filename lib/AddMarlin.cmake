@@ -9,7 +9,6 @@ add_library(
   Marlin/Marlin/src/core/utility.cpp
   Marlin/Marlin/src/feature/babystep.cpp
   Marlin/Marlin/src/feature/backlash.cpp
-  Marlin/Marlin/src/feature/bedlevel/abl/abl.cpp
   Marlin/Marlin/src/feature/bedlevel/bedlevel.cpp
   Marlin/Marlin/src/feature/bedlevel/mbl/mesh_bed_leveling.cpp
   Marlin/Marlin/src/feature/bedlevel/ubl/ubl.cpp
@@ -77,7 +76,6 @@ add_library(
   Marlin/Marlin/src/gcode/lcd/M300.cpp
   Marlin/Marlin/src/gcode/lcd/M73_PE.cpp
   Marlin/Marlin/src/gcode/motion/G0_G1.cpp
-  Marlin/Marlin/src/gcode/motion/G2_G3.cpp
   Marlin/Marlin/src/gcode/motion/G4.cpp
   Marlin/Marlin/src/gcode/motion/M290.cpp
   Marlin/Marlin/src/gcode/parser.cpp
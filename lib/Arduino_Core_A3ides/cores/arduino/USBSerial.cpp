@@ -6,10 +6,22 @@
 #include "usbd_def.h"
 
 #define USBSERIAL_OBUF_SIZE 256
-#define USBSERIAL_IBUF_SIZE 256
+#define USBSERIAL_IBUF_SIZE 512 // packed data expands up to 2x
 #define USBSERIAL_RETRY     100
 #define USBSERIAL_MAX_FAIL  10
 
+// MeatPack compatible packed stream (negotiated by host with 0xff 0xff <cmd> sequence)
+// packed byte holds two 4-bit codes (low nibble first), code 0xf means next byte is literal char
+#define MEATPACK_SIGNAL           0xff
+#define MEATPACK_CMD_ENABLE       0xfb // enable packing
+#define MEATPACK_CMD_DISABLE      0xfa // disable packing
+#define MEATPACK_CMD_RESET        0xf9 // reset all (packing and no-spaces off)
+#define MEATPACK_CMD_QUERY        0xf8 // report state
+#define MEATPACK_CMD_NOSPACES_ON  0xf7 // code 0xb means 'E' instead of ' '
+#define MEATPACK_CMD_NOSPACES_OFF 0xf6 // code 0xb means ' '
+#define MEATPACK_FLG_ACTIVE       0x01
+#define MEATPACK_FLG_NOSPACES     0x02
+
 extern "C" {
 
 extern USBD_HandleTypeDef hUsbDeviceFS;
@@ -26,6 +38,17 @@ uint32_t ibufc = 0;                 //number of characters in input buffer
 uint32_t ibufr = 0;                 //input buffer read index
 uint32_t ibufw = 0;                 //input buffer write index
 
+uint8_t meatpack_flg = 0;                     //MEATPACK_FLG_xxx
+uint8_t meatpack_sig_cnt = 0;                 //number of received signal bytes
+uint8_t meatpack_cmd_next = 0;                //next byte is command
+uint8_t meatpack_lit_cnt = 0;                 //number of expected literal chars
+uint8_t meatpack_pending = 0;                 //packed char waiting for preceding literal char
+volatile uint8_t meatpack_report_pending = 0; //state report requested
+
+static const char meatpack_table[15] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '.', ' ', '\n', 'G', 'X'
+};
+
 void usb_cdc_tx_buffer(void) {
     uint8_t ret;
     int retry = USBSERIAL_RETRY;
@@ -50,25 +73,126 @@ void usb_cdc_tx_buffer(void) {
 }
 }
 
+// free space is checked per char, MeatPack can be enabled in the middle of a packet
+static inline void usb_cdc_rx_char(uint8_t ch) {
+    if (ibufc >= USBSERIAL_IBUF_SIZE)
+        return; //input buffer overflow
+    ibuff[ibufw++] = ch;
+    if (ibufw >= USBSERIAL_IBUF_SIZE)
+        ibufw = 0;
+    ibufc++; //is atomic
+}
+
+static inline uint8_t meatpack_char(uint8_t code) {
+    if ((code == 0x0b) && (meatpack_flg & MEATPACK_FLG_NOSPACES))
+        return 'E';
+    return meatpack_table[code];
+}
+
+static void meatpack_command(uint8_t cmd) {
+    switch (cmd) {
+    case MEATPACK_CMD_ENABLE:
+        meatpack_flg |= MEATPACK_FLG_ACTIVE;
+        break;
+    case MEATPACK_CMD_DISABLE:
+        meatpack_flg &= ~MEATPACK_FLG_ACTIVE;
+        break;
+    case MEATPACK_CMD_RESET:
+        meatpack_flg = 0;
+        break;
+    case MEATPACK_CMD_NOSPACES_ON:
+        meatpack_flg |= MEATPACK_FLG_NOSPACES;
+        break;
+    case MEATPACK_CMD_NOSPACES_OFF:
+        meatpack_flg &= ~MEATPACK_FLG_NOSPACES;
+        break;
+    }
+    meatpack_lit_cnt = 0;
+    meatpack_pending = 0;
+    meatpack_report_pending = 1; // report is sent from reading thread
+}
+
+static void meatpack_unpack(uint8_t ch) {
+    if (!(meatpack_flg & MEATPACK_FLG_ACTIVE))
+        usb_cdc_rx_char(ch);
+    else if (meatpack_lit_cnt) {
+        usb_cdc_rx_char(ch);
+        if (meatpack_pending) {
+            usb_cdc_rx_char(meatpack_pending);
+            meatpack_pending = 0;
+        }
+        meatpack_lit_cnt--;
+    } else {
+        uint8_t lo = ch & 0x0f;
+        uint8_t hi = ch >> 4;
+        if (lo == 0x0f) {
+            meatpack_lit_cnt++;
+            if (hi == 0x0f)
+                meatpack_lit_cnt++;
+            else
+                meatpack_pending = meatpack_char(hi);
+        } else {
+            usb_cdc_rx_char(meatpack_char(lo));
+            if (lo != 0x0c) { // second code after newline is padding
+                if (hi == 0x0f)
+                    meatpack_lit_cnt++;
+                else
+                    usb_cdc_rx_char(meatpack_char(hi));
+            }
+        }
+    }
+}
+
+// called from usb interrupt
 void USBSerial_put_rx_data(uint8_t *buffer, uint32_t length) {
-    if ((USBSERIAL_IBUF_SIZE - ibufc) >= length) {
+    uint32_t need = (meatpack_flg & MEATPACK_FLG_ACTIVE) ? (2 * length) : length; // estimate, packet can switch mode
+    if ((USBSERIAL_IBUF_SIZE - ibufc) >= need) {
         while (length--) {
-            ibuff[ibufw++] = *buffer;
-            if (ibufw >= USBSERIAL_IBUF_SIZE)
-                ibufw = 0;
-            buffer++;
-            ibufc++; //is atomic
+            uint8_t ch = *(buffer++);
+            if (ch == MEATPACK_SIGNAL) {
+                if (meatpack_sig_cnt) { // 0xff 0xff - next byte is command
+                    meatpack_cmd_next = 1;
+                    meatpack_sig_cnt = 0;
+                } else
+                    meatpack_sig_cnt++;
+            } else if (meatpack_cmd_next) {
+                meatpack_cmd_next = 0;
+                meatpack_command(ch);
+            } else {
+                if (meatpack_sig_cnt) { // single 0xff is data
+                    meatpack_sig_cnt = 0;
+                    meatpack_unpack(MEATPACK_SIGNAL);
+                }
+                meatpack_unpack(ch);
+            }
         }
     } else {
         //input buffer overflow
     }
 }
 
+// send pending state report ("[MP] PV01 ON ESP")
+static void meatpack_report(USBSerial *serial) {
+    uint8_t flg = meatpack_flg;
+    meatpack_report_pending = 0;
+    serial->write((const uint8_t *)"[MP] PV01 ", 10);
+    if (flg & MEATPACK_FLG_ACTIVE)
+        serial->write((const uint8_t *)"ON ", 3);
+    else
+        serial->write((const uint8_t *)"OFF ", 4);
+    if (flg & MEATPACK_FLG_NOSPACES)
+        serial->write((const uint8_t *)"NSP\n", 4);
+    else
+        serial->write((const uint8_t *)"ESP\n", 4);
+}
+
 void USBSerial::begin(uint32_t baud_count) {
     // uart config is ignored in USB-CDC
 }
 
 int USBSerial::available(void) {
+    if (meatpack_report_pending)
+        meatpack_report(this);
     return ibufc;
 }
 
@@ -173,6 +173,7 @@ PRIVILEGED_FUNCTION void vPortFree( void *pv );
 PRIVILEGED_FUNCTION void vPortInitialiseBlocks( void );
 PRIVILEGED_FUNCTION size_t xPortGetFreeHeapSize( void );
 PRIVILEGED_FUNCTION size_t xPortGetMinimumEverFreeHeapSize( void );
+PRIVILEGED_FUNCTION size_t xPortGetLargestFreeBlockSize( void );
 
 /*
  * Setup the hardware ready for the scheduler to take control.  This generally
@@ -1,8 +1,13 @@
 #include "../Marlin/src/sd/cardreader.h"
+#include "../Marlin/src/Marlin.h"
 #include "bsod.h"
+#include "config.h"
 #include "dbg.h"
 #include "ff.h"
 #include "ffconf.h"
+#include "gcode_file.h"
+#include "gcode_crc.h"
+#include "marlin_server.h"
 #include <stdbool.h>
 #include <string.h>
 
@@ -26,6 +31,50 @@ extern "C" void media_set_inserted(bool inserted) {
 //need to be able to force clear them
 static SdFile newDir1, newDir2;
 
+#ifdef GCODE_CRC
+
+static gcode_crc_t print_crc;                       // print file integrity check
+static const SdBaseFile *print_crc_file = nullptr; // file verified by print_crc (bytes read, seek, close)
+
+static void print_crc_idle(void) {
+    idle();
+}
+
+// start verification of print file (M23 from print preview, serial or WUI), file not
+// verified yet is read through before printing, mismatch is reported before printing,
+// bytes read by the printing are checked only when the pre-print pass did not finish
+static void print_crc_open(const SdBaseFile *file, const char *path) {
+    print_crc_file = nullptr;
+    if (gcode_crc_open(&print_crc, path) == GCODE_CRC_PENDING)
+        gcode_crc_verify(&print_crc, print_crc_idle);
+    switch (print_crc.state) {
+    case GCODE_CRC_PENDING:
+        print_crc_file = file;
+        break;
+    case GCODE_CRC_OK:
+        SERIAL_ECHO_MSG("G-code CRC ok");
+        break;
+    case GCODE_CRC_MISMATCH:
+        marlin_server_sd_corrupt();
+        break;
+    }
+}
+
+// file read to the end, closed or aborted
+static void print_crc_close(void) {
+    print_crc_file = nullptr;
+    switch (gcode_crc_close(&print_crc)) {
+    case GCODE_CRC_OK:
+        SERIAL_ECHO_MSG("G-code CRC ok");
+        break;
+    case GCODE_CRC_MISMATCH:
+        marlin_server_sd_corrupt();
+        break;
+    }
+}
+
+#endif //GCODE_CRC
+
 //*****************************************************************************
 //Roberts hack, needed to move it up so CardReader can see it
 class Slot {
@@ -322,6 +371,11 @@ void CardReader::openFile(char *const path, const bool read, bool subcall) {
         if (file.open(curDir, fname, O_READ)) {
             filesize = file.fileSize();
             sdpos = 0;
+            marlin_server_sd_open(subcall ? 0 : path);
+#ifdef GCODE_CRC
+            if (!subcall) // subroutine files are not verified
+                print_crc_open(&file, path);
+#endif //GCODE_CRC
             SERIAL_ECHOLNPAIR(MSG_SD_FILE_OPENED, fname, MSG_SD_SIZE, filesize);
             SERIAL_ECHOLNPGM(MSG_SD_FILE_SELECTED);
 
@@ -512,6 +566,11 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
     if (f_lseek(&_slot_of(this)->file, szf) != FR_OK)
         return false;
     curPosition_ = pos;
+    marlin_server_sd_seek(pos);
+#ifdef GCODE_CRC
+    if (this == print_crc_file)
+        gcode_crc_seek(&print_crc, pos);
+#endif //GCODE_CRC
     return true;
 }
 
@@ -529,6 +588,12 @@ int16_t SdBaseFile::read() {
     if (f_read(&_slot_of(this)->file, &b, 1, &c) != FR_OK)
         return -1;
     curPosition_++;
+#ifdef GCODE_CRC
+    if ((this == print_crc_file) && c)
+        gcode_crc_put(&print_crc, b);
+#endif //GCODE_CRC
+    if ((b == '\n') || (b == '\r'))
+        marlin_server_sd_eol(curPosition_);
     return b;
 }
 
@@ -540,7 +605,12 @@ bool SdBaseFile::close() {
         return false;
     switch (type_) {
     case FAT_FILE_TYPE_NORMAL:
+#ifdef GCODE_CRC
+        if (this == print_crc_file)
+            print_crc_close();
+#endif //GCODE_CRC
         slot = _slot_of(this);
+        f_gcode_fast_seek_detach(&slot->file);
         success = f_close(&slot->file) == FR_OK;
         Slot::free(slot);
         _slot_of(this) = nullptr;
@@ -613,6 +683,9 @@ bool SdBaseFile::open(SdBaseFile *dir, const char *path, uint8_t oflag) {
             type_ = FAT_FILE_TYPE_NORMAL;
             curPosition_ = 0;
             fileSize_ = f_size(&slot->file);
+            // constant time seekSet (resume, power-loss recovery) in large fragmented files
+            if (!(mode & FA_WRITE))
+                f_gcode_fast_seek_attach(&slot->file);
             return true;
         } else {
             Slot::free(slot);
@@ -6,19 +6,24 @@
     #define ADC_SIM_MSK 0
 #endif
 
+//cycles [ms] to skip after scan start, buffer must be completely filled
+//one conversion takes (480 + 12) ADCCLK (21MHz), whole buffer takes ~1.9ms
+#define ADC_START_DELAY 4
+
 extern ADC_HandleTypeDef hadc1;
 
 extern void ADC_READY(uint8_t index);
-extern uint8_t ADC_SEQ2IDX(uint8_t seq);
 
 //Main error handler
 extern void Error_Handler(void);
 
-uint32_t adc_val[ADC_CHAN_CNT]; //sampled values
-uint8_t adc_cnt[ADC_CHAN_CNT];  //number of samples
+uint32_t adc_val[ADC_CHAN_CNT]; //sampled values (sum of ADC_OVRSAMPL samples)
+uint32_t adc_tim[ADC_CHAN_CNT]; //tick of last update [ms]
 uint8_t adc_chn[ADC_CHAN_CNT];  //physical channels
-uint8_t adc_sta = 0xff;         //current state, 0xff means "not initialized"
-int8_t adc_idx = 0;             //current value index
+uint8_t adc_sta = 0xff;         //current state, 0xff means "not initialized", nonzero means "filling buffer"
+
+//circular dma buffer, ADC_DMA_SCANS complete scan sequences of all channels
+uint16_t adc_dma_buff[ADC_DMA_SCANS][ADC_CHAN_CNT];
 
 uint32_t adc_sim_val[ADC_CHAN_CNT]; //simulated values
 uint32_t adc_sim_msk = ADC_SIM_MSK; //mask simulated channels
@@ -38,59 +43,70 @@ uint8_t adc_chan(uint8_t idx) {
     return chan;
 }
 
-//configure multiplexer
-void adc_set_mux(uint8_t chn) {
+//configure sequencer rank
+void adc_set_rank(uint8_t rank, uint8_t chn) {
     ADC_ChannelConfTypeDef sConfig = { 0 };
     sConfig.Channel = chn;
-    sConfig.Rank = 1;
-    sConfig.SamplingTime = ADC_SAMPLETIME_3CYCLES;
+    sConfig.Rank = rank;
+    sConfig.SamplingTime = ADC_SAMPLETIME_480CYCLES;
     if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK) {
         Error_Handler();
     }
 }
 
+//(re)start continuous scan, dma runs in circular mode, no interrupts used
+void adc_start(void) {
+    HAL_ADC_Stop_DMA(&hadc1);
+    __HAL_ADC_CLEAR_FLAG(&hadc1, ADC_FLAG_OVR);
+    if (HAL_ADC_Start_DMA(&hadc1, (uint32_t *)adc_dma_buff, ADC_DMA_SCANS * ADC_CHAN_CNT) != HAL_OK) {
+        Error_Handler();
+    }
+}
+
 //initialization
 void adc_init(void) {
     for (int i = 0; i < ADC_CHAN_CNT; i++) {
         adc_val[i] = 0;
-        adc_cnt[i] = 0;
+        adc_tim[i] = 0;
         adc_chn[i] = adc_chan(i);
+        adc_set_rank(i + 1, adc_chn[i]);
     }
-    adc_idx = 0;
-    adc_sta = 0x00;
+    for (int j = 0; j < ADC_DMA_SCANS; j++)
+        for (int i = 0; i < ADC_CHAN_CNT; i++)
+            adc_dma_buff[j][i] = 0;
     adc_init_sim_vals();
+    adc_start();
+    adc_sta = ADC_START_DELAY;
 }
 
-//sampling cycle (called from interrupt)
+//decimation cycle (called from interrupt), moving average over whole dma buffer
 void adc_cycle(void) {
-    uint8_t seq;
     uint32_t val;
+    uint32_t tick;
     if (adc_sta == 0xff)
-        return; //skip sampling if not initialized
-    if (adc_sta & 0x80) {
-        if (__HAL_ADC_GET_FLAG(&hadc1, ADC_FLAG_EOC)) {
-            if ((1 << adc_idx) & adc_sim_msk)
-                val = adc_sim_val[adc_idx];
-            else
-                val = HAL_ADC_GetValue(&hadc1);
-            adc_val[adc_idx] += val;
-            if (++adc_cnt[adc_idx] >= ADC_OVRSAMPL) {
-                ADC_READY(adc_idx);
-                adc_val[adc_idx] = 0;
-                adc_cnt[adc_idx] = 0;
-            }
-            seq = (adc_sta & 0x1f) + 1;
-            if (seq >= ADC_SEQ_LEN)
-                seq = 0;
-            adc_idx = ADC_SEQ2IDX(seq);
-            adc_set_mux(adc_chn[adc_idx]);
-            adc_sta = seq;
-        } else {
-            Error_Handler();
+        return; //skip if not initialized
+    if (__HAL_ADC_GET_FLAG(&hadc1, ADC_FLAG_OVR)) {
+        adc_start(); //overrun stops dma requests - restart scan
+        adc_sta = ADC_START_DELAY;
+        return;
+    }
+    if (adc_sta) {
+        adc_sta--; //buffer is not filled yet
+        return;
+    }
+    tick = HAL_GetTick();
+    for (int i = 0; i < ADC_CHAN_CNT; i++) {
+        if ((1 << i) & adc_sim_msk)
+            val = adc_sim_val[i] * ADC_OVRSAMPL;
+        else {
+            val = 0;
+            for (int j = 0; j < ADC_DMA_SCANS; j++)
+                val += adc_dma_buff[j][i];
+            val = (val * ADC_OVRSAMPL) / ADC_DMA_SCANS;
         }
-    } else {
-        HAL_ADC_Start(&hadc1);
-        adc_sta |= 0x80;
+        adc_val[i] = val;
+        adc_tim[i] = tick;
+        ADC_READY(i);
     }
 }
 
@@ -11,6 +11,8 @@ extern "C" {
 
 extern uint32_t adc_val[ADC_CHAN_CNT];
 
+extern uint32_t adc_tim[ADC_CHAN_CNT];
+
 extern uint32_t adc_sim_val[ADC_CHAN_CNT];
 
 extern uint32_t adc_sim_msk;
@@ -0,0 +1,26 @@
+// ccmram.h - core coupled memory (64kb at 0x10000000, not accessible by DMA)
+#ifndef _CCMRAM_H
+#define _CCMRAM_H
+
+#include <inttypes.h>
+
+// place zero initialized variable to ccmram (section zeroed by startup code)
+#define CCMRAM_BSS __attribute__((section(".ccmbss")))
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// linker symbols
+extern uint8_t _sccmram;  // initialized data start (not copied by startup code)
+extern uint8_t _eccmram;  // initialized data end
+extern uint8_t _sccmbss;  // zero initialized data start (planner blocks, gcode queue)
+extern uint8_t _eccmbss;  // zero initialized data end
+extern uint8_t _sccmheap; // heap start (png decoder)
+extern uint8_t _eccmheap; // heap end (dump register area follows)
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //_CCMRAM_H
@@ -20,22 +20,21 @@
 //--------------------------------------
 //ADC configuration
 //channels:
-// log pin  phy pri  function
-// 0   PA3  3   1    HW_IDENTIFY
-// 1   PA4  4   6    THERM1 (bed)
-// 2   PA5  5   1    THERM2
-// 3   PA6  6   1    THERM_PINDA
-// 4   PC0  10  9    THERM0 (nozzle)
+// log pin  phy  function
+// 0   PA3  3    HW_IDENTIFY
+// 1   PA4  4    THERM1 (bed)
+// 2   PA5  5    THERM2
+// 3   PA6  6    THERM_PINDA
+// 4   PC0  10   THERM0 (nozzle)
 //--------------------------------------
 //  bit fedc ba98 7654 3210
 // mask 0000 0100 0111 1000 == 0x0478
-#define ADC_CHAN_MSK 0x0478      //used physical AD channels bit mask (3,4,5,6,10)
-#define ADC_CHAN_CNT 5           //number of used channels
-#define ADC_OVRSAMPL 4           //oversampling multiplier (common for all channels)
-#define ADC_SEQ_LEN  18          //sampling sequence length
-#define ADC_SEQ2IDX  adc_seq2idx //callback function (convert seq to channel index)
-#define ADC_READY    adc_ready   //callback function (value for any channel is ready)
-#define ADC_VREF     5010        //reference voltage [mV]
+#define ADC_CHAN_MSK  0x0478    //used physical AD channels bit mask (3,4,5,6,10)
+#define ADC_CHAN_CNT  5         //number of used channels
+#define ADC_OVRSAMPL  4         //oversampling multiplier (common for all channels)
+#define ADC_DMA_SCANS 16        //scan sequences in dma buffer (moving average length)
+#define ADC_READY     adc_ready //callback function (value for any channel is ready)
+#define ADC_VREF      5010      //reference voltage [mV]
 //simulated values
 #define ADC_SIM_VAL0 512 * 4 //HW_IDENTIFY
 #define ADC_SIM_VAL1 966 * 4 //THERM1 (bed)     means 30C
@@ -74,9 +73,59 @@
 #endif                                   //SIM_HEATER
 
 #ifdef SIM_MOTION
+//#define SIM_MOTION_TRACE   // step/dir event recorder (putslave !smtr 1 / !smtr 0 [file])
+    #define SIM_MOTION_TRACE_SIZE  8192 // trace ring size [bytes], power of 2
+    #define SIM_MOTION_TRACE_SHIFT 4    // trace tick = cpu cycle counter >> shift (~95ns at 168MHz)
 //#define SIM_MOTION_TRACE_X
 //#define SIM_MOTION_TRACE_Y
 //#define SIM_MOTION_TRACE_Z
 #endif //SIM_MOTION
 
+//--------------------------------------
+//PRINT_JOURNAL configuration
+#define PRINT_JOURNAL // power-loss recovery journal in xflash (print_journal.c)
+#ifdef PRINT_JOURNAL
+    #define PRINT_JOURNAL_PERIOD     10000 // max. time between progress records [ms]
+    #define PRINT_JOURNAL_PERIOD_MIN 2000  // min. time between records (layer change, z-hop) [ms], limits xflash wear
+#endif //PRINT_JOURNAL
+
+//--------------------------------------
+//PRINT_ESTIMATE configuration
+#define PRINT_ESTIMATE // gcode pre-scan remaining time estimator (print_estimate.cpp)
+#ifdef PRINT_ESTIMATE
+    #define PRINT_ESTIMATE_INDEX     256 // number of file offset -> time index intervals
+    #define PRINT_ESTIMATE_LOOKAHEAD 16  // moves in estimator lookahead window
+#endif //PRINT_ESTIMATE
+
+//--------------------------------------
+//USBH_CACHE configuration
+#define USBH_CACHE // sector cache between FatFS and USB MSC (usbh_diskio.c, sector_cache.c)
+#ifdef USBH_CACHE
+    #define USBH_CACHE_LINES        4 // cache lines (LRU), line data in ccmram
+    #define USBH_CACHE_LINE_SECTORS 4 // sectors per line = read-ahead per USB transaction (power of 2, max. 8)
+#endif //USBH_CACHE
+
+//--------------------------------------
+//GCODE_FAST_SEEK configuration
+#define GCODE_FAST_SEEK // FatFS fast-seek link maps for open gcode files (gcode_fast_seek.cpp)
+#ifdef GCODE_FAST_SEEK
+    #define GCODE_FAST_SEEK_MAPS     3  // map pool size (print file, subcall/preview)
+    #define GCODE_FAST_SEEK_MAP_SIZE 64 // DWORDs per map, up to (size - 2) / 2 fragments per file
+#endif //GCODE_FAST_SEEK
+
+//--------------------------------------
+//FAN_TACHO configuration (fan_tacho.c)
+#define FAN_TACHO_PULSES      2     // tacho pulses per revolution
+#define FAN_TACHO_PERIODS     4     // averaged periods (power of 2)
+#define FAN_TACHO_RPM_MAX     15000 // faster edges are glitches [rpm]
+#define FAN_TACHO_REJECT_MAX  4     // consecutive rejected edges restart measurement
+#define FAN_TACHO_TIMEOUT     250   // no edge within timeout means stopped [ms] (min. 120rpm)
+#define FAN_TACHO_SPINUP      3000  // time to spin up before blocked fan detection [ms]
+#define FAN_TACHO_BLOCKED_PWM 50    // min. pwm for blocked fan detection [%]
+#define FAN_TACHO_RPM_HYST    50    // min. change of published rpm (marlin vars) [rpm]
+
+//--------------------------------------
+//GCODE_CRC configuration
+#define GCODE_CRC // crc32 integrity check of print files against sidecar or embedded checksum (gcode_crc.c)
+
 #endif //_CONFIG_A3IDES2209_02_H
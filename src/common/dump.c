@@ -1,73 +1,275 @@
 // dump.c
 
 #include "dump.h"
+#include "ccmram.h"
 #include "ff.h"
 #include "w25x.h"
 
-#define DUMP_OFFSET 0x00000000
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
 
 #define DUMP_PAGE_SIZE 0x100
 
-#define DUMP_BUFF_SIZE 0x100
+#define DUMP_SECTOR_SIZE 0x200
 
-#define DUMP_XFLASH_SIZE (DUMP_RAM_SIZE + DUMP_CCRAM_SIZE)
+#define DUMP_BUFF_SIZE 0x1000 // usb export buffer, multiple of sector size
+
+#define DUMP_BLOCK_SIZE 0x10000 // xflash block64 erase size
+
+#define DUMP_XFLASH_BUSY_TIMEOUT 500 // [ms] longer than sector erase (journal)
 
 #define _STR(arg)  #arg
 #define __STR(arg) _STR(arg)
 
+// linker symbols
+extern uint8_t _ebss;
+extern uint8_t end;
+
+extern caddr_t _sbrk(int incr);
+
+static int8_t dump_slot = -1; // pre-erased slot for next dump, -1 = not prepared
+static uint32_t dump_seq = 0; // sequence number for next dump
+static uint8_t dump_erase_pending = 0;
+
+// variables used during dump (static - the stack can be damaged)
+static dump_hdr_t dump_hdr;
+static uint8_t dump_page[DUMP_PAGE_SIZE];
+static uint32_t dump_pos; // write position in slot
+
 static inline void dump_regs_SCB(void) {
     //copy entire SCB to CCRAM
     memcpy((uint8_t *)DUMP_REGS_SCB_ADDR, SCB, DUMP_REGS_SCB_SIZE);
 }
 
-void dump_to_xflash(void) {
+static inline uint32_t dump_slot_addr(int slot) {
+    return DUMP_XFLASH_ADDR + slot * DUMP_XFLASH_SLOT_SIZE;
+}
+
+static void dump_xflash_program(uint32_t addr, uint8_t *data, uint16_t cnt) {
+    w25x_wait_busy();
+    w25x_enable_wr();
+    w25x_page_program(addr, data, cnt);
+}
+
+static void dump_xflash_erase_slot(int slot) {
     uint32_t addr;
-    dump_regs_SCB();
-    if (w25x_init()) {
-        for (addr = 0; addr < DUMP_XFLASH_SIZE; addr += 0x10000) {
-            w25x_wait_busy();
-            w25x_enable_wr();
-            w25x_block64_erase(DUMP_OFFSET + addr);
+    for (addr = 0; addr < DUMP_XFLASH_SLOT_SIZE; addr += DUMP_BLOCK_SIZE) {
+        w25x_wait_busy();
+        w25x_enable_wr();
+        w25x_block64_erase(dump_slot_addr(slot) + addr);
+    }
+    dump_erase_pending = 1;
+}
+
+// chip does not respond to id read while erasing, wait only for erase we started (busy never clears without chip)
+static int8_t dump_xflash_init(void) {
+    if (dump_erase_pending) {
+        w25x_wait_busy();
+        dump_erase_pending = 0;
+    }
+    return w25x_init();
+}
+
+void dump_init(void) {
+    int slot;
+    int slot_free = -1;
+    int slot_old = -1;
+    uint32_t seq_min = 0xffffffff;
+    uint32_t seq_max = 0;
+    uint32_t magic_seq[2];
+    if (!dump_xflash_init())
+        return;
+    for (slot = 0; slot < DUMP_XFLASH_SLOTS; slot++) {
+        w25x_rd_data(dump_slot_addr(slot), (uint8_t *)magic_seq, sizeof(magic_seq));
+        if (magic_seq[0] == 0xffffffff) {
+            if (slot_free < 0)
+                slot_free = slot;
+            continue;
         }
-        for (addr = 0; addr < DUMP_RAM_SIZE; addr += DUMP_PAGE_SIZE) {
-            w25x_wait_busy();
-            w25x_enable_wr();
-            w25x_page_program(DUMP_OFFSET + addr, (uint8_t *)(DUMP_RAM_ADDR + addr), DUMP_PAGE_SIZE);
+        if (magic_seq[0] != DUMP_MAGIC)
+            magic_seq[1] = 0; // unknown content (e.g. old dump format), treat as oldest
+        else if (magic_seq[1] > seq_max)
+            seq_max = magic_seq[1];
+        if ((slot_old < 0) || (magic_seq[1] < seq_min)) {
+            seq_min = magic_seq[1];
+            slot_old = slot;
         }
-        for (addr = 0; addr < DUMP_CCRAM_SIZE; addr += DUMP_PAGE_SIZE) {
-            w25x_wait_busy();
-            w25x_enable_wr();
-            w25x_page_program(DUMP_OFFSET + DUMP_RAM_SIZE + addr, (uint8_t *)(DUMP_CCRAM_ADDR + addr), DUMP_PAGE_SIZE);
+    }
+    if (slot_free < 0) {
+        // all slots used - overwrite the oldest dump, erase is not waited for and runs in background
+        slot_free = slot_old;
+        dump_xflash_erase_slot(slot_free);
+    }
+    dump_slot = slot_free;
+    dump_seq = seq_max + 1;
+}
+
+static void dump_put(uint8_t b) {
+    if (dump_pos >= DUMP_XFLASH_SLOT_SIZE) {
+        dump_hdr.flags |= DUMP_FLAG_TRUNCATED;
+        return;
+    }
+    dump_page[dump_pos % DUMP_PAGE_SIZE] = b;
+    if ((++dump_pos % DUMP_PAGE_SIZE) == 0)
+        dump_xflash_program(dump_slot_addr(dump_slot) + dump_pos - DUMP_PAGE_SIZE, dump_page, DUMP_PAGE_SIZE);
+}
+
+static void dump_flush(void) {
+    uint32_t cnt = dump_pos % DUMP_PAGE_SIZE;
+    if (cnt)
+        dump_xflash_program(dump_slot_addr(dump_slot) + dump_pos - cnt, dump_page, cnt);
+}
+
+// rle compression of one memory area, unused stacks (0xa5 fill) and untouched ram collapse to a few bytes
+static void dump_rle(const uint8_t *p, uint32_t size) {
+    uint32_t i = 0;
+    uint32_t run;
+    uint32_t lit;
+    while (i < size) {
+        run = 1;
+        while ((i + run < size) && (run < DUMP_RLE_RUN_MAX) && (p[i + run] == p[i]))
+            run++;
+        if (run >= DUMP_RLE_RUN_MIN) {
+            dump_put(0x80 | (run - DUMP_RLE_RUN_MIN));
+            dump_put(p[i]);
+            i += run;
+        } else {
+            lit = 0;
+            while ((i + lit < size) && (lit < DUMP_RLE_LIT_MAX)) {
+                if ((i + lit + 2 < size) && (p[i + lit] == p[i + lit + 1]) && (p[i + lit] == p[i + lit + 2]))
+                    break;
+                lit++;
+            }
+            dump_put(lit - 1);
+            while (lit--)
+                dump_put(p[i++]);
         }
+    }
+}
+
+static void dump_section(uint32_t addr, uint32_t size) {
+    dump_sect_t *psect;
+    if ((size == 0) || (dump_hdr.count >= DUMP_SECT_MAX))
+        return;
+    psect = dump_hdr.sect + dump_hdr.count++;
+    psect->addr = addr;
+    psect->size = size;
+    psect->offset = dump_pos;
+    dump_rle((const uint8_t *)addr, size);
+    psect->packed = dump_pos - psect->offset;
+    //section data and its table entry go to xflash now, so dump interrupted by another fault keeps finished sections
+    //(header is programmed last, pages are programmed again with the same data - no erase needed)
+    dump_flush();
+    dump_xflash_program(dump_slot_addr(dump_slot) + offsetof(dump_hdr_t, sect) + (psect - dump_hdr.sect) * sizeof(dump_sect_t), (uint8_t *)psect, sizeof(dump_sect_t));
+}
+
+void dump_to_xflash(void) {
+    uint32_t msp;
+    dump_regs_SCB();
+    if (dump_xflash_init()) {
+        if (dump_slot < 0)
+            dump_init(); // dump_init not called yet or slot already used
+        memset(&dump_hdr, 0xff, sizeof(dump_hdr));
+        dump_hdr.magic = DUMP_MAGIC;
+        dump_hdr.seq = dump_seq;
+        dump_xflash_program(dump_slot_addr(dump_slot), (uint8_t *)&dump_hdr, 8);
+        dump_hdr.version = DUMP_VERSION;
+        dump_hdr.type = DUMP_TYPE_HARDFAULT;
+        dump_hdr.flags = DUMP_FLAG_RLE;
+        dump_hdr.tick = HAL_GetTick();
+        dump_hdr.count = 0;
+        dump_pos = DUMP_PAGE_SIZE;
+        msp = __get_MSP() & ~3;
+        //registers, globals (including FreeRTOS heap with task stacks), used part of heap, main stack, used ccram (planner, gcode queue)
+        dump_section(DUMP_REGS_ADDR, DUMP_REGS_SIZE);
+        dump_section(DUMP_RAM_ADDR, (uint32_t)&_ebss - DUMP_RAM_ADDR);
+        dump_section((uint32_t)&end, (uint32_t)_sbrk(0) - (uint32_t)&end);
+        dump_section(msp, DUMP_RAM_ADDR + DUMP_RAM_SIZE - msp);
+        dump_section((uint32_t)&_sccmram, (uint32_t)&_eccmbss - (uint32_t)&_sccmram);
+        dump_flush();
+        dump_hdr.size = dump_pos;
+        dump_xflash_program(dump_slot_addr(dump_slot) + 8, (uint8_t *)&dump_hdr + 8, sizeof(dump_hdr) - 8);
         w25x_wait_busy();
         w25x_disable_wr();
+        dump_slot = -1;
     }
 }
 
+static int dump_find_newest(dump_hdr_t *phdr) {
+    int slot;
+    int slot_newest = -1;
+    uint32_t seq_max = 0;
+    for (slot = 0; slot < DUMP_XFLASH_SLOTS; slot++) {
+        w25x_rd_data(dump_slot_addr(slot), (uint8_t *)phdr, sizeof(dump_hdr_t));
+        if ((phdr->magic == DUMP_MAGIC) && ((slot_newest < 0) || (phdr->seq > seq_max))) {
+            seq_max = phdr->seq;
+            slot_newest = slot;
+        }
+    }
+    if (slot_newest >= 0)
+        w25x_rd_data(dump_slot_addr(slot_newest), (uint8_t *)phdr, sizeof(dump_hdr_t));
+    return slot_newest;
+}
+
+// wait for program/erase started by other thread, limited (status reads busy without chip)
+static void dump_xflash_wait_idle(void) {
+    const uint32_t tick = HAL_GetTick();
+    while ((w25x_rd_status_reg() & W25X_STATUS_BUSY) && ((HAL_GetTick() - tick) < DUMP_XFLASH_BUSY_TIMEOUT))
+        ;
+}
+
+static int dump_write(FIL *pfil, const uint8_t *data, UINT size) {
+    UINT bw;
+    return (f_write(pfil, data, size, &bw) == FR_OK) && (bw == size);
+}
+
 int dump_save_to_usb(const char *fn) {
     FIL fil;
+    dump_hdr_t hdr;
     uint32_t addr;
-    uint8_t buff[DUMP_BUFF_SIZE];
-    UINT bw;
-    if (w25x_init()) {
-        if (f_open(&fil, fn, FA_WRITE | FA_CREATE_ALWAYS) == FR_OK) {
-            //save dumped RAM and CCRAM from xflash
-            for (addr = 0; addr < DUMP_XFLASH_SIZE; addr += DUMP_BUFF_SIZE) {
-                memset(buff, 0, DUMP_BUFF_SIZE);
-                w25x_rd_data(addr, buff, DUMP_BUFF_SIZE);
-                f_write(&fil, buff, DUMP_BUFF_SIZE, &bw);
+    uint32_t size;
+    uint32_t cnt;
+    uint8_t *buff;
+    int slot;
+    int ret = 1;
+    //print journal writes from marlin thread - wait for its pending program/erase, keep it out until done
+    w25x_lock();
+    dump_xflash_wait_idle();
+    if (!dump_xflash_init() || ((slot = dump_find_newest(&hdr)) < 0)) {
+        w25x_unlock();
+        return 0;
+    }
+    //incomplete dump (fault during dump) - save whole slot
+    size = (hdr.version == DUMP_VERSION) ? hdr.size : DUMP_XFLASH_SLOT_SIZE;
+    if ((buff = (uint8_t *)malloc(DUMP_BUFF_SIZE)) == 0) {
+        w25x_unlock();
+        return 0;
+    }
+    if (f_open(&fil, fn, FA_WRITE | FA_CREATE_ALWAYS) == FR_OK) {
+        //save packed dump from xflash, padded to sector size
+        for (addr = 0; ret && (addr < size); addr += DUMP_BUFF_SIZE) {
+            cnt = ((size - addr) < DUMP_BUFF_SIZE) ? (size - addr) : DUMP_BUFF_SIZE;
+            w25x_rd_data(dump_slot_addr(slot) + addr, buff, cnt);
+            if (cnt % DUMP_SECTOR_SIZE) {
+                memset(buff + cnt, 0xff, DUMP_SECTOR_SIZE - (cnt % DUMP_SECTOR_SIZE));
+                cnt += DUMP_SECTOR_SIZE - (cnt % DUMP_SECTOR_SIZE);
             }
-            //save OTP
-            for (addr = 0; addr < DUMP_OTP_SIZE; addr += DUMP_BUFF_SIZE)
-                f_write(&fil, (uint8_t *)(DUMP_OTP_ADDR + addr), DUMP_BUFF_SIZE, &bw);
-            //save FLASH
-            for (addr = 0; addr < DUMP_FLASH_SIZE; addr += DUMP_BUFF_SIZE)
-                f_write(&fil, (uint8_t *)(DUMP_FLASH_ADDR + addr), DUMP_BUFF_SIZE, &bw);
-            f_close(&fil);
-            return 1;
+            ret = dump_write(&fil, buff, cnt);
         }
-    }
-    return 0;
+        //save OTP and FLASH directly from memory, large chunks are written by FatFS without copy
+        for (addr = 0; ret && (addr < DUMP_OTP_SIZE); addr += DUMP_BUFF_SIZE)
+            ret = dump_write(&fil, (uint8_t *)(DUMP_OTP_ADDR + addr), DUMP_BUFF_SIZE);
+        for (addr = 0; ret && (addr < DUMP_FLASH_SIZE); addr += DUMP_BUFF_SIZE)
+            ret = dump_write(&fil, (uint8_t *)(DUMP_FLASH_ADDR + addr), DUMP_BUFF_SIZE);
+        if (f_close(&fil) != FR_OK)
+            ret = 0;
+    } else
+        ret = 0;
+    w25x_unlock();
+    free(buff);
+    return ret;
 }
 
 #ifdef _DEBUG
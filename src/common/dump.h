@@ -34,6 +34,58 @@
 // scb registers stored to ccram (140 bytes)
 #define DUMP_REGS_SCB_ADDR 0x1000ff60
 #define DUMP_REGS_SCB_SIZE 0x0000008c
+// whole register area (last 256 bytes of ccram)
+#define DUMP_REGS_ADDR 0x1000ff00
+#define DUMP_REGS_SIZE 0x00000100
+
+// dump v2 - compressed dump with section table stored in xflash slots
+#define DUMP_MAGIC   0x32504d44 // "DMP2"
+#define DUMP_VERSION 0x0002
+
+// xflash dump area (256kb) divided to four 64kb slots (one block64 each)
+#define DUMP_XFLASH_ADDR      0x00000000
+#define DUMP_XFLASH_SLOT_SIZE 0x00010000
+#define DUMP_XFLASH_SLOTS     4
+
+// dump header flags
+#define DUMP_FLAG_RLE       0x01 // sections are rle compressed
+#define DUMP_FLAG_TRUNCATED 0x02 // slot overflow, last section(s) incomplete
+
+#define DUMP_SECT_MAX 8
+
+// rle packing - control byte 0x00..0x7f = literal run of (n + 1) bytes follows
+//                            0x80..0xff = next byte repeated (n - 0x80 + DUMP_RLE_RUN_MIN) times
+#define DUMP_RLE_RUN_MIN 3
+#define DUMP_RLE_RUN_MAX (0x7f + DUMP_RLE_RUN_MIN)
+#define DUMP_RLE_LIT_MAX 0x80
+
+#pragma pack(push)
+#pragma pack(1)
+
+// section table entry
+typedef struct _dump_sect_t {
+    uint32_t addr;   // memory address of dumped area
+    uint32_t size;   // size of dumped area (unpacked)
+    uint32_t offset; // offset of packed data from slot start
+    uint32_t packed; // size of packed data
+} dump_sect_t;
+
+// dump header, first page of slot
+// magic and seq are programmed when dump starts, section table entry when its section is done,
+// rest of the header is programmed after all sections
+typedef struct _dump_hdr_t {
+    uint32_t magic;   // DUMP_MAGIC
+    uint32_t seq;     // sequence number (newest dump has highest)
+    uint16_t version; // DUMP_VERSION, 0xffff = incomplete dump
+    uint8_t type;     // DUMP_TYPE_xxx
+    uint8_t flags;    // DUMP_FLAG_xxx
+    uint32_t tick;    // HAL tick at the time of dump
+    uint32_t size;    // used bytes in slot (header + packed sections)
+    uint32_t count;   // number of sections
+    dump_sect_t sect[DUMP_SECT_MAX]; // entry of unfinished section stays erased (0xff)
+} dump_hdr_t;
+
+#pragma pack(pop)
 
 #define DUMP_REGS_GEN_FAULT()                                                              \
     asm volatile(                                                                          \
@@ -92,8 +144,12 @@
 extern "C" {
 #endif //__cplusplus
 
+// scan xflash slots and pre-erase the slot for next dump (call once at startup, after SPI init)
+extern void dump_init(void);
+
 extern void dump_to_xflash();
 
+// save newest dump followed by OTP and FLASH to file, returns 1 on success
 extern int dump_save_to_usb(const char *fn);
 
 #ifdef _DEBUG
@@ -7,9 +7,12 @@
 #include <string.h>
 #include <stdbool.h>
 
-#define EE_VERSION 0x0003
+#define EE_VERSION 0x0004
 #define EE_VAR_CNT sizeof(eeprom_map_v1)
-#define EE_ADDRESS 0x0500
+#define EE_ADDRESS 0x0800 // marlin settings below (up to 15x15 ABL grid)
+
+#define EE_VERSION_V3 0x0003
+#define EE_ADDRESS_V3 0x0500 // too low for marlin settings with larger ABL grid
 
 const uint8_t eeprom_map_v1[] = {
     VARIANT8_UI16, // EEVAR_VERSION
@@ -100,6 +103,7 @@ variant8_t eeprom_var_default(uint8_t id);
 void eeprom_dump(void);
 void eeprom_print_vars(void);
 void eeprom_clear(void);
+int eeprom_convert_v3(void);
 
 // public functions
 
@@ -110,8 +114,9 @@ uint8_t eeprom_init(void) {
     //eeprom_dump();
     uint16_t version = eeprom_get_var(EEVAR_VERSION).ui16;
     if (version != EE_VERSION) {
-        eeprom_defaults();
-        ret = 1;
+        if (!eeprom_convert_v3())
+            eeprom_defaults();
+        ret = 1; // marlin settings layout changed too, reset them
     }
     //eeprom_print_vars();
     //eeprom_dump();
@@ -231,7 +236,7 @@ void eeprom_dump(void) {
     int j;
     uint8_t b;
     char line[64];
-    for (i = 0; i < 128; i++) // 128 lines = 2048 bytes
+    for (i = 0; i < 256; i++) // 256 lines = 4096 bytes
     {
         sprintf(line, "%04x", i * 16);
         for (j = 0; j < 16; j++) {
@@ -299,10 +304,28 @@ void eeprom_print_vars(void) {
 void eeprom_clear(void) {
     uint16_t a;
     uint32_t data = 0xffffffff;
-    for (a = 0x0000; a < 0x0800; a += 4)
+    for (a = 0x0000; a < 0x1000; a += 4)
         st25dv64k_user_write_bytes(a, &data, 4);
 }
 
+// move variables of version 3 (same map, lower address), returns 1 when done
+int eeprom_convert_v3(void) {
+    uint16_t version = 0;
+    uint16_t size = eeprom_var_addr(EE_VAR_CNT) - EE_ADDRESS;
+    uint16_t off;
+    uint8_t data[16];
+    st25dv64k_user_read_bytes(EE_ADDRESS_V3, &version, sizeof(version));
+    if (version != EE_VERSION_V3)
+        return 0;
+    for (off = 0; off < size; off += sizeof(data)) {
+        uint16_t cnt = ((size - off) < sizeof(data)) ? (size - off) : sizeof(data);
+        st25dv64k_user_read_bytes(EE_ADDRESS_V3 + off, data, cnt);
+        st25dv64k_user_write_bytes(EE_ADDRESS + off, data, cnt);
+    }
+    eeprom_set_var(EEVAR_VERSION, variant8_ui16(EE_VERSION));
+    return 1;
+}
+
 int8_t eeprom_test_PUT(const unsigned int bytes) {
 
     unsigned int i;
@@ -46,7 +46,7 @@ extern variant8_t eeprom_get_var(uint8_t id);
 // set variable value as variant8
 extern void eeprom_set_var(uint8_t id, variant8_t var);
 
-// fill range 0x0000..0x0800 with 0xff
+// fill range 0x0000..0x1000 with 0xff
 extern void eeprom_clear(void);
 
 // fill dest parameter with hostname (max 20 chars)
@@ -0,0 +1,98 @@
+//eth_tx.c - zero-copy transmit of lwIP pbufs by ETH DMA descriptors
+//
+// The pbuf is referenced until the frame is sent, lwIP does not modify
+// referenced tcp segments (tcp_output_segment_busy). Reference is stored at the
+// last descriptor of the frame and released by eth_tx_reclaim when the DMA
+// clears its OWN bit, or when the descriptor is reused.
+
+#include "eth_tx.h"
+#include "lwip/sys.h"
+
+#define ETH_DMA_RAM_START 0x20000000U // SRAM1 + SRAM2, ETH DMA can't access CCM RAM
+#define ETH_DMA_RAM_END   0x20020000U
+
+extern ETH_DMADescTypeDef DMATxDscrTab[ETH_TXBUFNB]; // ethernetif.c
+
+static struct pbuf *eth_tx_pbuf[ETH_TXBUFNB]; // zero-copy frame, stored at its last descriptor
+
+void eth_tx_reclaim(void) {
+    struct pbuf *p;
+    uint32_t i;
+    SYS_ARCH_DECL_PROTECT(old_level);
+    for (i = 0; i < ETH_TXBUFNB; i++) {
+        SYS_ARCH_PROTECT(old_level);
+        p = eth_tx_pbuf[i];
+        if ((p != NULL) && ((DMATxDscrTab[i].Status & ETH_DMATXDESC_OWN) == (uint32_t)RESET))
+            eth_tx_pbuf[i] = NULL;
+        else
+            p = NULL;
+        SYS_ARCH_UNPROTECT(old_level);
+        if (p != NULL)
+            pbuf_free(p);
+    }
+}
+
+static inline int eth_dma_accessible(const void *data, uint16_t len) {
+    return ((uintptr_t)data >= ETH_DMA_RAM_START) && (((uintptr_t)data + len) <= ETH_DMA_RAM_END);
+}
+
+// release frame sent after last reclaim from descriptor that is going to be reused
+static void eth_tx_release(__IO ETH_DMADescTypeDef *desc) {
+    struct pbuf *sent;
+    SYS_ARCH_DECL_PROTECT(old_level);
+    SYS_ARCH_PROTECT(old_level);
+    sent = eth_tx_pbuf[desc - DMATxDscrTab];
+    eth_tx_pbuf[desc - DMATxDscrTab] = NULL;
+    SYS_ARCH_UNPROTECT(old_level);
+    if (sent != NULL)
+        pbuf_free(sent);
+}
+
+int eth_tx_zero_copy(ETH_HandleTypeDef *heth, struct pbuf *p) {
+    __IO ETH_DMADescTypeDef *first = heth->TxDesc;
+    __IO ETH_DMADescTypeDef *desc = first;
+    __IO ETH_DMADescTypeDef *last = first;
+    struct pbuf *q;
+    uint32_t count = 0;
+    uint32_t i = 0;
+    uint32_t status;
+    SYS_ARCH_DECL_PROTECT(old_level);
+
+    for (q = p; q != NULL; q = q->next) {
+        if (q->len == 0)
+            continue;
+        if ((count == ETH_TXBUFNB) || ((desc->Status & ETH_DMATXDESC_OWN) != (uint32_t)RESET) || !eth_dma_accessible(q->payload, q->len))
+            return 0;
+        count++;
+        desc = (ETH_DMADescTypeDef *)(desc->Buffer2NextDescAddr);
+    }
+    if (count == 0)
+        return 0;
+
+    // OWN bit of the first descriptor is set last, DMA must not start with incomplete chain
+    desc = first;
+    for (q = p; q != NULL; q = q->next) {
+        if (q->len == 0)
+            continue;
+        eth_tx_release(desc);
+        status = desc->Status & ~(ETH_DMATXDESC_FS | ETH_DMATXDESC_LS | ETH_DMATXDESC_IC);
+        if (i == 0)
+            status |= ETH_DMATXDESC_FS;
+        if (++i == count)
+            status |= ETH_DMATXDESC_LS | ETH_DMATXDESC_IC; // tx complete interrupt frees the pbuf
+        desc->Buffer1Addr = (uintptr_t)q->payload;
+        desc->ControlBufferSize = q->len & ETH_DMATXDESC_TBS1;
+        desc->Status = (desc == first) ? status : (status | ETH_DMATXDESC_OWN);
+        last = desc;
+        desc = (ETH_DMADescTypeDef *)(desc->Buffer2NextDescAddr);
+    }
+    pbuf_ref(p);
+    first->Status |= ETH_DMATXDESC_OWN;
+    // stored after the chain is owned by DMA, reclaim would free the frame while
+    // its last descriptor still has OWN cleared from previous use
+    SYS_ARCH_PROTECT(old_level);
+    eth_tx_pbuf[last - DMATxDscrTab] = p;
+    SYS_ARCH_UNPROTECT(old_level);
+    heth->TxDesc = (ETH_DMADescTypeDef *)desc;
+    return 1;
+}
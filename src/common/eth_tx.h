@@ -0,0 +1,23 @@
+//eth_tx.h - zero-copy transmit of lwIP pbufs by ETH DMA descriptors
+#ifndef _ETH_TX_H
+#define _ETH_TX_H
+
+#include "stm32f4xx_hal.h"
+#include "lwip/pbuf.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif //defined(__cplusplus)
+
+// free pbufs of transmitted zero-copy frames (tcpip and ethernetif thread)
+extern void eth_tx_reclaim(void);
+
+// chain frame to free tx descriptors and start DMA (tcpip thread)
+// returns 0 when frame can't be sent without copy
+extern int eth_tx_zero_copy(ETH_HandleTypeDef *heth, struct pbuf *p);
+
+#if defined(__cplusplus)
+}
+#endif //defined(__cplusplus)
+
+#endif //_ETH_TX_H
@@ -0,0 +1,88 @@
+// fan_tacho.c - fan tachometer with edge timestamps and period based rpm
+
+#include "fan_tacho.h"
+#include "config.h"
+#include "stm32f4xx_hal.h"
+#include "cmsis_os.h"
+
+// min. period [cycles] (FAN_TACHO_RPM_MAX)
+#define FAN_TACHO_PERIOD_MIN ((uint32_t)(60ULL * SystemCoreClock / ((uint32_t)FAN_TACHO_RPM_MAX * FAN_TACHO_PULSES)))
+
+typedef struct _fan_tacho_t {
+    uint32_t edge;                      // cycle counter at last accepted edge
+    uint32_t edge_tick;                 // tick at last accepted edge [ms]
+    uint32_t period[FAN_TACHO_PERIODS]; // last accepted periods [cycles]
+    uint8_t index;                      // next period index
+    uint8_t count;                      // number of valid periods
+    uint8_t started;                    // reference edge valid
+    uint8_t rejected;                   // consecutive rejected edges
+    uint8_t pwm;                        // pwm [%]
+    uint32_t pwm_tick;                  // tick when pwm reached FAN_TACHO_BLOCKED_PWM [ms]
+} fan_tacho_t;
+
+static fan_tacho_t fan_tacho[FAN_TACHO_CNT];
+
+void fan_tacho_edge(uint8_t fan) {
+    const uint32_t edge = DWT->CYCCNT;
+    const uint32_t tick = HAL_GetTick();
+    if (fan >= FAN_TACHO_CNT)
+        return;
+    fan_tacho_t *pt = fan_tacho + fan;
+    if (!pt->started || ((tick - pt->edge_tick) > FAN_TACHO_TIMEOUT) || (pt->rejected >= FAN_TACHO_REJECT_MAX)) {
+        // first edge after stop or noise burst, period unknown
+        pt->started = 1;
+        pt->count = 0;
+        pt->rejected = 0;
+    } else {
+        const uint32_t period = edge - pt->edge;
+        const uint32_t last = pt->period[(pt->index - 1) & (FAN_TACHO_PERIODS - 1)];
+        if ((period < FAN_TACHO_PERIOD_MIN) || (pt->count && (period < (last / 2)))) {
+            pt->rejected++; // glitch, next period is measured from last accepted edge
+            return;
+        }
+        pt->rejected = 0;
+        pt->period[pt->index] = period;
+        pt->index = (pt->index + 1) & (FAN_TACHO_PERIODS - 1);
+        if (pt->count < FAN_TACHO_PERIODS)
+            pt->count++;
+    }
+    pt->edge = edge;
+    pt->edge_tick = tick;
+}
+
+void fan_tacho_set_pwm(uint8_t fan, uint8_t pwm) {
+    if (fan >= FAN_TACHO_CNT)
+        return;
+    fan_tacho_t *pt = fan_tacho + fan;
+    if ((pt->pwm < FAN_TACHO_BLOCKED_PWM) && (pwm >= FAN_TACHO_BLOCKED_PWM))
+        pt->pwm_tick = HAL_GetTick();
+    pt->pwm = pwm;
+}
+
+uint16_t fan_tacho_get_rpm(uint8_t fan) {
+    uint32_t sum = 0;
+    uint32_t edge_tick;
+    uint8_t count;
+    uint8_t i;
+    uint32_t rpm;
+    if (fan >= FAN_TACHO_CNT)
+        return 0;
+    fan_tacho_t *pt = fan_tacho + fan;
+    taskENTER_CRITICAL();
+    edge_tick = pt->edge_tick;
+    count = pt->count;
+    for (i = 0; i < count; i++)
+        sum += pt->period[(pt->index - 1 - i) & (FAN_TACHO_PERIODS - 1)];
+    taskEXIT_CRITICAL();
+    if ((count == 0) || (sum == 0) || ((HAL_GetTick() - edge_tick) > FAN_TACHO_TIMEOUT))
+        return 0;
+    rpm = (uint32_t)((60ULL * SystemCoreClock * count) / ((uint64_t)FAN_TACHO_PULSES * sum));
+    return (rpm > UINT16_MAX) ? UINT16_MAX : rpm;
+}
+
+int fan_tacho_is_blocked(uint8_t fan) {
+    if (fan >= FAN_TACHO_CNT)
+        return 0;
+    fan_tacho_t *pt = fan_tacho + fan;
+    return (pt->pwm >= FAN_TACHO_BLOCKED_PWM) && ((HAL_GetTick() - pt->pwm_tick) > FAN_TACHO_SPINUP) && (fan_tacho_get_rpm(fan) == 0);
+}
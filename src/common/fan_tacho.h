@@ -0,0 +1,34 @@
+// fan_tacho.h - fan tachometer with edge timestamps and period based rpm
+#ifndef _FAN_TACHO_H
+#define _FAN_TACHO_H
+
+#include <inttypes.h>
+
+// Tacho edges are timestamped in EXTI interrupt by the DWT cycle counter (free running,
+// enabled by sysprof_init). Speed is computed from the average of the last accepted periods,
+// so one fan revolution is enough for a valid reading. Edges faster than FAN_TACHO_RPM_MAX
+// or shorter than half of the previous period are rejected as glitches.
+
+#define FAN_TACHO_CNT 2 // fan index is the same as in hwio_fan_set_pwm (0 - hotend fan, 1 - print fan)
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// tacho edge of fan (EXTI interrupt)
+extern void fan_tacho_edge(uint8_t fan);
+
+// pwm of fan changed [0..100%] (hwio), starts spin-up time for blocked detection
+extern void fan_tacho_set_pwm(uint8_t fan, uint8_t pwm);
+
+// fan speed [rpm], 0 when no edge within FAN_TACHO_TIMEOUT
+extern uint16_t fan_tacho_get_rpm(uint8_t fan);
+
+// fan runs with pwm of at least FAN_TACHO_BLOCKED_PWM longer than FAN_TACHO_SPINUP and does not spin
+extern int fan_tacho_is_blocked(uint8_t fan);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //_FAN_TACHO_H
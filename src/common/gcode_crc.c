@@ -0,0 +1,292 @@
+// gcode_crc.c - crc32 integrity check of gcode files
+
+#include "config.h"
+
+#ifdef GCODE_CRC
+
+    #include "gcode_crc.h"
+    #include <string.h>
+    #include <stdlib.h>
+    #include <ctype.h>
+
+    #ifdef STM32F407xx
+        #include "stm32f4xx.h"
+        #include "cmsis_os.h"
+        #include "tm_stm32f4_crc.h"
+        #define GCODE_CRC_HW_WORDS 64 // max. words per peripheral update (critical section)
+    #endif                            //STM32F407xx
+
+// file objects, paths and read buffers are static, on stack they would take about 900 bytes
+// of the calling task (Marlin task stack is 1024 words)
+// open and close run in Marlin task (print) and gui task (print preview), they share
+// gcode_crc_fil, gcode_crc_finfo, gcode_crc_sidecar and gcode_crc_text under gcode_crc_lock
+// pre-print pass (gcode_crc_verify) runs in Marlin task only and has its own file and buffer
+static FIL gcode_crc_fil;
+static FILINFO gcode_crc_finfo;
+static char gcode_crc_sidecar[GCODE_CRC_PATH_LEN];
+static char gcode_crc_text[GCODE_CRC_TAIL + 1]; // sidecar line or tail of gcode file
+static gcode_crc_cache_t gcode_crc_cached;
+static FIL gcode_crc_verify_fil;
+static uint32_t gcode_crc_verify_block[GCODE_CRC_BLOCK_SIZE / 4]; // word aligned for peripheral
+
+    #ifdef STM32F407xx
+
+static osSemaphoreId gcode_crc_sema = 0;
+
+static void gcode_crc_lock(void) {
+    if (gcode_crc_sema == 0) {
+        osSemaphoreDef(gcodeCrcSema);
+        gcode_crc_sema = osSemaphoreCreate(osSemaphore(gcodeCrcSema), 1);
+    }
+    osSemaphoreWait(gcode_crc_sema, osWaitForever);
+}
+
+static void gcode_crc_unlock(void) {
+    osSemaphoreRelease(gcode_crc_sema);
+}
+
+    #else //STM32F407xx
+
+        #define gcode_crc_lock()
+
+        #define gcode_crc_unlock()
+
+    #endif //STM32F407xx
+
+    #define CRC32_POLY     0x04c11db7 // normal form (CRC peripheral, MSB first)
+    #define CRC32_POLY_REV 0xedb88320 // reflected form (zlib, LSB first)
+
+// reflected crc32 of 4 bits
+static const uint32_t crc32_nibble[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+};
+
+// software update of reflected crc register (inverted crc32)
+static uint32_t crc32_sw(uint32_t reg, const uint8_t *data, uint32_t cnt) {
+    while (cnt--) {
+        reg ^= *(data++);
+        reg = (reg >> 4) ^ crc32_nibble[reg & 0x0f];
+        reg = (reg >> 4) ^ crc32_nibble[reg & 0x0f];
+    }
+    return reg;
+}
+
+    #ifdef STM32F407xx
+
+// word that sets CRC peripheral data register to reg when written after reset
+// (register has no initial value setting, one word update is inverted instead)
+static uint32_t crc32_hw_preset(uint32_t reg) {
+    int i;
+    for (i = 0; i < 32; i++)
+        reg = (reg & 1) ? (((reg ^ CRC32_POLY) >> 1) | 0x80000000) : (reg >> 1);
+    return reg ^ 0xffffffff;
+}
+
+// peripheral update of reflected crc register, words and register are bit reversed
+// so the peripheral (MSB first) computes reflected crc32 of little endian data
+static uint32_t crc32_hw(uint32_t reg, const uint32_t *data, uint32_t cnt) {
+    const uint32_t preset = crc32_hw_preset(__RBIT(reg));
+    taskENTER_CRITICAL(); // peripheral is shared (support_utils)
+    TM_CRC_Init();
+    CRC->CR = CRC_CR_RESET;
+    CRC->DR = preset;
+    while (cnt--)
+        CRC->DR = __RBIT(*(data++));
+    reg = __RBIT(CRC->DR);
+    taskEXIT_CRITICAL();
+    return reg;
+}
+
+    #endif //STM32F407xx
+
+uint32_t gcode_crc32(uint32_t crc, const uint8_t *data, uint32_t cnt) {
+    uint32_t reg = ~crc;
+    #ifdef STM32F407xx
+    uint32_t n = (4 - ((uintptr_t)data & 3)) & 3; // unaligned head
+    uint32_t words;
+    if (n > cnt)
+        n = cnt;
+    reg = crc32_sw(reg, data, n);
+    data += n;
+    cnt -= n;
+    while (cnt >= 4) {
+        words = cnt / 4;
+        if (words > GCODE_CRC_HW_WORDS)
+            words = GCODE_CRC_HW_WORDS;
+        reg = crc32_hw(reg, (const uint32_t *)data, words);
+        data += words * 4;
+        cnt -= words * 4;
+    }
+    #endif //STM32F407xx
+    return ~crc32_sw(reg, data, cnt);
+}
+
+// gcode file name with appended extension, returns 0 when too long
+static int gcode_crc_sidecar_path(const char *path, const char *ext, char *sidecar) {
+    if ((strlen(path) + strlen(ext)) >= GCODE_CRC_PATH_LEN)
+        return 0;
+    strcpy(sidecar, path);
+    strcat(sidecar, ext);
+    return 1;
+}
+
+// checksum at str, 8 hex digits followed by whitespace or end of string
+static int gcode_crc_parse_hex(const char *str, uint32_t *crc) {
+    char *end;
+    if (!isxdigit((unsigned char)*str))
+        return 0;
+    *crc = strtoul(str, &end, 16);
+    return ((end - str) == 8) && strchr(" \t\r\n", *end);
+}
+
+// checksum from sidecar file, first token of 8 hex digits on the first line
+static int gcode_crc_load_sidecar(gcode_crc_t *ctx) {
+    const char *p = gcode_crc_text;
+    UINT br;
+    if (!gcode_crc_sidecar_path(ctx->path, GCODE_CRC_EXT, gcode_crc_sidecar) || (f_open(&gcode_crc_fil, gcode_crc_sidecar, FA_READ) != FR_OK))
+        return 0;
+    if (f_read(&gcode_crc_fil, gcode_crc_text, GCODE_CRC_TAIL, &br) != FR_OK)
+        br = 0;
+    f_close(&gcode_crc_fil);
+    gcode_crc_text[br] = 0;
+    while (*p && (*p != '\r') && (*p != '\n')) {
+        if (gcode_crc_parse_hex(p, &ctx->cache.expected)) {
+            ctx->size = ctx->cache.fsize;
+            return 1;
+        }
+        while (*p && !strchr(" \t\r\n", *p)) // next token
+            p++;
+        while ((*p == ' ') || (*p == '\t'))
+            p++;
+    }
+    return 0;
+}
+
+// checksum from last embedded checksum line, covers bytes before the line
+static int gcode_crc_load_embedded(gcode_crc_t *ctx) {
+    static const char prefix[] = "\n" GCODE_CRC_EMBEDDED;
+    const uint32_t offs = (ctx->cache.fsize > GCODE_CRC_TAIL) ? (ctx->cache.fsize - GCODE_CRC_TAIL) : 0;
+    UINT br;
+    int i;
+    if (f_open(&gcode_crc_fil, ctx->path, FA_READ) != FR_OK)
+        return 0;
+    if ((f_lseek(&gcode_crc_fil, offs) != FR_OK) || (f_read(&gcode_crc_fil, gcode_crc_text, GCODE_CRC_TAIL, &br) != FR_OK))
+        br = 0;
+    f_close(&gcode_crc_fil);
+    gcode_crc_text[br] = 0;
+    for (i = (int)br - (int)(sizeof(prefix) - 1); i >= 0; i--)
+        if (memcmp(gcode_crc_text + i, prefix, sizeof(prefix) - 1) == 0) {
+            if (!gcode_crc_parse_hex(gcode_crc_text + i + sizeof(prefix) - 1, &ctx->cache.expected))
+                return 0;
+            ctx->size = offs + i + 1; // newline before the line is covered
+            return 1;
+        }
+    return 0;
+}
+
+// cached result for the same file content and checksum
+static int gcode_crc_load_cache(gcode_crc_t *ctx) {
+    const gcode_crc_cache_t *cache = &gcode_crc_cached;
+    UINT br;
+    int ok = 0;
+    if (!gcode_crc_sidecar_path(ctx->path, GCODE_CRC_CACHE_EXT, gcode_crc_sidecar) || (f_open(&gcode_crc_fil, gcode_crc_sidecar, FA_READ) != FR_OK))
+        return 0;
+    if ((f_read(&gcode_crc_fil, &gcode_crc_cached, sizeof(gcode_crc_cached), &br) == FR_OK) && (br == sizeof(gcode_crc_cached))
+        && (cache->magic == ctx->cache.magic) && (cache->fsize == ctx->cache.fsize) && (cache->fdate == ctx->cache.fdate)
+        && (cache->ftime == ctx->cache.ftime) && (cache->expected == ctx->cache.expected)
+        && ((cache->state == GCODE_CRC_OK) || (cache->state == GCODE_CRC_MISMATCH))) {
+        ctx->cache = *cache;
+        ok = 1;
+    }
+    f_close(&gcode_crc_fil);
+    return ok;
+}
+
+static void gcode_crc_save_cache(gcode_crc_t *ctx) {
+    UINT bw;
+    if (!gcode_crc_sidecar_path(ctx->path, GCODE_CRC_CACHE_EXT, gcode_crc_sidecar) || (f_open(&gcode_crc_fil, gcode_crc_sidecar, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK))
+        return; // read-only media is fine, file is just verified again next time
+    f_write(&gcode_crc_fil, &ctx->cache, sizeof(ctx->cache), &bw);
+    f_close(&gcode_crc_fil);
+}
+
+uint8_t gcode_crc_open(gcode_crc_t *ctx, const char *path) {
+    memset(ctx, 0, sizeof(gcode_crc_t));
+    if (strlen(path) >= GCODE_CRC_PATH_LEN)
+        return ctx->state; // GCODE_CRC_NONE
+    gcode_crc_lock();
+    if (f_stat(path, &gcode_crc_finfo) == FR_OK) {
+        strcpy(ctx->path, path);
+        ctx->cache.magic = GCODE_CRC_MAGIC;
+        ctx->cache.fsize = gcode_crc_finfo.fsize;
+        ctx->cache.fdate = gcode_crc_finfo.fdate;
+        ctx->cache.ftime = gcode_crc_finfo.ftime;
+        if (gcode_crc_load_sidecar(ctx) || gcode_crc_load_embedded(ctx))
+            ctx->state = gcode_crc_load_cache(ctx) ? ctx->cache.state : GCODE_CRC_PENDING;
+    }
+    gcode_crc_unlock();
+    return ctx->state;
+}
+
+uint8_t gcode_crc_verify(gcode_crc_t *ctx, void (*idle)(void)) {
+    uint32_t crc = 0;
+    uint32_t pos = 0;
+    UINT br;
+    if (ctx->state != GCODE_CRC_PENDING)
+        return ctx->state;
+    if (f_open(&gcode_crc_verify_fil, ctx->path, FA_READ) != FR_OK)
+        return ctx->state;
+    while (pos < ctx->size) {
+        const uint32_t n = ((ctx->size - pos) < sizeof(gcode_crc_verify_block)) ? (ctx->size - pos) : sizeof(gcode_crc_verify_block);
+        if ((f_read(&gcode_crc_verify_fil, gcode_crc_verify_block, n, &br) != FR_OK) || (br != n))
+            break;
+        crc = gcode_crc32(crc, (const uint8_t *)gcode_crc_verify_block, n);
+        pos += n;
+        if (idle)
+            idle();
+    }
+    f_close(&gcode_crc_verify_fil);
+    if (pos < ctx->size) // read error or media removed, streaming check decides
+        return ctx->state;
+    ctx->cache.crc = crc;
+    ctx->cache.state = (crc == ctx->cache.expected) ? GCODE_CRC_OK : GCODE_CRC_MISMATCH;
+    ctx->state = ctx->cache.state; // verified, bytes read by printing are not checked again
+    gcode_crc_lock();
+    gcode_crc_save_cache(ctx);
+    gcode_crc_unlock();
+    return ctx->state;
+}
+
+void gcode_crc_put(gcode_crc_t *ctx, uint8_t byte) {
+    if ((ctx->state != GCODE_CRC_PENDING) || (ctx->pos++ >= ctx->size))
+        return;
+    ((uint8_t *)ctx->buff)[ctx->cnt++] = byte;
+    if (ctx->cnt == GCODE_CRC_BUFF_SIZE) {
+        ctx->crc = gcode_crc32(ctx->crc, (const uint8_t *)ctx->buff, ctx->cnt);
+        ctx->cnt = 0;
+    }
+}
+
+void gcode_crc_seek(gcode_crc_t *ctx, uint32_t pos) {
+    if ((ctx->state == GCODE_CRC_PENDING) && (pos != ctx->pos))
+        ctx->state = GCODE_CRC_SKIPPED;
+}
+
+uint8_t gcode_crc_close(gcode_crc_t *ctx) {
+    if (ctx->state != GCODE_CRC_PENDING)
+        return ctx->state;
+    if (ctx->pos < ctx->size) { // aborted
+        ctx->state = GCODE_CRC_SKIPPED;
+        return ctx->state;
+    }
+    ctx->cache.crc = gcode_crc32(ctx->crc, (const uint8_t *)ctx->buff, ctx->cnt);
+    ctx->cache.state = (ctx->cache.crc == ctx->cache.expected) ? GCODE_CRC_OK : GCODE_CRC_MISMATCH;
+    ctx->state = ctx->cache.state;
+    gcode_crc_lock();
+    gcode_crc_save_cache(ctx);
+    gcode_crc_unlock();
+    return ctx->state;
+}
+
+#endif //GCODE_CRC
@@ -0,0 +1,92 @@
+// gcode_crc.h - crc32 integrity check of gcode files
+#ifndef _GCODE_CRC_H
+#define _GCODE_CRC_H
+
+#include <inttypes.h>
+#include "ff.h"
+
+// Expected checksum is read from sidecar text file (gcode file name + GCODE_CRC_EXT) with
+// 8 hex digits covering the whole file (output of crc32 tool, sfv line), or from embedded
+// comment line near the end of the file ("; crc32 = 1a2b3c4d") covering all bytes before it.
+// The crc32 is the zlib/IEEE 802.3 one, computed by CRC peripheral (software on host build).
+// When a print starts, the file is read once sequentially before printing (gcode_crc_verify).
+// Only when that pass can't read the file to the end, bytes read by the printing are checked
+// instead (gcode_crc_put).
+// Result is cached in sidecar file (gcode file name + GCODE_CRC_CACHE_EXT) with size and
+// modification time of the gcode file, unchanged files are not verified again.
+
+#define GCODE_CRC_EXT        ".crc32"     // sidecar checksum file extension (appended to gcode file name)
+#define GCODE_CRC_CACHE_EXT  ".pcv"       // cached result file extension (appended to gcode file name)
+#define GCODE_CRC_MAGIC      0x56435050   // "PPCV"
+#define GCODE_CRC_EMBEDDED   "; crc32 = " // embedded checksum line prefix
+#define GCODE_CRC_TAIL       64           // embedded checksum line is searched in last bytes of file
+#define GCODE_CRC_PATH_LEN   (_MAX_LFN + 2)
+#define GCODE_CRC_BUFF_SIZE  64           // bytes collected by gcode_crc_put before crc update
+#define GCODE_CRC_BLOCK_SIZE 512          // bytes per read of pre-print pass
+
+#define GCODE_CRC_NONE     0 // no checksum for the file
+#define GCODE_CRC_PENDING  1 // checksum found, file not read to the end yet
+#define GCODE_CRC_OK       2 // file matches checksum
+#define GCODE_CRC_MISMATCH 3 // file does not match checksum (corrupted or truncated)
+#define GCODE_CRC_SKIPPED  4 // file not read sequentially to the end (seek, abort), result unknown
+
+#define GCODE_CRC_MSG_MISMATCH "G-code CRC mismatch"
+
+#pragma pack(push)
+#pragma pack(1)
+
+// cache file content
+typedef struct _gcode_crc_cache_t {
+    uint32_t magic;    // GCODE_CRC_MAGIC
+    uint32_t fsize;    // gcode file size
+    uint16_t fdate;    // gcode file modification date (FatFS format)
+    uint16_t ftime;    // gcode file modification time (FatFS format)
+    uint32_t expected; // checksum from sidecar or embedded line
+    uint32_t crc;      // computed crc32
+    uint8_t state;     // GCODE_CRC_OK or GCODE_CRC_MISMATCH
+} gcode_crc_cache_t;
+
+#pragma pack(pop)
+
+// verification of one file
+typedef struct _gcode_crc_t {
+    gcode_crc_cache_t cache;                // file identity and result
+    uint32_t size;                          // bytes covered by checksum
+    uint32_t pos;                           // file position of next byte
+    uint32_t crc;                           // crc32 of bytes before buff
+    uint32_t buff[GCODE_CRC_BUFF_SIZE / 4]; // bytes not yet in crc (word aligned for peripheral)
+    uint8_t cnt;                            // bytes in buff
+    uint8_t state;                          // GCODE_CRC_xxx
+    char path[GCODE_CRC_PATH_LEN];          // gcode file path
+} gcode_crc_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// update crc32 with cnt bytes (zlib compatible, initial crc is 0)
+extern uint32_t gcode_crc32(uint32_t crc, const uint8_t *data, uint32_t cnt);
+
+// find checksum and cached result of file, returns state (cached result, PENDING or NONE)
+extern uint8_t gcode_crc_open(gcode_crc_t *ctx, const char *path);
+
+// read whole file sequentially before printing (PENDING state only), writes result to cache,
+// idle is called after each block (Marlin idle, heaters are managed during the pass),
+// returns OK or MISMATCH (ctx state too), or PENDING when the file could not be read to the end
+// (bytes read by printing are checked then)
+extern uint8_t gcode_crc_verify(gcode_crc_t *ctx, void (*idle)(void));
+
+// next byte read from file (PENDING state only)
+extern void gcode_crc_put(gcode_crc_t *ctx, uint8_t byte);
+
+// file position changed, verification is skipped when it is not the next byte
+extern void gcode_crc_seek(gcode_crc_t *ctx, uint32_t pos);
+
+// finish verification (file closed), writes result to cache, returns final state
+extern uint8_t gcode_crc_close(gcode_crc_t *ctx);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //_GCODE_CRC_H
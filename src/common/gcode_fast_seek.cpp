@@ -0,0 +1,64 @@
+// gcode_fast_seek.cpp - pool of FatFS fast-seek cluster link maps for gcode files
+#include "gcode_file.h"
+#include "dbg.h"
+#include "config.h"
+#include "cmsis_os.h"
+
+#define DBG _dbg0
+
+#ifdef GCODE_FAST_SEEK
+
+struct FastSeekMap {
+    FIL *owner;
+    DWORD table[GCODE_FAST_SEEK_MAP_SIZE]; // CLMT: size, (cluster count, first cluster) pairs, 0
+};
+
+static FastSeekMap fast_seek_maps[GCODE_FAST_SEEK_MAPS];
+
+// map is free when not attached or its file was closed (or reopened) without detach
+static bool fast_seek_map_free(const FastSeekMap &map) {
+    return !map.owner || !map.owner->obj.fs || (map.owner->cltbl != map.table);
+}
+
+#endif //GCODE_FAST_SEEK
+
+extern "C" bool f_gcode_fast_seek_attach(FIL *fp) {
+#ifdef GCODE_FAST_SEEK
+    FastSeekMap *map = nullptr;
+    taskENTER_CRITICAL();
+    for (auto &m : fast_seek_maps)
+        if (fast_seek_map_free(m)) {
+            map = &m;
+            map->owner = fp;
+            map->table[0] = GCODE_FAST_SEEK_MAP_SIZE;
+            fp->cltbl = map->table;
+            break;
+        }
+    taskEXIT_CRITICAL();
+    if (!map) {
+        DBG("fast seek map pool exhausted");
+        return false;
+    }
+    // one pass through the FAT chain, FR_NOT_ENOUGH_CORE when too fragmented
+    FRESULT res = f_lseek(fp, CREATE_LINKMAP);
+    if (res == FR_OK)
+        return true;
+    DBG("fast seek map not created (%d, %u items required)", res, (unsigned)map->table[0]);
+    taskENTER_CRITICAL();
+    fp->cltbl = nullptr;
+    map->owner = nullptr;
+    taskEXIT_CRITICAL();
+#endif //GCODE_FAST_SEEK
+    return false;
+}
+
+extern "C" void f_gcode_fast_seek_detach(FIL *fp) {
+#ifdef GCODE_FAST_SEEK
+    taskENTER_CRITICAL();
+    for (auto &m : fast_seek_maps)
+        if (m.owner == fp)
+            m.owner = nullptr;
+    fp->cltbl = nullptr;
+    taskEXIT_CRITICAL();
+#endif //GCODE_FAST_SEEK
+}
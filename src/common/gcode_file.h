@@ -10,6 +10,17 @@ extern "C" {
 int f_gcode_thumb_open(FILE *fp, FIL *real_file);
 int f_gcode_thumb_close(FILE *fp);
 
+/// Attach fast-seek cluster link map from bounded pool to file opened for reading
+///
+/// f_lseek (and f_read across clusters) then finds clusters in the map instead of
+/// following the FAT chain from the start of the file. Returns false when the pool
+/// is exhausted or the file has too many fragments, file uses normal seek then.
+/// File must not be written or expanded while the map is attached.
+bool f_gcode_fast_seek_attach(FIL *fp);
+
+/// Return link map of file to the pool, call before f_close
+void f_gcode_fast_seek_detach(FIL *fp);
+
 /// Parse comment line in given file
 ///
 /// Reads from the file current line and parses it.
@@ -8,13 +8,13 @@
 #include "cmsis_os.h"
 #include "gpio.h"
 #include "adc.h"
-#include "sim_nozzle.h"
-#include "sim_bed.h"
+#include "sim_thermal.h"
 #include "sim_motion.h"
 #include "Arduino.h"
 #include "timer_defaults.h"
 #include "hwio_pindef.h"
 #include "filament_sensor.h"
+#include "fan_tacho.h"
 #include "bsod.h"
 
 //hwio arduino wrapper errors
@@ -436,6 +436,12 @@ void _hwio_pwm_analogWrite_set_val(int i_pwm, int val) {
         uint32_t pulse = (val * pwm_max) / _pwm_analogWrite_max[i_pwm];
         hwio_pwm_set_val(i_pwm, pulse);
         _pwm_analogWrite_val[i_pwm] = val;
+        if ((i_pwm >= _FAN_ID_MIN) && (i_pwm <= _FAN_ID_MAX))
+            fan_tacho_set_pwm(i_pwm - _FAN_ID_MIN, (100 * val) / _pwm_analogWrite_max[i_pwm]);
+#ifdef SIM_HEATER
+        if (i_pwm == HWIO_PWM_FAN) //part cooling fan
+            sim_thermal_set_fan((float)val / _pwm_analogWrite_max[i_pwm]);
+#endif //SIM_HEATER
     }
 }
 
@@ -550,16 +556,6 @@ void adc_ready(uint8_t index) {
     _adc_val[index] = adc_val[index] >> 4;
 }
 
-// channel priority sequence callback
-const uint8_t adc_seq[18] = { 4, 1, 4, 1, 4, 0, 4, 1, 4, 1, 4, 2, 4, 1, 4, 1, 4, 3 };
-uint8_t adc_seq2idx(uint8_t seq) {
-    return adc_seq[seq];
-    //	return 2;
-    //	if ((seq % 3) != 2) return 2;
-    //	if (seq != 8) return 0;
-    //	return 1;
-}
-
 //--------------------------------------
 // Arduino digital/analog read/write error handler
 
@@ -668,7 +664,7 @@ void hwio_arduino_digitalWrite(uint32_t ulPin, uint32_t ulVal) {
             //hwio_heater_set_pwm(_HEATER_BED, ulVal?255:0);
 #ifdef SIM_HEATER_BED_ADC
             if (adc_sim_msk & (1 << SIM_HEATER_BED_ADC))
-                sim_bed_set_power(ulVal ? 100 : 0);
+                sim_thermal_set_power(SIM_THERMAL_BED, ulVal ? 1 : 0);
             else
 #endif //SIM_HEATER_BED_ADC
                 _hwio_pwm_analogWrite_set_val(HWIO_PWM_HEATER_BED, ulVal ? _pwm_analogWrite_max[HWIO_PWM_HEATER_BED] : 0);
@@ -677,7 +673,7 @@ void hwio_arduino_digitalWrite(uint32_t ulPin, uint32_t ulVal) {
             //hwio_heater_set_pwm(_HEATER_0, ulVal?255:0);
 #ifdef SIM_HEATER_NOZZLE_ADC
             if (adc_sim_msk & (1 << SIM_HEATER_NOZZLE_ADC))
-                sim_nozzle_set_power(ulVal ? 40 : 0);
+                sim_thermal_set_power(SIM_THERMAL_NOZZLE, ulVal ? 1 : 0);
             else
 #endif //SIM_HEATER_NOZZLE_ADC
                 _hwio_pwm_analogWrite_set_val(HWIO_PWM_HEATER_0, ulVal ? _pwm_analogWrite_max[HWIO_PWM_HEATER_0] : 0);
@@ -806,10 +802,20 @@ void hwio_arduino_analogWrite(uint32_t ulPin, uint32_t ulValue) {
             _hwio_pwm_analogWrite_set_val(HWIO_PWM_FAN, ulValue);
             return;
         case PIN_HEATER_BED:
-            _hwio_pwm_analogWrite_set_val(HWIO_PWM_HEATER_BED, ulValue);
+#ifdef SIM_HEATER_BED_ADC
+            if (adc_sim_msk & (1 << SIM_HEATER_BED_ADC))
+                sim_thermal_set_power(SIM_THERMAL_BED, (float)ulValue / _pwm_analogWrite_max[HWIO_PWM_HEATER_BED]);
+            else
+#endif //SIM_HEATER_BED_ADC
+                _hwio_pwm_analogWrite_set_val(HWIO_PWM_HEATER_BED, ulValue);
             return;
         case PIN_HEATER_0:
-            _hwio_pwm_analogWrite_set_val(HWIO_PWM_HEATER_0, ulValue);
+#ifdef SIM_HEATER_NOZZLE_ADC
+            if (adc_sim_msk & (1 << SIM_HEATER_NOZZLE_ADC))
+                sim_thermal_set_power(SIM_THERMAL_NOZZLE, (float)ulValue / _pwm_analogWrite_max[HWIO_PWM_HEATER_0]);
+            else
+#endif //SIM_HEATER_NOZZLE_ADC
+                _hwio_pwm_analogWrite_set_val(HWIO_PWM_HEATER_0, ulValue);
             return;
         default:
             hwio_arduino_error(HWIO_ERR_UNDEF_ANA_WR, ulPin); //error: undefined pin analog write
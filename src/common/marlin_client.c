@@ -45,7 +45,6 @@ typedef struct _marlin_client_t {
     uint32_t ack;        // cached ack value from last Acknowledge event
     uint16_t last_count; // number of messages received in last client loop
     uint64_t errors;
-    marlin_mesh_t mesh;          // meshbed leveling
     uint32_t command;            // processed command (G28,G29,M701,M702,M600)
     marlin_host_prompt_t prompt; // current host prompt structure (type and buttons)
     uint8_t reheating;           // reheating in progress
@@ -102,8 +101,6 @@ marlin_vars_t *marlin_client_init(void) {
         marlin_clients++;
         client->flags |= (MARLIN_CFLG_STARTED | MARLIN_CFLG_PROCESS);
         client->errors = 0;
-        client->mesh.xc = 4;
-        client->mesh.yc = 4;
         client->command = MARLIN_CMD_NONE;
         client->reheating = 0;
         client->dialog_cb = NULL;
@@ -412,7 +409,7 @@ uint8_t marlin_get_gqueue(void) {
 uint8_t marlin_get_gqueue_max(void) {
     //TODO: variable gqueue_max should be part of marlin_consts structure transmited from server
     //Marlin/queue, BUFSIZE - 1
-    return 8 - 1;
+    return 32 - 1;
 }
 
 uint8_t marlin_get_pqueue(void) {
@@ -422,7 +419,22 @@ uint8_t marlin_get_pqueue(void) {
 uint8_t marlin_get_pqueue_max(void) {
     //TODO: variable pqueue_max should be part of marlin_consts structure transmited from server
     //Marlin/planner, BLOCK_BUFFER_SIZE - 1
-    return 16 - 1;
+    return 64 - 1;
+}
+
+int marlin_get_snapshot(marlin_snapshot_t *snap, uint8_t parts) {
+    snap->version = MARLIN_SNAPSHOT_VERSION;
+    snap->size = sizeof(marlin_snapshot_t);
+    snap->parts = parts;
+    return marlin_server_get_snapshot(snap);
+}
+
+void marlin_get_snapshot_vars(marlin_vars_t *vars) {
+    marlin_server_get_snapshot_vars(vars);
+}
+
+void marlin_get_message(char *msg) {
+    marlin_server_get_message(msg);
 }
 
 float marlin_set_target_nozzle(float val) {
@@ -531,6 +543,14 @@ void marlin_park_head(void) {
     _wait_ack_from_server(client->id);
 }
 
+void marlin_journal_restore_mesh(void) {
+    marlin_client_t *client = _client_ptr();
+    if (client == 0)
+        return;
+    _send_request_to_server(client->id, "!jmesh");
+    _wait_ack_from_server(client->id);
+}
+
 uint8_t marlin_message_received(void) {
     marlin_client_t *client = _client_ptr();
     if (client == 0)
@@ -652,12 +672,6 @@ void _process_client_message(marlin_client_t *client, variant8_t msg) {
     {
         client->events |= ((uint64_t)1 << id);
         switch (id) {
-        case MARLIN_EVT_MeshUpdate: {
-            uint8_t x = msg.usr16 & 0xff;
-            uint8_t y = msg.usr16 >> 8;
-            float z = msg.flt;
-            client->mesh.z[x + client->mesh.xc * y] = z;
-        } break;
         case MARLIN_EVT_HostPrompt:
             marlin_host_prompt_decode(msg.ui32, &(client->prompt));
             break;
@@ -700,17 +714,11 @@ void _process_client_message(marlin_client_t *client, variant8_t msg) {
         if (DBG_EVT_MSK & ((uint64_t)1 << id))
 #endif
             switch (id) {
-            // Event MARLIN_EVT_MeshUpdate - ui32 is float z, ui16 low byte is x index, high byte y index
-            case MARLIN_EVT_MeshUpdate: {
-                uint8_t x = msg.usr16 & 0xff;
-                uint8_t y = msg.usr16 >> 8;
-                float z = msg.flt;
-                DBG_EVT("CL%c: EVT %s %d %d %.3f", '0' + client->id, marlin_events_get_name(id),
-                    x, y, (double)z);
-                x = x;
-                y = y;
-                z = z; //prevent warning
-            } break;
+            // Event MARLIN_EVT_MeshUpdate - ui32 is snapshot sequence number, ui16 low byte is x count, high byte y count
+            case MARLIN_EVT_MeshUpdate:
+                DBG_EVT("CL%c: EVT %s %u %ux%u", '0' + client->id, marlin_events_get_name(id),
+                    (unsigned)msg.ui32, msg.usr16 & 0xff, msg.usr16 >> 8);
+                break;
             // Event MARLIN_EVT_CommandBegin/End - ui32 is encoded command
             case MARLIN_EVT_CommandBegin:
             case MARLIN_EVT_CommandEnd:
@@ -6,6 +6,7 @@
 #include "marlin_vars.h"
 #include "marlin_errors.h"
 #include "marlin_host.h"
+#include "marlin_server.h"
 
 // client flags
 #define MARLIN_CFLG_STARTED 0x0001 // client started (set in marlin_client_init)
@@ -137,6 +138,15 @@ extern uint8_t marlin_get_pqueue(void);
 // returns maximum number of records in planner queue
 extern uint8_t marlin_get_pqueue_max(void);
 
+// copy requested parts (MARLIN_SNAPSHOT_xxx) of server state at once, returns 1 on success
+extern int marlin_get_snapshot(marlin_snapshot_t *snap, uint8_t parts);
+
+// copy consistent set of server variables (MARLIN_SNAPSHOT_VARS), without the rest of the snapshot
+extern void marlin_get_snapshot_vars(marlin_vars_t *vars);
+
+// copy newest status message (msg has MSG_MAX_LENGTH chars), without the rest of the snapshot
+extern void marlin_get_message(char *msg);
+
 // variable setters (internally calls marlin_set_var)
 extern float marlin_set_target_nozzle(float val);
 extern float marlin_set_target_bed(float val);
@@ -165,6 +175,9 @@ extern void marlin_print_resume(void);
 
 extern void marlin_park_head(void);
 
+// restore bed leveling grid of interrupted print from power-loss journal (before resume gcodes)
+extern void marlin_journal_restore_mesh(void);
+
 extern uint8_t marlin_message_received(void);
 
 // returns current host prompt type
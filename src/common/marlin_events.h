@@ -21,7 +21,7 @@
 #define MARLIN_EVT_FactoryReset        0x0d // onFactoryReset()
 #define MARLIN_EVT_LoadSettings        0x0e // onLoadSettings()
 #define MARLIN_EVT_StoreSettings       0x0f // onStoreSettings()
-#define MARLIN_EVT_MeshUpdate          0x10 // onMeshUpdate(const uint8_t xpos, const uint8_t ypos, const float zval)
+#define MARLIN_EVT_MeshUpdate          0x10 // onMeshUpdate(const uint8_t xpos, const uint8_t ypos, const float zval) - coalesced, read with marlin_get_snapshot(MARLIN_SNAPSHOT_MESH)
 // Marlin events - host actions
 #define MARLIN_EVT_HostPrompt 0x11 // host_action_prompt
 // Marlin events - other
@@ -60,7 +60,7 @@
 #define MARLIN_CMD_M702 (MARLIN_CMD_M + 702)
 #define MARLIN_CMD_M876 (MARLIN_CMD_M + 876)
 
-#define MARLIN_MAX_MESH_POINTS (4 * 4)
+#define MARLIN_MAX_MESH_POINTS (15 * 15)
 
 #pragma pack(push)
 #pragma pack(1)
@@ -102,9 +102,10 @@ typedef union _marlin_events_t {
 } marlin_events_t;
 
 typedef struct _marlin_mesh_t {
-    float z[MARLIN_MAX_MESH_POINTS];
-    uint8_t xc;
-    uint8_t yc;
+    float z[MARLIN_MAX_MESH_POINTS]; // z values, index = x + xc * y
+    uint8_t xc;                      // number of points in x
+    uint8_t yc;                      // number of points in y
+    uint16_t seq;                    // snapshot sequence number (incremented on every change)
 } marlin_mesh_t;
 
 #pragma pack(pop)
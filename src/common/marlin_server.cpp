@@ -11,6 +11,8 @@
 #include "../Marlin/src/lcd/extensible_ui/ui_api.h"
 #include "../Marlin/src/gcode/queue.h"
 #include "../Marlin/src/gcode/parser.h"
+#include "../Marlin/src/gcode/gcode.h"
+#include "../Marlin/src/module/motion.h"
 #include "../Marlin/src/module/planner.h"
 #include "../Marlin/src/module/stepper.h"
 #include "../Marlin/src/module/temperature.h"
@@ -20,13 +22,20 @@
 #include "../Marlin/src/feature/host_actions.h"
 #include "../Marlin/src/feature/babystep.h"
 #include "../Marlin/src/feature/pause.h"
+#include "../Marlin/src/feature/bedlevel/bedlevel.h"
 #include "../Marlin/src/sd/cardreader.h"
 #include "../Marlin/src/libs/nozzle.h"
 #include "../Marlin/src/core/language.h" //GET_TEXT(MSG)
 
+#include "config.h"
 #include "hwio_a3ides.h"
 #include "eeprom.h"
 #include "filament_sensor.h"
+#include "print_journal.h"
+#include "print_estimate.h"
+#include "fan_tacho.h"
+#include "gcode_crc.h"
+#include "ccmram.h"
 
 #ifdef LCDSIM
     #include "lcdsim.h"
@@ -72,9 +81,52 @@ typedef struct _marlin_server_t {
     uint32_t command_begin;                                  // variable for notification
     uint32_t command_end;                                    // variable for notification
     marlin_mesh_t mesh;                                      // meshbed leveling
-    uint64_t mesh_point_notsent[MARLIN_MAX_CLIENTS];         // mesh point mask (points that are not sent)
+    uint8_t mesh_changed;                                    // mesh changed since last MeshUpdate event
+    marlin_host_prompt_t prompt;                             // current host prompt (copy of last HostPrompt event)
+    uint8_t reheating;                                       // reheating in progress (copy of last Reheat event)
 } marlin_server_t;
 
+#ifdef PRINT_JOURNAL
+
+    #define JOURNAL_FIFO_SIZE 32 // number of tracked positions waiting for planner, power of 2
+
+enum {
+    JOURNAL_IDLE,     // not printing
+    JOURNAL_JOB,      // print started, job record not written yet
+    JOURNAL_PRINTING, // progress records written
+    JOURNAL_DONE,     // print ended, DONE record not written yet
+    JOURNAL_OFF,      // print can not be journaled (path too long, no xflash)
+};
+
+// file position with machine state at the time the command at that position started
+typedef struct _journal_pos_t {
+    uint32_t sdpos; // file position of first command not processed
+    uint8_t head;   // planner.block_buffer_head, blocks before it belong to preceding commands
+    float pos[4];   // current_position
+    float feedrate; // feedrate_mm_s
+    uint8_t modes;  // JOURNAL_MODE_xxx
+} journal_pos_t;
+
+typedef struct _server_journal_t {
+    uint8_t state;                         // JOURNAL_xxx
+    uint8_t nested;                        // subroutine file opened (M32), tracking suspended
+    uint8_t fifo_r;                        // fifo read index
+    uint8_t fifo_w;                        // fifo write index
+    uint32_t line;                         // file position of next line
+    uint32_t sdpos[BUFSIZE];               // file position of line in each gcode queue slot
+    journal_pos_t fifo[JOURNAL_FIFO_SIZE]; // positions waiting for planner blocks to finish
+    journal_pos_t done;                    // newest position with all preceding blocks finished
+    uint32_t pushed;                       // sdpos of last pushed position
+    uint32_t written;                      // sdpos of last written record
+    uint32_t written_tick;                 // tick of last written record
+    float written_z;                       // z of last written record
+    uint32_t mesh_seq;                     // marlin_server.mesh.seq of last written grid record
+    uint32_t hash;                         // path hash of current print
+    char path[JOURNAL_PATH_LEN];           // path of last opened file
+} server_journal_t;
+
+#endif //PRINT_JOURNAL
+
 #pragma pack(pop)
 
 PromptReason host_prompt_reason = PROMPT_NOT_DEFINED;
@@ -87,8 +139,6 @@ extern IWDG_HandleTypeDef hiwdg; //watchdog handle
 
 //-----------------------------------------------------------------------------
 // variables
-extern uint32_t Tacho_FAN0;
-extern uint32_t Tacho_FAN1;
 
 osThreadId marlin_server_task = 0;    // task handle
 osMessageQId marlin_server_queue = 0; // input queue (uint8_t)
@@ -100,32 +150,27 @@ uint32_t *pCommand = &marlin_server.command;
 #endif
 marlin_server_idle_t *marlin_server_idle_cb = 0; // idle callback
 
+#ifdef PRINT_JOURNAL
+static server_journal_t server_journal CCMRAM_BSS; // power-loss journal tracking
+#endif                                              //PRINT_JOURNAL
+
+static uint8_t server_fan_blocked = 0; // reported blocked fans (bit mask)
+
 //==========MSG_STACK===================
 //	top of the stack is at [0]
 
-msg_stack_t msg_stack = { '\0', 0 };
+msg_stack_t msg_stack = { '\0', 0, 0 };
 
 void _add_status_msg(const char *const popup_msg) {
-    char message[MSG_MAX_LENGTH];
-    size_t str_size = strlen(popup_msg);
-    if (str_size >= MSG_MAX_LENGTH - 1) {
-        strncpy(message, popup_msg, MSG_MAX_LENGTH - 1); // popup_msg is not always null-terminated...
-        message[MSG_MAX_LENGTH - 1] = '\0';
-    } else {
-        strncpy(message, popup_msg, str_size);
-        message[str_size] = '\0';
-    }
-
-    for (uint8_t i = msg_stack.count; i; i--) {
-        if (i == MSG_STACK_SIZE)
-            i--; // last place of the limited stack will be always overwritten
-        strncpy(msg_stack.msg_data[i], msg_stack.msg_data[i - 1], MSG_MAX_LENGTH);
-    }
-
-    strncpy(msg_stack.msg_data[0], message, MSG_MAX_LENGTH);
-
+    osSemaphoreWait(marlin_server_sema, osWaitForever);
+    // shift whole stack by one message, last place of the limited stack will be always overwritten
+    memmove(msg_stack.msg_data[1], msg_stack.msg_data[0], (MSG_STACK_SIZE - 1) * MSG_MAX_LENGTH);
+    strncpy(msg_stack.msg_data[0], popup_msg, MSG_MAX_LENGTH - 1); // popup_msg is not always null-terminated...
+    msg_stack.msg_data[0][MSG_MAX_LENGTH - 1] = '\0';
     if (msg_stack.count < MSG_STACK_SIZE)
         msg_stack.count++;
+    msg_stack.seq++;
+    osSemaphoreRelease(marlin_server_sema);
 }
 
 // host_actions vars
@@ -151,6 +196,7 @@ int _send_notify_change_to_client(osMessageQId queue, uint8_t var_id, variant8_t
 uint64_t _send_notify_changes_to_client(int client_id, osMessageQId queue, uint64_t var_msk);
 void _server_update_gqueue(void);
 void _server_update_pqueue(void);
+void _server_update_journal(void);
 uint64_t _server_update_vars(uint64_t force_update_msk);
 int _process_server_request(char *request);
 int _server_set_var(char *name_val_str);
@@ -168,34 +214,47 @@ void marlin_server_init(void) {
     marlin_server.notify_events = MARLIN_EVT_MSK_DEF;
     marlin_server.notify_changes = MARLIN_VAR_MSK_DEF;
     marlin_server_task = osThreadGetId();
+#ifdef GRID_MAX_POINTS_X
+    static_assert(GRID_MAX_POINTS_X * GRID_MAX_POINTS_Y <= MARLIN_MAX_MESH_POINTS, "MARLIN_MAX_MESH_POINTS too small for ABL grid");
+    marlin_server.mesh.xc = GRID_MAX_POINTS_X;
+    marlin_server.mesh.yc = GRID_MAX_POINTS_Y;
+#else
     marlin_server.mesh.xc = 4;
     marlin_server.mesh.yc = 4;
+#endif
 }
 
-void print_fan_spd() {
-    if (DEBUGGING(INFO)) {
-        static int time = 0;
-        static int last_prt = 0;
-        time = HAL_GetTick();
-        int timediff = time - last_prt;
-        if (timediff >= 1000) {
-
-            serial_echopair_PGM("Tacho_FAN0 ", (30 * 1000 * Tacho_FAN0) / timediff); //60s / 2 pulses per rotation
-            serialprintPGM("rpm ");
-            SERIAL_EOL();
-            serial_echopair_PGM("Tacho_FAN1 ", (30 * 1000 * Tacho_FAN1) / timediff);
-            serialprintPGM("rpm ");
-            SERIAL_EOL();
-            Tacho_FAN0 = 0;
-            Tacho_FAN1 = 0;
-            last_prt = time;
+// fan speed debug output and blocked fan detection
+void _server_update_fans(void) {
+    static const char *const fan_blocked_msg[FAN_TACHO_CNT] = { "Hotend fan blocked", "Print fan blocked" };
+    static uint32_t last_prt = 0;
+    const uint32_t tick = HAL_GetTick();
+    if (DEBUGGING(INFO) && ((tick - last_prt) >= 1000)) {
+        serial_echopair_PGM("Tacho_FAN0 ", fan_tacho_get_rpm(0));
+        serialprintPGM("rpm ");
+        SERIAL_EOL();
+        serial_echopair_PGM("Tacho_FAN1 ", fan_tacho_get_rpm(1));
+        serialprintPGM("rpm ");
+        SERIAL_EOL();
+        last_prt = tick;
+    }
+    for (uint8_t fan = 0; fan < FAN_TACHO_CNT; fan++) {
+        const uint8_t msk = 1 << fan;
+        if (!fan_tacho_is_blocked(fan))
+            server_fan_blocked &= ~msk;
+        else if (!(server_fan_blocked & msk)) {
+            server_fan_blocked |= msk; // reported once, again after the fan runs or is switched off
+            SERIAL_ECHO_START();
+            SERIAL_ECHOLN(fan_blocked_msg[fan]);
+            _add_status_msg(fan_blocked_msg[fan]);
+            _send_notify_event(MARLIN_EVT_Message, 0, 0);
         }
     }
 }
 
 int marlin_server_cycle(void) {
 
-    print_fan_spd();
+    _server_update_fans();
 
     int count = 0;
     int client_id;
@@ -241,11 +300,21 @@ int marlin_server_cycle(void) {
     _server_update_gqueue();
     // update pqueue (planner queue)
     _server_update_pqueue();
+    // track committed file position, write power-loss journal
+    _server_update_journal();
     // update variables
     tick = HAL_GetTick();
     if ((tick - marlin_server.last_update) > MARLIN_UPDATE_PERIOD) {
         marlin_server.last_update = tick;
+        osSemaphoreWait(marlin_server_sema, osWaitForever); // consistent with marlin_server_get_snapshot
         changes = _server_update_vars(marlin_server.notify_changes);
+        osSemaphoreRelease(marlin_server_sema);
+    }
+    // mesh points changed in this cycle are announced with single event
+    if (marlin_server.mesh_changed) {
+        marlin_server.mesh_changed = 0;
+        marlin_server.mesh.seq++;
+        _send_notify_event(MARLIN_EVT_MeshUpdate, marlin_server.mesh.seq, marlin_server.mesh.xc | ((uint16_t)marlin_server.mesh.yc << 8));
     }
     // send notifications
     for (client_id = 0; client_id < MARLIN_MAX_CLIENTS; client_id++)
@@ -337,7 +406,9 @@ marlin_vars_t *marlin_server_vars(void) {
 void marlin_server_update(uint64_t update) {
     int client_id;
     osMessageQId queue;
+    osSemaphoreWait(marlin_server_sema, osWaitForever);
     _server_update_vars(update);
+    osSemaphoreRelease(marlin_server_sema);
     for (client_id = 0; client_id < MARLIN_MAX_CLIENTS; client_id++)
         if ((queue = marlin_client_queue[client_id]) != 0)
             marlin_server.client_changes[client_id] &= ~_send_notify_changes_to_client(client_id, queue, update);
@@ -405,6 +476,42 @@ void marlin_server_park_head(void) {
     }
 }
 
+int marlin_server_get_snapshot(marlin_snapshot_t *snap) {
+    if ((snap->version != MARLIN_SNAPSHOT_VERSION) || (snap->size != sizeof(marlin_snapshot_t)))
+        return 0;
+    osSemaphoreWait(marlin_server_sema, osWaitForever);
+    if (snap->parts & MARLIN_SNAPSHOT_VARS)
+        memcpy(&snap->vars, &marlin_server.vars, sizeof(marlin_vars_t));
+    if (snap->parts & MARLIN_SNAPSHOT_PROMPT) {
+        memcpy(&snap->prompt, &marlin_server.prompt, sizeof(marlin_host_prompt_t));
+        snap->reheating = marlin_server.reheating;
+    }
+    if (snap->parts & MARLIN_SNAPSHOT_MSG)
+        memcpy(&snap->msg, &msg_stack, sizeof(msg_stack_t));
+    if (snap->parts & MARLIN_SNAPSHOT_MESH) { // only valid part of z array
+        snap->mesh.xc = marlin_server.mesh.xc;
+        snap->mesh.yc = marlin_server.mesh.yc;
+        snap->mesh.seq = marlin_server.mesh.seq;
+        memcpy(snap->mesh.z, marlin_server.mesh.z, marlin_server.mesh.xc * marlin_server.mesh.yc * sizeof(float));
+    }
+    osSemaphoreRelease(marlin_server_sema);
+    return 1;
+}
+
+void marlin_server_get_snapshot_vars(marlin_vars_t *vars) {
+    osSemaphoreWait(marlin_server_sema, osWaitForever);
+    memcpy(vars, &marlin_server.vars, sizeof(marlin_vars_t));
+    osSemaphoreRelease(marlin_server_sema);
+}
+
+uint16_t marlin_server_get_message(char *msg) {
+    osSemaphoreWait(marlin_server_sema, osWaitForever);
+    memcpy(msg, msg_stack.msg_data[0], MSG_MAX_LENGTH);
+    const uint16_t seq = msg_stack.seq;
+    osSemaphoreRelease(marlin_server_sema);
+    return seq;
+}
+
 int marlin_all_axes_homed(void) {
     return all_axes_homed() ? 1 : 0;
 }
@@ -485,26 +592,10 @@ uint64_t _send_notify_events_to_client(int client_id, osMessageQId queue, uint64
                 break;
             //case MARLIN_EVT_PlayTone:
             //case MARLIN_EVT_UserConfirmRequired:
+            // MeshUpdate - ui32 is snapshot sequence number, ui16 is grid size
             case MARLIN_EVT_MeshUpdate:
-                if (marlin_server.mesh_point_notsent[client_id]) {
-                    uint8_t x;
-                    uint8_t y;
-                    uint64_t mask = 1;
-                    for (y = 0; y < marlin_server.mesh.yc; y++)
-                        for (x = 0; x < marlin_server.mesh.xc; x++) {
-                            if (mask & marlin_server.mesh_point_notsent[client_id]) {
-                                uint8_t index = x + marlin_server.mesh.xc * y;
-                                float z = marlin_server.mesh.z[index];
-                                uint32_t usr32 = variant8_flt(z).ui32;
-                                uint16_t usr16 = x | ((uint16_t)y << 8);
-                                if (_send_notify_event_to_client(client_id, queue, evt_id, usr32, usr16))
-                                    marlin_server.mesh_point_notsent[client_id] &= ~mask;
-                            }
-                            mask <<= 1;
-                        }
-                    if (marlin_server.mesh_point_notsent[client_id] == 0)
-                        sent |= msk; // event sent, set bit
-                }
+                if (_send_notify_event_to_client(client_id, queue, evt_id, marlin_server.mesh.seq, marlin_server.mesh.xc | ((uint16_t)marlin_server.mesh.yc << 8)))
+                    sent |= msk; // event sent, set bit
                 break;
             case MARLIN_EVT_Acknowledge:
                 if (_send_notify_event_to_client(client_id, queue, evt_id, 0, 0))
@@ -525,13 +616,6 @@ uint8_t _send_notify_event(uint8_t evt_id, uint32_t usr32, uint16_t usr16) {
     for (int client_id = 0; client_id < MARLIN_MAX_CLIENTS; client_id++)
         if (_send_notify_event_to_client(client_id, marlin_client_queue[client_id], evt_id, usr32, usr16) == 0) {
             marlin_server.client_events[client_id] |= ((uint64_t)1 << evt_id); // event not sent, set bit
-            if (evt_id == MARLIN_EVT_MeshUpdate) {
-                uint8_t x = usr16 & 0xff;                      // x index
-                uint8_t y = usr16 >> 8;                        // y index
-                uint8_t index = x + marlin_server.mesh.xc * y; // index
-                uint64_t mask = ((uint64_t)1 << index);        // mask
-                marlin_server.mesh_point_notsent[client_id] |= mask;
-            }
         } else
             client_msk |= (1 << client_id);
     return client_msk;
@@ -576,6 +660,201 @@ void _server_update_pqueue(void) {
     }
 }
 
+#ifdef PRINT_JOURNAL
+
+// push position of command being processed, pop positions with all preceding planner blocks finished
+static void _server_journal_track(void) {
+    server_journal_t *j = &server_journal;
+    const uint32_t sdpos = queue.length ? j->sdpos[queue.index_r] : j->line;
+    // when fifo is full the position is pushed later (older resume point is always safe)
+    if ((sdpos != j->pushed) && (((j->fifo_w - j->fifo_r) & 0xff) < JOURNAL_FIFO_SIZE)) {
+        journal_pos_t *p = &j->fifo[j->fifo_w++ & (JOURNAL_FIFO_SIZE - 1)];
+        p->sdpos = sdpos;
+        p->head = planner.block_buffer_head;
+        for (int i = 0; i < XYZE; i++)
+            p->pos[i] = current_position[i];
+        p->feedrate = feedrate_mm_s;
+        p->modes = (relative_mode ? JOURNAL_MODE_REL_XYZ : 0)
+            | (GcodeSuite::axis_relative_modes[E_AXIS] ? JOURNAL_MODE_REL_E : 0)
+            | (planner.leveling_active ? JOURNAL_MODE_LEVELING : 0);
+        j->pushed = sdpos;
+    }
+    const uint8_t queued = (planner.block_buffer_head - planner.block_buffer_tail) & (BLOCK_BUFFER_SIZE - 1);
+    while (j->fifo_r != j->fifo_w) {
+        journal_pos_t *p = &j->fifo[j->fifo_r & (JOURNAL_FIFO_SIZE - 1)];
+        if (queued > ((planner.block_buffer_head - p->head) & (BLOCK_BUFFER_SIZE - 1)))
+            break; // blocks before p->head are not finished yet
+        j->done = *p;
+        j->fifo_r++;
+    }
+}
+
+static void _server_journal_fill(journal_rec_t *rec, uint8_t state) {
+    server_journal_t *j = &server_journal;
+    rec->path_hash = j->hash;
+    rec->sdpos = j->done.sdpos;
+    memcpy(rec->pos, j->done.pos, sizeof(rec->pos));
+    rec->feedrate = j->done.feedrate;
+    rec->temp_nozzle = thermalManager.temp_hotend[0].target;
+    rec->temp_bed = thermalManager.temp_bed.target;
+    rec->print_speed = (uint16_t)feedrate_percentage;
+    rec->flow_factor = (uint16_t)planner.flow_percentage[0];
+    rec->fan_speed = thermalManager.fan_speed[0];
+    rec->state = state;
+    rec->modes = j->done.modes;
+}
+
+// bed leveling grid in use, written once leveling is active (grid probed by G29 in start gcode)
+static int _server_journal_write_mesh(void) {
+    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+    static journal_mesh_t mesh; // 1kb, not on marlin stack
+    mesh.start[0] = bilinear_start.x;
+    mesh.start[1] = bilinear_start.y;
+    mesh.spacing[0] = bilinear_grid_spacing.x;
+    mesh.spacing[1] = bilinear_grid_spacing.y;
+    mesh.xc = GRID_MAX_POINTS_X;
+    mesh.yc = GRID_MAX_POINTS_Y;
+    for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+        for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+            mesh.z[x + GRID_MAX_POINTS_X * y] = z_values[x][y];
+    return journal_write_mesh(&mesh);
+    #else
+    return 1;
+    #endif
+}
+
+int marlin_server_journal_restore_mesh(void) {
+    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+    static journal_mesh_t mesh; // 1kb, not on marlin stack
+    if (!journal_get_resume_mesh(&mesh) || (mesh.xc != GRID_MAX_POINTS_X) || (mesh.yc != GRID_MAX_POINTS_Y))
+        return 0;
+    set_bed_leveling_enabled(false);
+    bilinear_start.set(mesh.start[0], mesh.start[1]);
+    bilinear_grid_spacing.set(mesh.spacing[0], mesh.spacing[1]);
+    osSemaphoreWait(marlin_server_sema, osWaitForever);
+    for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+        for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+            marlin_server.mesh.z[x + GRID_MAX_POINTS_X * y] = z_values[x][y] = mesh.z[x + GRID_MAX_POINTS_X * y];
+    osSemaphoreRelease(marlin_server_sema);
+    marlin_server.mesh_changed = 1; // event is sent from marlin_server_cycle
+    refresh_bed_level();
+    return 1;
+    #else
+    return 0;
+    #endif
+}
+
+// write journal records, every flash operation is non-blocking (skipped while xflash is busy)
+void _server_update_journal(void) {
+    server_journal_t *j = &server_journal;
+    journal_rec_t rec;
+    int ret;
+    const uint32_t tick = HAL_GetTick();
+    const bool printing = card.isFileOpen() && (print_job_timer.isRunning() || print_job_timer.isPaused());
+    journal_cycle();
+    switch (j->state) {
+    case JOURNAL_IDLE:
+        if (printing && j->path[0] && !j->nested) {
+            j->fifo_r = j->fifo_w = 0;
+            j->pushed = j->written = j->done.sdpos = 0xffffffff;
+            j->mesh_seq = marlin_server.mesh.seq - 1; // grid in use is written with the job
+            j->hash = journal_path_hash(j->path);
+            j->state = JOURNAL_JOB;
+        }
+        break;
+    case JOURNAL_JOB:
+        if (!printing)
+            j->state = JOURNAL_IDLE;
+        else if ((ret = journal_write_job(j->path)) > 0) {
+            j->written_tick = tick;
+            j->state = JOURNAL_PRINTING;
+        } else if (ret < 0)
+            j->state = JOURNAL_OFF;
+        break;
+    case JOURNAL_PRINTING:
+        if (!printing) {
+            j->state = JOURNAL_DONE;
+            break;
+        }
+        if (j->nested)
+            break;
+        if (planner.leveling_active && (j->mesh_seq != marlin_server.mesh.seq) && (_server_journal_write_mesh() != 0))
+            j->mesh_seq = marlin_server.mesh.seq;
+        _server_journal_track();
+        if ((j->done.sdpos == 0xffffffff) || (j->done.sdpos == j->written))
+            break;
+        if ((tick - j->written_tick) < PRINT_JOURNAL_PERIOD_MIN)
+            break;
+        if (((tick - j->written_tick) < PRINT_JOURNAL_PERIOD) && (j->done.pos[Z_AXIS] == j->written_z))
+            break; // no layer change
+        _server_journal_fill(&rec, JOURNAL_STATE_PRINTING);
+        if (journal_write_rec(&rec) > 0) {
+            j->written = j->done.sdpos;
+            j->written_tick = tick;
+            j->written_z = j->done.pos[Z_AXIS];
+        }
+        break;
+    case JOURNAL_DONE:
+        _server_journal_fill(&rec, JOURNAL_STATE_DONE);
+        if (journal_write_rec(&rec) != 0)
+            j->state = JOURNAL_IDLE;
+        break;
+    case JOURNAL_OFF:
+        if (!printing)
+            j->state = JOURNAL_IDLE;
+        break;
+    }
+}
+
+#else //PRINT_JOURNAL
+
+void _server_update_journal(void) {
+}
+
+int marlin_server_journal_restore_mesh(void) {
+    return 0;
+}
+
+#endif //PRINT_JOURNAL
+
+void marlin_server_sd_open(const char *path) {
+#ifdef PRINT_ESTIMATE
+    if (path)
+        estimate_start(path);
+#endif //PRINT_ESTIMATE
+#ifdef PRINT_JOURNAL
+    server_journal.line = 0;
+    if ((server_journal.nested = (path == 0)))
+        return;
+    if (strlen(path) < JOURNAL_PATH_LEN)
+        strcpy(server_journal.path, path);
+    else
+        server_journal.path[0] = 0; // can not be journaled
+#endif //PRINT_JOURNAL
+}
+
+void marlin_server_sd_seek(uint32_t pos) {
+#ifdef PRINT_JOURNAL
+    server_journal.line = pos;
+#endif //PRINT_JOURNAL
+}
+
+// line ending at pos is committed to gcode queue slot at write index (when it is not empty or comment)
+void marlin_server_sd_eol(uint32_t pos) {
+#ifdef PRINT_JOURNAL
+    server_journal.sdpos[(queue.index_r + queue.length) % BUFSIZE] = server_journal.line;
+    server_journal.line = pos;
+#endif //PRINT_JOURNAL
+}
+
+void marlin_server_sd_corrupt(void) {
+#ifdef GCODE_CRC
+    SERIAL_ERROR_MSG(GCODE_CRC_MSG_MISMATCH);
+    _add_status_msg(GCODE_CRC_MSG_MISMATCH);
+    _send_notify_event(MARLIN_EVT_Message, 0, 0);
+#endif //GCODE_CRC
+}
+
 // update server variables defined by 'update', returns changed variables mask (called from server thread)
 uint64_t _server_update_vars(uint64_t update) {
     int i;
@@ -738,6 +1017,24 @@ uint64_t _server_update_vars(uint64_t update) {
             changes |= MARLIN_VAR_MSK(MARLIN_VAR_DURATION);
         }
     }
+
+    if (update & MARLIN_VAR_MSK(MARLIN_VAR_SD_POS)) {
+        v.ui32 = card.getIndex();
+        if (marlin_server.vars.sd_pos != v.ui32) {
+            marlin_server.vars.sd_pos = v.ui32;
+            changes |= MARLIN_VAR_MSK(MARLIN_VAR_SD_POS);
+        }
+    }
+
+    for (i = 0; i < FAN_TACHO_CNT; i++)
+        if (update & MARLIN_VAR_MSK(MARLIN_VAR_FAN0_RPM + i)) {
+            v.ui16 = fan_tacho_get_rpm(i);
+            // hysteresis, rpm of running fan jitters
+            if (((v.ui16 == 0) != (marlin_server.vars.fan_rpm[i] == 0)) || (abs((int)v.ui16 - (int)marlin_server.vars.fan_rpm[i]) >= FAN_TACHO_RPM_HYST)) {
+                marlin_server.vars.fan_rpm[i] = v.ui16;
+                changes |= MARLIN_VAR_MSK(MARLIN_VAR_FAN0_RPM + i);
+            }
+        }
     return changes;
 }
 
@@ -796,6 +1093,9 @@ int _process_server_request(char *request) {
     } else if (strcmp("!park", request) == 0) {
         marlin_server_park_head();
         processed = 1;
+    } else if (strcmp("!jmesh", request) == 0) {
+        marlin_server_journal_restore_mesh();
+        processed = 1;
     } else if (sscanf(request, "!hclick %d", &ival) == 1) {
         host_prompt_button_clicked = (host_prompt_button_t)ival;
         processed = 1;
@@ -811,7 +1111,10 @@ int _server_set_var(char *name_val_str) {
     char *val_str = strchr(name_val_str, ' ');
     *(val_str++) = 0;
     if ((var_id = marlin_vars_get_id_by_name(name_val_str)) >= 0) {
-        if (marlin_vars_str_to_value(&(marlin_server.vars), var_id, val_str) == 1) {
+        osSemaphoreWait(marlin_server_sema, osWaitForever); // consistent with marlin_server_get_snapshot
+        const int ret = marlin_vars_str_to_value(&(marlin_server.vars), var_id, val_str);
+        osSemaphoreRelease(marlin_server_sema);
+        if (ret == 1) {
             switch (var_id) {
             case MARLIN_VAR_TTEM_NOZ:
                 thermalManager.setTargetHotend(marlin_server.vars.target_nozzle, 0);
@@ -1039,11 +1342,12 @@ void onConfigurationStoreRead(bool success) {
 
 void onMeshUpdate(const uint8_t xpos, const uint8_t ypos, const float zval) {
     DBG_XUI("XUI: onMeshUpdate x: %u, y: %u, z: %.2f", xpos, ypos, (double)zval);
-    uint8_t index = xpos + marlin_server.mesh.xc * ypos;
-    uint32_t usr32 = variant8_flt(zval).ui32;
-    uint16_t usr16 = xpos | ((uint16_t)ypos << 8);
-    marlin_server.mesh.z[index] = zval;
-    _send_notify_event(MARLIN_EVT_MeshUpdate, usr32, usr16);
+    if ((xpos >= marlin_server.mesh.xc) || (ypos >= marlin_server.mesh.yc))
+        return;
+    osSemaphoreWait(marlin_server_sema, osWaitForever);
+    marlin_server.mesh.z[xpos + marlin_server.mesh.xc * ypos] = zval;
+    osSemaphoreRelease(marlin_server_sema);
+    marlin_server.mesh_changed = 1; // event is sent from marlin_server_cycle
 }
 
 }
@@ -1167,6 +1471,9 @@ void host_action_prompt_show() {
     };
     int paused = 0;
     uint32_t ui32 = marlin_host_prompt_encode(&prompt);
+    osSemaphoreWait(marlin_server_sema, osWaitForever);
+    marlin_server.prompt = prompt;
+    osSemaphoreRelease(marlin_server_sema);
     _send_notify_event(MARLIN_EVT_HostPrompt, ui32, 0);
     switch (prompt.type) {
     case HOST_PROMPT_Paused:
@@ -1204,6 +1511,9 @@ void host_action_prompt_show() {
     }
     *host_prompt = 0;
     host_prompt_buttons = 0;
+    osSemaphoreWait(marlin_server_sema, osWaitForever);
+    memset(&marlin_server.prompt, 0, sizeof(marlin_host_prompt_t));
+    osSemaphoreRelease(marlin_server_sema);
 }
 
 void host_prompt_do(const PromptReason type, const char *const pstr, const char *const pbtn) {
@@ -1212,12 +1522,18 @@ void host_prompt_do(const PromptReason type, const char *const pstr, const char
     switch (type) {
     case PROMPT_INFO:
         if (strcmp(pstr, "Reheating") == 0) {
+            osSemaphoreWait(marlin_server_sema, osWaitForever);
+            marlin_server.reheating = 1;
+            osSemaphoreRelease(marlin_server_sema);
             _send_notify_event(MARLIN_EVT_Reheat, 1, 0);
         }
         break;
     case PROMPT_USER_CONTINUE:
         //gui must call marlin_print_resume();
         if (strcmp(pstr, "Reheat Done") == 0) {
+            osSemaphoreWait(marlin_server_sema, osWaitForever);
+            marlin_server.reheating = 0;
+            osSemaphoreRelease(marlin_server_sema);
             _send_notify_event(MARLIN_EVT_Reheat, 0, 0);
         }
         break;
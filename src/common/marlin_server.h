@@ -27,9 +27,31 @@ typedef struct msg_stack {
 
     char msg_data[MSG_STACK_SIZE][MSG_MAX_LENGTH];
     uint8_t count;
+    uint16_t seq; // incremented with every new message
 
 } msg_stack_t;
 
+#define MARLIN_SNAPSHOT_VERSION 1
+
+// snapshot parts
+#define MARLIN_SNAPSHOT_VARS   0x01 // server cached variables (MARLIN_VAR_MSK_DEF updated every MARLIN_UPDATE_PERIOD)
+#define MARLIN_SNAPSHOT_PROMPT 0x02 // host prompt and reheating state
+#define MARLIN_SNAPSHOT_MSG    0x04 // status message stack
+#define MARLIN_SNAPSHOT_MESH   0x08 // bed mesh (only xc * yc points are copied)
+#define MARLIN_SNAPSHOT_ALL    0x0f
+
+// consistent copy of server state, filled by marlin_server_get_snapshot
+typedef struct _marlin_snapshot_t {
+    uint16_t version;            // MARLIN_SNAPSHOT_VERSION (set by caller)
+    uint16_t size;               // sizeof(marlin_snapshot_t) (set by caller)
+    uint8_t parts;               // requested parts MARLIN_SNAPSHOT_xxx (set by caller)
+    uint8_t reheating;           // reheating in progress
+    marlin_host_prompt_t prompt; // current host prompt
+    marlin_vars_t vars;          // variables
+    msg_stack_t msg;             // status messages
+    marlin_mesh_t mesh;          // bed mesh
+} marlin_snapshot_t;
+
 #pragma pack(pop)
 
 #ifdef __cplusplus
@@ -95,6 +117,28 @@ extern void marlin_server_print_resume(void);
 //
 extern void marlin_server_park_head(void);
 
+// restore bed leveling grid of interrupted print from power-loss journal, returns 1 when restored
+extern int marlin_server_journal_restore_mesh(void);
+
+// copy requested parts of server state under single lock (thread safe), returns 0 on version/size mismatch
+extern int marlin_server_get_snapshot(marlin_snapshot_t *snap);
+
+// copy server variables under lock (thread safe), same as MARLIN_SNAPSHOT_VARS part of snapshot
+extern void marlin_server_get_snapshot_vars(marlin_vars_t *vars);
+
+// copy newest status message under lock (thread safe), msg has MSG_MAX_LENGTH chars, returns message sequence number
+extern uint16_t marlin_server_get_message(char *msg);
+
+// power-loss journal file tracking, called from CardReader (path = 0 for subroutine call/return)
+extern void marlin_server_sd_open(const char *path);
+
+extern void marlin_server_sd_seek(uint32_t pos);
+
+extern void marlin_server_sd_eol(uint32_t pos);
+
+// print file does not match its checksum (gcode_crc), called from CardReader
+extern void marlin_server_sd_corrupt(void);
+
 //
 extern int marlin_all_axes_homed(void);
 
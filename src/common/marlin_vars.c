@@ -30,7 +30,9 @@ const char *__var_name[] = {
     "SD_PRINT",
     "SD_PDONE",
     "DURATION",
-    "FSENSOR",
+    "SD_POS",
+    "FAN0_RPM",
+    "FAN1_RPM",
 };
 
 const char *marlin_vars_get_name(uint8_t var_id) {
@@ -98,6 +100,12 @@ variant8_t marlin_vars_get_var(marlin_vars_t *vars, uint8_t var_id) {
             return variant8_ui8(vars->sd_percent_done);
         case MARLIN_VAR_DURATION:
             return variant8_ui32(vars->print_duration);
+        case MARLIN_VAR_SD_POS:
+            return variant8_ui32(vars->sd_pos);
+        case MARLIN_VAR_FAN0_RPM:
+            return variant8_ui16(vars->fan_rpm[0]);
+        case MARLIN_VAR_FAN1_RPM:
+            return variant8_ui16(vars->fan_rpm[1]);
         }
     return variant8_empty();
 }
@@ -177,6 +185,15 @@ void marlin_vars_set_var(marlin_vars_t *vars, uint8_t var_id, variant8_t var) {
         case MARLIN_VAR_DURATION:
             vars->print_duration = var.ui32;
             break;
+        case MARLIN_VAR_SD_POS:
+            vars->sd_pos = var.ui32;
+            break;
+        case MARLIN_VAR_FAN0_RPM:
+            vars->fan_rpm[0] = var.ui16;
+            break;
+        case MARLIN_VAR_FAN1_RPM:
+            vars->fan_rpm[1] = var.ui16;
+            break;
         }
 }
 
@@ -243,6 +260,15 @@ void marlin_vars_value_to_str(marlin_vars_t *vars, uint8_t var_id, char *str) {
         case MARLIN_VAR_DURATION:
             sprintf(str, "%lu", (long unsigned int)(vars->print_duration));
             break;
+        case MARLIN_VAR_SD_POS:
+            sprintf(str, "%lu", (long unsigned int)(vars->sd_pos));
+            break;
+        case MARLIN_VAR_FAN0_RPM:
+            sprintf(str, "%u", (unsigned int)(vars->fan_rpm[0]));
+            break;
+        case MARLIN_VAR_FAN1_RPM:
+            sprintf(str, "%u", (unsigned int)(vars->fan_rpm[1]));
+            break;
         default:
             sprintf(str, "???");
         }
@@ -312,6 +338,15 @@ int marlin_vars_str_to_value(marlin_vars_t *vars, uint8_t var_id, const char *st
         case MARLIN_VAR_DURATION:
             ret = sscanf(str, "%lu", &(vars->print_duration));
             break;
+        case MARLIN_VAR_SD_POS:
+            ret = sscanf(str, "%lu", &(vars->sd_pos));
+            break;
+        case MARLIN_VAR_FAN0_RPM:
+            ret = sscanf(str, "%hu", (unsigned short *)&(vars->fan_rpm[0]));
+            break;
+        case MARLIN_VAR_FAN1_RPM:
+            ret = sscanf(str, "%hu", (unsigned short *)&(vars->fan_rpm[1]));
+            break;
         }
     return ret;
 }
@@ -29,7 +29,10 @@
 #define MARLIN_VAR_SD_PRINT 0x15 // R:  uint8, card.flag.sdprinting
 #define MARLIN_VAR_SD_PDONE 0x16 // R:  uint8, card.percentDone()
 #define MARLIN_VAR_DURATION 0x17 // R:  uint32, print_job_timer.duration()
-#define MARLIN_VAR_MAX      MARLIN_VAR_DURATION
+#define MARLIN_VAR_SD_POS   0x18 // R:  uint32, card.getIndex()
+#define MARLIN_VAR_FAN0_RPM 0x19 // R:  uint16, fan_tacho_get_rpm(0) - hotend fan
+#define MARLIN_VAR_FAN1_RPM 0x1a // R:  uint16, fan_tacho_get_rpm(1) - print fan
+#define MARLIN_VAR_MAX      MARLIN_VAR_FAN1_RPM
 
 // variable masks
 #define MARLIN_VAR_MSK(v_id) ((uint64_t)1 << (v_id))
@@ -49,11 +52,14 @@
 #define MARLIN_VAR_MSK_TEMP_ALL ( \
     MARLIN_VAR_MSK(MARLIN_VAR_TEMP_NOZ) | MARLIN_VAR_MSK(MARLIN_VAR_TEMP_BED) | MARLIN_VAR_MSK(MARLIN_VAR_TTEM_NOZ) | MARLIN_VAR_MSK(MARLIN_VAR_TTEM_BED))
 
+#define MARLIN_VAR_MSK_FAN_RPM ( \
+    MARLIN_VAR_MSK(MARLIN_VAR_FAN0_RPM) | MARLIN_VAR_MSK(MARLIN_VAR_FAN1_RPM))
+
 #define MARLIN_VAR_MSK_DEF ( \
-    MARLIN_VAR_MSK(MARLIN_VAR_MOTION) | MARLIN_VAR_MSK(MARLIN_VAR_GQUEUE) | MARLIN_VAR_MSK_POS_XYZE | MARLIN_VAR_MSK_TEMP_ALL | MARLIN_VAR_MSK(MARLIN_VAR_SD_PRINT) | MARLIN_VAR_MSK(MARLIN_VAR_SD_PDONE) | MARLIN_VAR_MSK(MARLIN_VAR_DURATION))
+    MARLIN_VAR_MSK(MARLIN_VAR_MOTION) | MARLIN_VAR_MSK(MARLIN_VAR_GQUEUE) | MARLIN_VAR_MSK_POS_XYZE | MARLIN_VAR_MSK_TEMP_ALL | MARLIN_VAR_MSK(MARLIN_VAR_SD_PRINT) | MARLIN_VAR_MSK(MARLIN_VAR_SD_PDONE) | MARLIN_VAR_MSK(MARLIN_VAR_DURATION) | MARLIN_VAR_MSK_FAN_RPM)
 
 #define MARLIN_VAR_MSK_ALL ( \
-    MARLIN_VAR_MSK(MARLIN_VAR_MOTION) | MARLIN_VAR_MSK(MARLIN_VAR_GQUEUE) | MARLIN_VAR_MSK(MARLIN_VAR_PQUEUE) | MARLIN_VAR_MSK_IPOS_XYZE | MARLIN_VAR_MSK_POS_XYZE | MARLIN_VAR_MSK_TEMP_ALL | MARLIN_VAR_MSK(MARLIN_VAR_Z_OFFSET) | MARLIN_VAR_MSK(MARLIN_VAR_FANSPEED) | MARLIN_VAR_MSK(MARLIN_VAR_PRNSPEED) | MARLIN_VAR_MSK(MARLIN_VAR_FLOWFACT) | MARLIN_VAR_MSK(MARLIN_VAR_WAITHEAT) | MARLIN_VAR_MSK(MARLIN_VAR_WAITUSER) | MARLIN_VAR_MSK(MARLIN_VAR_SD_PRINT) | MARLIN_VAR_MSK(MARLIN_VAR_SD_PDONE) | MARLIN_VAR_MSK(MARLIN_VAR_DURATION))
+    MARLIN_VAR_MSK(MARLIN_VAR_MOTION) | MARLIN_VAR_MSK(MARLIN_VAR_GQUEUE) | MARLIN_VAR_MSK(MARLIN_VAR_PQUEUE) | MARLIN_VAR_MSK_IPOS_XYZE | MARLIN_VAR_MSK_POS_XYZE | MARLIN_VAR_MSK_TEMP_ALL | MARLIN_VAR_MSK(MARLIN_VAR_Z_OFFSET) | MARLIN_VAR_MSK(MARLIN_VAR_FANSPEED) | MARLIN_VAR_MSK(MARLIN_VAR_PRNSPEED) | MARLIN_VAR_MSK(MARLIN_VAR_FLOWFACT) | MARLIN_VAR_MSK(MARLIN_VAR_WAITHEAT) | MARLIN_VAR_MSK(MARLIN_VAR_WAITUSER) | MARLIN_VAR_MSK(MARLIN_VAR_SD_PRINT) | MARLIN_VAR_MSK(MARLIN_VAR_SD_PDONE) | MARLIN_VAR_MSK(MARLIN_VAR_DURATION) | MARLIN_VAR_MSK(MARLIN_VAR_SD_POS) | MARLIN_VAR_MSK_FAN_RPM)
 
 // usr8 in variant8_t message contains id (bit0..6) and variable/event flag (bit7)
 #define MARLIN_USR8_VAR_FLG 0x80 // usr8 - variable flag (bit7 set)
@@ -93,6 +99,8 @@ typedef struct _marlin_vars_t {
     uint8_t sd_printing;     // card.flag.sdprinting
     uint8_t sd_percent_done; // card.percentDone()
     uint32_t print_duration; // print_job_timer.duration()
+    uint32_t sd_pos;         // card.getIndex()
+    uint16_t fan_rpm[2];     // fan speed (hotend, print) [rpm]
 } marlin_vars_t;
 
 typedef union _marlin_changes_t {
@@ -123,7 +131,10 @@ typedef union _marlin_changes_t {
         uint8_t var_sd_printing : 1;
         uint8_t var_sd_percent_done : 1;
         uint8_t var_print_duration : 1;
-        uint64_t var_reserved : 42;
+        uint8_t var_sd_pos : 1;
+        uint8_t var_fan0_rpm : 1;
+        uint8_t var_fan1_rpm : 1;
+        uint64_t var_reserved : 39;
     };
 } marlin_changes_t;
 
@@ -0,0 +1,545 @@
+// print_estimate.cpp
+
+#include "config.h"
+
+#ifdef PRINT_ESTIMATE
+
+    #include "print_estimate.h"
+    #include "../Marlin/src/module/planner.h"
+    #include "cmsis_os.h"
+    #include "ff.h"
+    #include <string.h>
+    #include <stddef.h>
+    #include <stdlib.h>
+    #include <math.h>
+
+    #define ESTIMATE_PATH_LEN  (_MAX_LFN + 2) // same as screen_printing_file_path
+    #define ESTIMATE_LINE_LEN  96             // longer lines are truncated (parameters beyond are ignored)
+    #define ESTIMATE_BLOCK_LEN 512            // file read block, thread yields after each block
+    #define ESTIMATE_MIN_MOVE  0.0001f        // shorter moves are dropped (same as planner)
+
+// machine limits, copied from planner settings at scan start, then modified by M201/M203/M204/M205 in file
+typedef struct _estimate_params_t {
+    float max_acc[4];      // max. axis acceleration XYZE [mm/s^2]
+    float max_feed[4];     // max. axis feedrate XYZE [mm/s]
+    float jerk[4];         // max. axis jerk XYZE [mm/s] (CLASSIC_JERK)
+    float junction_dev;    // junction deviation [mm] (!CLASSIC_JERK)
+    float acc;             // printing acceleration [mm/s^2]
+    float retract_acc;     // retract acceleration [mm/s^2]
+    float travel_acc;      // travel acceleration [mm/s^2]
+    float min_feed;        // min. printing feedrate [mm/s]
+    float min_travel_feed; // min. travel feedrate [mm/s]
+} estimate_params_t;
+
+// identifies file and machine limits the index was computed for
+typedef struct _estimate_hdr_t {
+    uint32_t path_hash; // hash of gcode file path
+    uint32_t fsize;     // gcode file size
+    uint16_t fdate;     // gcode file modification date (FatFS format)
+    uint16_t ftime;     // gcode file modification time (FatFS format)
+    uint32_t params;    // hash of machine limits used for estimation
+    uint32_t stride;    // bytes per index interval
+    uint32_t total;     // total print time at 100% speed [s] (last, not compared)
+} estimate_hdr_t;
+
+// move waiting in lookahead window
+typedef struct _estimate_move_t {
+    uint32_t sdpos;  // file position after move line
+    float length;    // [mm]
+    float nominal;   // nominal speed [mm/s]
+    float acc;       // acceleration [mm/s^2]
+    float max_entry; // junction speed limit [mm/s]
+} estimate_move_t;
+
+// scan state
+typedef struct _estimate_scan_t {
+    estimate_params_t p;
+    float pos[4];       // parser position XYZE [mm]
+    float feed;         // current feedrate [mm/s]
+    uint8_t relative;   // G91
+    uint8_t relative_e; // M83
+    estimate_move_t moves[PRINT_ESTIMATE_LOOKAHEAD];
+    uint8_t head;        // oldest move in window
+    uint8_t count;       // moves in window
+    float prev_unit[4];  // unit vector of last move
+    float prev_nominal;  // nominal speed of last move, 0 = machine stopped
+    float prev_safe;     // safe speed of last move (CLASSIC_JERK)
+    float entry;         // entry speed of oldest move, <0 = start from rest
+    double time;         // cumulative time of finished moves [s]
+    uint16_t filled;     // index entries filled
+    uint32_t stride;     // bytes per index interval
+    char line[ESTIMATE_LINE_LEN];
+    uint8_t line_len;
+    uint8_t comment;
+} estimate_scan_t;
+
+// index and its header are written by estimator thread only while estimate_ready is 0,
+// estimate_ready is cleared (estimate_start) and read with the index (estimate_remaining) in critical section
+static estimate_scan_t est;
+static estimate_hdr_t estimate_hdr;
+static uint32_t estimate_index[PRINT_ESTIMATE_INDEX + 1]; // cumulative time [s] at i * stride
+static uint8_t estimate_block[ESTIMATE_BLOCK_LEN];
+static FIL estimate_fil;
+static FILINFO estimate_finfo;
+
+static char estimate_path[ESTIMATE_PATH_LEN];      // requested file
+static char estimate_req_path[ESTIMATE_PATH_LEN];  // written by estimate_start
+static volatile uint8_t estimate_request = 0;      // new file requested
+static volatile uint8_t estimate_ready = 0;        // index is valid for requested file
+static uint8_t estimate_cached = 0;                // index is complete for file in estimate_hdr
+
+//-----------------------------------------------------------------------------
+// kinematics
+
+// duration of trapezoid (or triangle) profile with given entry, exit and nominal speed
+static float estimate_trapezoid(const estimate_move_t *m, float entry, float exit) {
+    const float acc2 = 2 * m->acc;
+    const float accel_dist = (m->nominal * m->nominal - entry * entry) / acc2;
+    const float decel_dist = (m->nominal * m->nominal - exit * exit) / acc2;
+    if ((accel_dist + decel_dist) <= m->length)
+        return (m->nominal - entry) / m->acc + (m->nominal - exit) / m->acc + (m->length - accel_dist - decel_dist) / m->nominal;
+    const float peak = sqrtf((acc2 * m->length + entry * entry + exit * exit) / 2);
+    return (2 * peak - entry - exit) / m->acc;
+}
+
+// moves ending before index position are accounted to it
+static void estimate_add_time(uint32_t sdpos, float t) {
+    while ((est.filled <= PRINT_ESTIMATE_INDEX) && (est.filled * est.stride < sdpos))
+        estimate_index[est.filled++] = (uint32_t)est.time;
+    est.time += t;
+}
+
+// plan oldest move in window assuming the machine stops after the newest one (like planner recalculate)
+static void estimate_finish_oldest(void) {
+    const estimate_move_t *m;
+    float v = 0;
+    for (int k = est.count - 1; k > 0; k--) { // backward pass
+        m = &est.moves[(est.head + k) % PRINT_ESTIMATE_LOOKAHEAD];
+        v = fminf(m->max_entry, sqrtf(v * v + 2 * m->acc * m->length));
+    }
+    m = &est.moves[est.head];
+    if (est.entry < 0)
+        est.entry = fminf(m->max_entry, sqrtf(v * v + 2 * m->acc * m->length));
+    const float exit = fminf(v, sqrtf(est.entry * est.entry + 2 * m->acc * m->length)); // forward pass
+    estimate_add_time(m->sdpos, estimate_trapezoid(m, est.entry, exit));
+    est.entry = exit;
+    est.head = (est.head + 1) % PRINT_ESTIMATE_LOOKAHEAD;
+    est.count--;
+}
+
+// wait for moves to finish (G4, M400, heating...)
+static void estimate_sync(void) {
+    while (est.count)
+        estimate_finish_oldest();
+    est.entry = -1;
+    est.prev_nominal = 0;
+}
+
+// linear move to target, length is given for arcs (0 = straight line)
+static void estimate_move(const float *target, float length, uint32_t sdpos) {
+    float d[4];
+    float unit[4];
+    for (int i = 0; i < 4; i++) {
+        d[i] = target[i] - est.pos[i];
+        est.pos[i] = target[i];
+    }
+    if (length == 0)
+        length = sqrtf(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    const bool extrude = d[3] != 0;
+    const bool e_only = length < ESTIMATE_MIN_MOVE;
+    if (e_only && ((length = fabsf(d[3])) < ESTIMATE_MIN_MOVE))
+        return;
+    for (int i = 0; i < 4; i++)
+        unit[i] = (e_only && (i < 3)) ? 0 : d[i] / length;
+
+    float nominal = fmaxf(est.feed, extrude ? est.p.min_feed : est.p.min_travel_feed);
+    float acc = e_only ? est.p.retract_acc : (extrude ? est.p.acc : est.p.travel_acc);
+    for (int i = 0; i < 4; i++) {
+        const float u = fabsf(unit[i]);
+        if (u == 0)
+            continue;
+        if (u * nominal > est.p.max_feed[i])
+            nominal = est.p.max_feed[i] / u;
+        if (u * acc > est.p.max_acc[i])
+            acc = est.p.max_acc[i] / u;
+    }
+
+    float junction;
+    #if ENABLED(CLASSIC_JERK)
+    // speed reachable from and to full stop, then jerk limited junction with previous move (planner::_buffer_steps)
+    float safe = nominal;
+    for (int i = 0; i < 4; i++) {
+        const float cs = fabsf(unit[i]) * nominal;
+        if (cs > est.p.jerk[i])
+            safe = fminf(safe, nominal * est.p.jerk[i] / cs);
+    }
+    junction = safe;
+    if (est.prev_nominal > 0) {
+        float smaller_factor = 1;
+        float v_factor = 1;
+        junction = est.prev_nominal;
+        if (nominal < est.prev_nominal) {
+            junction = nominal;
+            smaller_factor = nominal / est.prev_nominal;
+        }
+        for (int i = 0; i < 4; i++) {
+            const float v_exit = est.prev_unit[i] * est.prev_nominal * smaller_factor * v_factor;
+            const float v_entry = unit[i] * nominal * v_factor;
+            const float jerk = (v_exit > v_entry) ? (((v_entry > 0) || (v_exit < 0)) ? (v_exit - v_entry) : fmaxf(v_exit, -v_entry))
+                                                  : (((v_entry < 0) || (v_exit > 0)) ? (v_entry - v_exit) : fmaxf(-v_exit, v_entry));
+            if (jerk > est.p.jerk[i])
+                v_factor *= est.p.jerk[i] / jerk;
+        }
+        junction *= v_factor;
+        const float threshold = junction * 0.99f;
+        if ((est.prev_safe > threshold) && (safe > threshold))
+            junction = safe;
+    }
+    est.prev_safe = safe;
+    #else
+    // junction deviation (centripetal acceleration on virtual arc in the corner)
+    junction = 0;
+    if (est.prev_nominal > 0) {
+        float cos_theta = 0;
+        for (int i = 0; i < 4; i++)
+            cos_theta -= est.prev_unit[i] * unit[i];
+        if (cos_theta < 0.999999f) {
+            const float sin_theta_d2 = sqrtf(0.5f * (1 - fmaxf(cos_theta, -0.999999f)));
+            junction = sqrtf(acc * est.p.junction_dev * sin_theta_d2 / (1 - sin_theta_d2));
+            junction = fminf(junction, fminf(nominal, est.prev_nominal));
+        }
+    }
+    #endif
+
+    if (est.count == PRINT_ESTIMATE_LOOKAHEAD)
+        estimate_finish_oldest();
+    estimate_move_t *m = &est.moves[(est.head + est.count++) % PRINT_ESTIMATE_LOOKAHEAD];
+    m->sdpos = sdpos;
+    m->length = length;
+    m->nominal = nominal;
+    m->acc = acc;
+    m->max_entry = fminf(junction, nominal);
+    memcpy(est.prev_unit, unit, sizeof(unit));
+    est.prev_nominal = nominal;
+}
+
+// arc length of G2/G3 in XY plane (same geometry as plan_arc)
+static float estimate_arc_length(const float *target, uint32_t seen, const float *vals, bool clockwise) {
+    float i = 0, j = 0;
+    const float cx = target[0] - est.pos[0], cy = target[1] - est.pos[1];
+    if (seen & (1 << ('R' - 'A'))) {
+        const float r = vals['R' - 'A'];
+        const float chord = sqrtf(cx * cx + cy * cy);
+        if ((r == 0) || (chord == 0))
+            return 0;
+        const float half = fminf(chord / (2 * fabsf(r)), 1);
+        float angle = 2 * asinf(half);
+        if (r < 0)
+            angle = 2 * (float)M_PI - angle;
+        const float flat = fabsf(r) * angle;
+        return sqrtf(flat * flat + (target[2] - est.pos[2]) * (target[2] - est.pos[2]));
+    }
+    if (seen & (1 << ('I' - 'A')))
+        i = vals['I' - 'A'];
+    if (seen & (1 << ('J' - 'A')))
+        j = vals['J' - 'A'];
+    if ((i == 0) && (j == 0))
+        return 0;
+    const float ra = -i, rb = -j;        // radius vector from center to start
+    const float ta = cx - i, tb = cy - j; // radius vector from center to target
+    float angle = atan2f(ra * tb - rb * ta, ra * ta + rb * tb);
+    if (angle < 0)
+        angle += 2 * (float)M_PI;
+    if (clockwise)
+        angle -= 2 * (float)M_PI;
+    if ((angle == 0) && (cx == 0) && (cy == 0))
+        angle = 2 * (float)M_PI;
+    const float flat = sqrtf(ra * ra + rb * rb) * fabsf(angle);
+    return sqrtf(flat * flat + (target[2] - est.pos[2]) * (target[2] - est.pos[2]));
+}
+
+//-----------------------------------------------------------------------------
+// gcode parser
+
+    #define SEEN(c) (seen & (1 << ((c) - 'A')))
+    #define VAL(c)  vals[(c) - 'A']
+
+// parse words "<letter><number>" after command, returns mask of seen letters
+static uint32_t estimate_parse_words(const char *p, float *vals) {
+    uint32_t seen = 0;
+    char *end;
+    while (*p) {
+        if ((*p >= 'A') && (*p <= 'Z')) {
+            const float v = strtof(p + 1, &end);
+            seen |= 1 << (*p - 'A');
+            vals[*p - 'A'] = v;
+            p = (end > p) ? end : (p + 1);
+        } else
+            p++;
+    }
+    return seen;
+}
+
+static void estimate_line(uint32_t sdpos) {
+    float vals[26];
+    float target[4];
+    char *p = est.line;
+    char *end;
+    while (*p == ' ')
+        p++;
+    if (*p == 'N') { // line number
+        strtol(p + 1, &p, 10);
+        while (*p == ' ')
+            p++;
+    }
+    const char cmd = *p;
+    if ((cmd != 'G') && (cmd != 'M'))
+        return;
+    const int code = strtol(p + 1, &end, 10);
+    if (end == p + 1)
+        return;
+    const uint32_t seen = estimate_parse_words(end, vals);
+
+    if (cmd == 'G')
+        switch (code) {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+            for (int i = 0; i < 4; i++) {
+                const char c = "XYZE"[i];
+                const bool rel = est.relative || ((i == 3) && est.relative_e);
+                target[i] = SEEN(c) ? (rel ? est.pos[i] + VAL(c) : VAL(c)) : est.pos[i];
+            }
+            if (SEEN('F') && (VAL('F') > 0))
+                est.feed = VAL('F') / 60;
+            if (code < 2)
+                estimate_move(target, 0, sdpos);
+            else {
+                const float length = estimate_arc_length(target, seen, vals, code == 2);
+                if (length > 0)
+                    estimate_move(target, length, sdpos);
+                else
+                    memcpy(est.pos, target, sizeof(target));
+            }
+            break;
+        case 4: // dwell
+            estimate_sync();
+            estimate_add_time(sdpos, SEEN('S') ? VAL('S') : (SEEN('P') ? VAL('P') / 1000 : 0));
+            break;
+        case 28: // home, duration not estimated
+            estimate_sync();
+            for (int i = 0; i < 3; i++)
+                if (SEEN("XYZ"[i]) || !(SEEN('X') || SEEN('Y') || SEEN('Z')))
+                    est.pos[i] = 0;
+            break;
+        case 29: // probing, duration not estimated
+            estimate_sync();
+            break;
+        case 90:
+            est.relative = 0;
+            break;
+        case 91:
+            est.relative = 1;
+            break;
+        case 92:
+            for (int i = 0; i < 4; i++)
+                if (SEEN("XYZE"[i]) || !(seen & ((1 << ('X' - 'A')) | (1 << ('Y' - 'A')) | (1 << ('Z' - 'A')) | (1 << ('E' - 'A')))))
+                    est.pos[i] = SEEN("XYZE"[i]) ? VAL("XYZE"[i]) : 0;
+            break;
+        }
+    else
+        switch (code) {
+        case 82:
+            est.relative_e = 0;
+            break;
+        case 83:
+            est.relative_e = 1;
+            break;
+        case 109: // heating, duration not estimated
+        case 190:
+        case 400:
+            estimate_sync();
+            break;
+        case 201:
+            for (int i = 0; i < 4; i++)
+                if (SEEN("XYZE"[i]))
+                    est.p.max_acc[i] = VAL("XYZE"[i]);
+            break;
+        case 203:
+            for (int i = 0; i < 4; i++)
+                if (SEEN("XYZE"[i]))
+                    est.p.max_feed[i] = VAL("XYZE"[i]);
+            break;
+        case 204:
+            if (SEEN('S'))
+                est.p.acc = est.p.travel_acc = VAL('S');
+            if (SEEN('P'))
+                est.p.acc = VAL('P');
+            if (SEEN('R'))
+                est.p.retract_acc = VAL('R');
+            if (SEEN('T'))
+                est.p.travel_acc = VAL('T');
+            break;
+        case 205:
+            for (int i = 0; i < 4; i++)
+                if (SEEN("XYZE"[i]))
+                    est.p.jerk[i] = VAL("XYZE"[i]);
+            if (SEEN('J'))
+                est.p.junction_dev = VAL('J');
+            break;
+        }
+}
+
+//-----------------------------------------------------------------------------
+// index
+
+static void estimate_load_params(estimate_params_t *p) {
+    memset(p, 0, sizeof(estimate_params_t));
+    for (int i = 0; i < 4; i++) {
+        p->max_acc[i] = planner.settings.max_acceleration_mm_per_s2[i];
+        p->max_feed[i] = planner.settings.max_feedrate_mm_s[i];
+    #if ENABLED(CLASSIC_JERK)
+        p->jerk[i] = planner.max_jerk[i];
+    #endif
+    }
+    #if DISABLED(CLASSIC_JERK)
+    p->junction_dev = planner.junction_deviation_mm;
+    #endif
+    p->acc = planner.settings.acceleration;
+    p->retract_acc = planner.settings.retract_acceleration;
+    p->travel_acc = planner.settings.travel_acceleration;
+    p->min_feed = planner.settings.min_feedrate_mm_s;
+    p->min_travel_feed = planner.settings.min_travel_feedrate_mm_s;
+}
+
+// FNV-1a
+static uint32_t estimate_hash(const uint8_t *data, uint16_t cnt) {
+    uint32_t hash = 0x811c9dc5;
+    while (cnt--)
+        hash = (hash ^ *(data++)) * 0x01000193;
+    return hash;
+}
+
+// stream file through parser, returns 0 when aborted by new request or read error
+static int estimate_scan(void) {
+    uint32_t sdpos = 0;
+    UINT br;
+    memset(&est, 0, sizeof(est));
+    estimate_load_params(&est.p);
+    est.entry = -1;
+    est.stride = estimate_hdr.stride;
+    if (f_open(&estimate_fil, estimate_path, FA_READ) != FR_OK)
+        return 0;
+    do {
+        if (estimate_request || (f_read(&estimate_fil, estimate_block, sizeof(estimate_block), &br) != FR_OK)) {
+            f_close(&estimate_fil);
+            return 0;
+        }
+        for (UINT i = 0; i < br; i++) {
+            char c = estimate_block[i];
+            sdpos++;
+            if ((c == '\n') || (c == '\r')) {
+                est.line[est.line_len] = 0;
+                if (est.line_len)
+                    estimate_line(sdpos);
+                est.line_len = 0;
+                est.comment = 0;
+            } else if ((c == ';') || (c == '*'))
+                est.comment = 1;
+            else if (!est.comment && (est.line_len < (ESTIMATE_LINE_LEN - 1)))
+                est.line[est.line_len++] = ((c >= 'a') && (c <= 'z')) ? (c - 'a' + 'A') : c;
+        }
+        osDelay(1); // leave the bus and cpu to printing
+    } while (br == sizeof(estimate_block));
+    f_close(&estimate_fil);
+    if (est.line_len) { // last line without newline
+        est.line[est.line_len] = 0;
+        estimate_line(sdpos);
+    }
+    estimate_sync();
+    estimate_add_time(0xffffffff, 0); // fill rest of index
+    estimate_hdr.total = (uint32_t)est.time;
+    return 1;
+}
+
+static void estimate_run(void) {
+    static estimate_params_t params; // not on stack
+    estimate_hdr_t hdr;
+    if (f_stat(estimate_path, &estimate_finfo) != FR_OK)
+        return;
+    estimate_load_params(&params);
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.path_hash = estimate_hash((const uint8_t *)estimate_path, strlen(estimate_path));
+    hdr.fsize = estimate_finfo.fsize;
+    hdr.fdate = estimate_finfo.fdate;
+    hdr.ftime = estimate_finfo.ftime;
+    hdr.params = estimate_hash((const uint8_t *)&params, sizeof(params));
+    hdr.stride = estimate_finfo.fsize / PRINT_ESTIMATE_INDEX + 1;
+    if (!estimate_cached || (memcmp(&hdr, &estimate_hdr, offsetof(estimate_hdr_t, total)) != 0)) { // same file printed again reuses index
+        estimate_cached = 0;
+        estimate_hdr = hdr;
+        if (!estimate_scan())
+            return;
+        estimate_cached = 1;
+    }
+    taskENTER_CRITICAL();
+    if (!estimate_request) // not superseded during scan
+        estimate_ready = 1;
+    taskEXIT_CRITICAL();
+}
+
+//-----------------------------------------------------------------------------
+// public functions
+
+void estimate_start(const char *path) {
+    if (strlen(path) >= ESTIMATE_PATH_LEN)
+        return;
+    taskENTER_CRITICAL();
+    estimate_ready = 0;
+    strcpy(estimate_req_path, path);
+    estimate_request = 1;
+    taskEXIT_CRITICAL();
+}
+
+int32_t estimate_remaining(uint32_t sdpos, uint16_t print_speed) {
+    uint32_t total = 0;
+    uint32_t stride = 1;
+    uint32_t t[2] = { 0, 0 };
+    uint8_t ready;
+    if (print_speed == 0)
+        return -1;
+    taskENTER_CRITICAL(); // index is not rewritten while ready, copy it before new scan can start
+    if ((ready = estimate_ready)) {
+        const uint32_t i = sdpos / estimate_hdr.stride;
+        total = estimate_hdr.total;
+        stride = estimate_hdr.stride;
+        t[0] = t[1] = total;
+        if (i < PRINT_ESTIMATE_INDEX) {
+            t[0] = estimate_index[i];
+            t[1] = estimate_index[i + 1];
+        }
+    }
+    taskEXIT_CRITICAL();
+    if (!ready)
+        return -1;
+    const float frac = (float)(sdpos % stride) / stride;
+    const float elapsed = t[0] + frac * (float)(t[1] - t[0]);
+    // time scales with feedrate percentage (acceleration limited parts do not, good enough for display)
+    return (int32_t)((total - elapsed) * 100 / print_speed);
+}
+
+void StartEstimateTask(void const *argument) {
+    for (;;) {
+        if (estimate_request) {
+            taskENTER_CRITICAL();
+            strcpy(estimate_path, estimate_req_path);
+            estimate_request = 0;
+            taskEXIT_CRITICAL();
+            estimate_run();
+        }
+        osDelay(100);
+    }
+}
+
+#endif //PRINT_ESTIMATE
@@ -0,0 +1,24 @@
+// print_estimate.h - gcode pre-scan print time estimator
+#ifndef _PRINT_ESTIMATE_H
+#define _PRINT_ESTIMATE_H
+
+#include <inttypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// request estimation of gcode file (path as used by M23), index of last estimated file is reused when unchanged
+extern void estimate_start(const char *path);
+
+// remaining print time [s] from file position at given print speed [%], -1 when index is not (yet) available
+extern int32_t estimate_remaining(uint32_t sdpos, uint16_t print_speed);
+
+// estimator thread
+extern void StartEstimateTask(void const *argument);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //_PRINT_ESTIMATE_H
@@ -0,0 +1,241 @@
+// print_journal.c
+
+#include "print_journal.h"
+#include "w25x.h"
+#include <string.h>
+
+#define JOURNAL_SCAN_RETRY 2 // newest record can be torn by power loss, try previous one
+
+// ring of fixed size records, the sector following the one being written is kept erased
+typedef struct _journal_ring_t {
+    uint32_t addr;    // xflash address of first sector
+    uint16_t sectors; // number of sectors
+    uint16_t size;    // record size (divides page size)
+    uint32_t magic;   // record magic
+    uint32_t seq;     // sequence number of last written record
+    uint32_t next;    // offset of next record
+    int8_t erase;     // sector waiting for erase, -1 = none
+} journal_ring_t;
+
+static journal_ring_t journal_job = {
+    JOURNAL_XFLASH_ADDR, JOURNAL_JOB_SECTORS, JOURNAL_JOB_SIZE, JOURNAL_JOB_MAGIC, 0, 0, -1
+};
+
+static journal_ring_t journal_mesh = {
+    JOURNAL_XFLASH_ADDR + JOURNAL_JOB_SECTORS * JOURNAL_SECTOR_SIZE, JOURNAL_MESH_SECTORS, JOURNAL_MESH_SIZE, JOURNAL_MESH_MAGIC, 0, 0, -1
+};
+
+static journal_ring_t journal_rec = {
+    JOURNAL_XFLASH_ADDR + (JOURNAL_JOB_SECTORS + JOURNAL_MESH_SECTORS) * JOURNAL_SECTOR_SIZE, JOURNAL_REC_SECTORS, JOURNAL_REC_SIZE, JOURNAL_REC_MAGIC, 0, 0, -1
+};
+
+static uint8_t journal_ready = 0;
+static uint8_t journal_resume_valid = 0;
+static uint8_t journal_resume_mesh_valid = 0;
+static uint8_t journal_discard_pending = 0;
+static journal_rec_t journal_resume_rec;
+static char journal_resume_path[JOURNAL_PATH_LEN];
+static journal_mesh_t journal_resume_mesh;
+
+static uint32_t journal_crc32(const uint8_t *data, uint16_t cnt) {
+    uint32_t crc = 0xffffffff;
+    while (cnt--) {
+        crc ^= *(data++);
+        for (int i = 0; i < 8; i++)
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+// find record with highest sequence number below limit, returns offset or -1
+static int32_t journal_ring_newest(journal_ring_t *ring, uint32_t limit, uint32_t *pseq) {
+    uint32_t magic_seq[2];
+    uint32_t off;
+    int32_t newest = -1;
+    for (off = 0; off < ring->sectors * JOURNAL_SECTOR_SIZE; off += ring->size) {
+        w25x_rd_data(ring->addr + off, (uint8_t *)magic_seq, sizeof(magic_seq));
+        if ((magic_seq[0] != ring->magic) || (magic_seq[1] >= limit))
+            continue;
+        if ((newest < 0) || (magic_seq[1] > *pseq)) {
+            newest = off;
+            *pseq = magic_seq[1];
+        }
+    }
+    return newest;
+}
+
+// read newest complete record to data, new records continue in the sector after the newest one
+// returns 1 when valid record was read
+static int journal_ring_init(journal_ring_t *ring, void *data) {
+    uint32_t limit = 0xffffffff;
+    uint32_t seq;
+    uint32_t crc;
+    int32_t off;
+    int retry;
+    int valid = 0;
+    for (retry = 0; retry < JOURNAL_SCAN_RETRY; retry++) {
+        if ((off = journal_ring_newest(ring, limit, &seq)) < 0)
+            break;
+        if (retry == 0) {
+            ring->seq = seq;
+            ring->next = ((off / JOURNAL_SECTOR_SIZE + 1) % ring->sectors) * JOURNAL_SECTOR_SIZE;
+        }
+        w25x_rd_data(ring->addr + off, data, ring->size);
+        memcpy(&crc, (uint8_t *)data + ring->size - 4, 4);
+        if (journal_crc32(data, ring->size - 4) == crc) {
+            valid = 1;
+            break;
+        }
+        limit = seq;
+    }
+    ring->erase = ring->next / JOURNAL_SECTOR_SIZE; // content unknown, erase before first write
+    return valid;
+}
+
+static void journal_ring_erase(journal_ring_t *ring) {
+    w25x_enable_wr();
+    w25x_sector_erase(ring->addr + ring->erase * JOURNAL_SECTOR_SIZE);
+    ring->erase = -1;
+}
+
+// caller holds xflash lock
+static int journal_ring_write(journal_ring_t *ring, void *data) {
+    uint32_t hdr[2];
+    uint32_t crc;
+    uint32_t off;
+    if (w25x_rd_status_reg() & W25X_STATUS_BUSY)
+        return 0;
+    if (ring->erase >= 0) {
+        journal_ring_erase(ring); // normally done by journal_cycle before
+        return 0;
+    }
+    hdr[0] = ring->magic;
+    hdr[1] = ring->seq + 1;
+    memcpy(data, hdr, sizeof(hdr));
+    crc = journal_crc32(data, ring->size - 4);
+    memcpy((uint8_t *)data + ring->size - 4, &crc, 4);
+    for (off = 0; off < ring->size; off += JOURNAL_PAGE_SIZE) { // grid record spans pages, wait for each (few ms)
+        if (off)
+            w25x_wait_busy();
+        w25x_enable_wr();
+        w25x_page_program(ring->addr + ring->next + off, (uint8_t *)data + off, (ring->size < JOURNAL_PAGE_SIZE) ? ring->size : JOURNAL_PAGE_SIZE);
+    }
+    ring->seq++;
+    if ((ring->next % JOURNAL_SECTOR_SIZE) == 0) // first record in sector, pre-erase the following one
+        ring->erase = (ring->next / JOURNAL_SECTOR_SIZE + 1) % ring->sectors;
+    ring->next = (ring->next + ring->size) % (ring->sectors * JOURNAL_SECTOR_SIZE);
+    return 1;
+}
+
+// ring write from marlin thread, skipped while xflash is used by other thread (dump save)
+static int journal_ring_write_locked(journal_ring_t *ring, void *data) {
+    int ret;
+    if (!journal_ready)
+        return -1;
+    if (!w25x_try_lock())
+        return 0;
+    ret = journal_ring_write(ring, data);
+    w25x_unlock();
+    return ret;
+}
+
+void journal_init(void) {
+    journal_job_t job;
+    if (!(journal_ready = w25x_init()))
+        return;
+    if (!journal_ring_init(&journal_rec, &journal_resume_rec))
+        journal_resume_rec.state = 0;
+    if (!journal_ring_init(&journal_job, &job))
+        job.path_hash = ~journal_resume_rec.path_hash;
+    if (!journal_ring_init(&journal_mesh, &journal_resume_mesh))
+        journal_resume_mesh.job_seq = ~journal_job.seq;
+    if ((journal_resume_rec.state == JOURNAL_STATE_PRINTING) && (job.path_hash == journal_resume_rec.path_hash)) {
+        memcpy(journal_resume_path, job.path, JOURNAL_PATH_LEN);
+        journal_resume_path[JOURNAL_PATH_LEN - 1] = 0;
+        journal_resume_valid = 1;
+        journal_resume_mesh_valid = (journal_resume_mesh.job_seq == journal_job.seq);
+    }
+}
+
+void journal_cycle(void) {
+    if (!journal_ready)
+        return;
+    if ((journal_job.erase < 0) && (journal_mesh.erase < 0) && (journal_rec.erase < 0) && !journal_discard_pending)
+        return;
+    if (!w25x_try_lock())
+        return;
+    if (!(w25x_rd_status_reg() & W25X_STATUS_BUSY)) {
+        if (journal_job.erase >= 0)
+            journal_ring_erase(&journal_job);
+        else if (journal_mesh.erase >= 0)
+            journal_ring_erase(&journal_mesh);
+        else if (journal_rec.erase >= 0)
+            journal_ring_erase(&journal_rec);
+        else {
+            journal_resume_rec.state = JOURNAL_STATE_DONE;
+            if (journal_ring_write(&journal_rec, &journal_resume_rec))
+                journal_discard_pending = 0;
+        }
+    }
+    w25x_unlock();
+}
+
+// FNV-1a
+uint32_t journal_path_hash(const char *path) {
+    uint32_t hash = 0x811c9dc5;
+    while (*path)
+        hash = (hash ^ (uint8_t)*(path++)) * 0x01000193;
+    return hash;
+}
+
+int journal_write_job(const char *path) {
+    static journal_job_t job; // not on stack, called from marlin thread
+    int ret;
+    if (strlen(path) >= JOURNAL_PATH_LEN)
+        return -1;
+    memset(&job, 0, sizeof(job));
+    job.path_hash = journal_path_hash(path);
+    strcpy(job.path, path);
+    if ((ret = journal_ring_write_locked(&journal_job, &job)) > 0) {
+        journal_resume_valid = 0; // new print supersedes interrupted one
+        journal_resume_mesh_valid = 0;
+        journal_discard_pending = 0;
+    }
+    return ret;
+}
+
+int journal_write_rec(journal_rec_t *rec) {
+    memset(rec->reserved, 0xff, sizeof(rec->reserved));
+    return journal_ring_write_locked(&journal_rec, rec);
+}
+
+int journal_write_mesh(journal_mesh_t *mesh) {
+    if ((mesh->xc * mesh->yc) > JOURNAL_MESH_POINTS)
+        return -1;
+    mesh->job_seq = journal_job.seq;
+    memset(mesh->reserved, 0xff, sizeof(mesh->reserved));
+    return journal_ring_write_locked(&journal_mesh, mesh);
+}
+
+int journal_get_resume(journal_rec_t *rec, char *path) {
+    if (!journal_resume_valid)
+        return 0;
+    memcpy(rec, &journal_resume_rec, sizeof(journal_rec_t));
+    strcpy(path, journal_resume_path);
+    return 1;
+}
+
+int journal_get_resume_mesh(journal_mesh_t *mesh) {
+    if (!journal_resume_valid || !journal_resume_mesh_valid)
+        return 0;
+    memcpy(mesh, &journal_resume_mesh, sizeof(journal_mesh_t));
+    return 1;
+}
+
+void journal_discard_resume(void) {
+    if (journal_resume_valid) {
+        journal_resume_valid = 0;
+        journal_resume_mesh_valid = 0;
+        journal_discard_pending = 1;
+    }
+}
@@ -0,0 +1,117 @@
+// print_journal.h - power-loss recovery journal in external flash
+#ifndef _PRINT_JOURNAL_H
+#define _PRINT_JOURNAL_H
+
+#include <inttypes.h>
+
+// xflash journal area (64kb) after dump area, 4kb sectors
+//  - job ring: two sectors of 256 byte job records (print file path)
+//  - mesh ring: two sectors of 1024 byte bed leveling grid records
+//  - rec ring: twelve sectors of 64 byte progress records
+#define JOURNAL_XFLASH_ADDR  0x00040000
+#define JOURNAL_SECTOR_SIZE  0x1000
+#define JOURNAL_PAGE_SIZE    0x100 // page program limit
+#define JOURNAL_JOB_SECTORS  2
+#define JOURNAL_MESH_SECTORS 2
+#define JOURNAL_REC_SECTORS  12
+#define JOURNAL_JOB_SIZE     0x100
+#define JOURNAL_MESH_SIZE    0x400
+#define JOURNAL_REC_SIZE     0x40
+#define JOURNAL_JOB_MAGIC    0x424a4a50 // "PJJB"
+#define JOURNAL_MESH_MAGIC   0x324d4a50 // "PJM2" (up to 15x15 grid)
+#define JOURNAL_REC_MAGIC    0x32434a50 // "PJC2" (modes field added)
+#define JOURNAL_PATH_LEN     240
+#define JOURNAL_MESH_POINTS  (15 * 15) // up to 15x15 ABL grid
+
+// progress record modes (bit mask)
+#define JOURNAL_MODE_REL_XYZ   0x01 // relative positioning (G91)
+#define JOURNAL_MODE_REL_E     0x02 // relative extrusion (M83)
+#define JOURNAL_MODE_LEVELING  0x04 // bed leveling active
+
+// progress record state
+#define JOURNAL_STATE_PRINTING 0x01 // print in progress, resumable after power loss
+#define JOURNAL_STATE_DONE     0x02 // print finished, aborted or resume declined
+
+#pragma pack(push)
+#pragma pack(1)
+
+// job record, written once at print start
+typedef struct _journal_job_t {
+    uint32_t magic;              // JOURNAL_JOB_MAGIC
+    uint32_t seq;                // sequence number (newest has highest)
+    uint32_t path_hash;          // journal_path_hash(path)
+    char path[JOURNAL_PATH_LEN]; // print file path (zero terminated)
+    uint32_t crc;                // crc32 of preceding bytes
+} journal_job_t;
+
+// progress record, written periodically while printing (size is JOURNAL_REC_SIZE)
+typedef struct _journal_rec_t {
+    uint32_t magic;       // JOURNAL_REC_MAGIC
+    uint32_t seq;         // sequence number (newest has highest)
+    uint32_t path_hash;   // links record to job
+    uint32_t sdpos;       // file position of first command not fully executed by stepper
+    float pos[4];         // xyze position at sdpos [mm]
+    float feedrate;       // feedrate at sdpos [mm/s]
+    int16_t temp_nozzle;  // target nozzle temperature [C]
+    int16_t temp_bed;     // target bed temperature [C]
+    uint16_t print_speed; // feedrate percentage
+    uint16_t flow_factor; // flow percentage
+    uint8_t fan_speed;    // part fan speed (0..255)
+    uint8_t state;        // JOURNAL_STATE_xxx
+    uint8_t modes;        // JOURNAL_MODE_xxx
+    uint8_t reserved[13]; // 0xff
+    uint32_t crc;         // crc32 of preceding bytes
+} journal_rec_t;
+
+// bed leveling grid record, written when the grid changes while printing (size is JOURNAL_MESH_SIZE)
+typedef struct _journal_mesh_t {
+    uint32_t magic;               // JOURNAL_MESH_MAGIC
+    uint32_t seq;                 // sequence number (newest has highest)
+    uint32_t job_seq;             // sequence number of the job record it belongs to
+    float start[2];               // xy position of first grid point [mm]
+    float spacing[2];             // xy grid spacing [mm]
+    uint8_t xc;                   // number of grid points in x
+    uint8_t yc;                   // number of grid points in y
+    uint8_t reserved[90];         // 0xff
+    float z[JOURNAL_MESH_POINTS]; // z offsets [mm], index = x + xc * y
+    uint32_t crc;                 // crc32 of preceding bytes
+} journal_mesh_t;
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// scan journal, cache interrupted print for resume (call once at startup, before dump_init)
+extern void journal_init(void);
+
+// flush pending sector erase, non-blocking, skipped while xflash is locked (call periodically from writing thread)
+extern void journal_cycle(void);
+
+// hash used to link progress records with job record
+extern uint32_t journal_path_hash(const char *path);
+
+// write job record, non-blocking, returns 1 when written, 0 when flash busy or locked (retry later), -1 on error
+extern int journal_write_job(const char *path);
+
+// write progress record (magic, seq and crc are filled), non-blocking, same return values as journal_write_job
+extern int journal_write_rec(journal_rec_t *rec);
+
+// write grid record of current job (magic, seq, job_seq and crc are filled), same return values as journal_write_job
+extern int journal_write_mesh(journal_mesh_t *mesh);
+
+// interrupted print found by journal_init, returns 1 and fills rec and path (JOURNAL_PATH_LEN), 0 if none
+extern int journal_get_resume(journal_rec_t *rec, char *path);
+
+// grid of interrupted print, returns 1 and fills mesh, 0 if none
+extern int journal_get_resume_mesh(journal_mesh_t *mesh);
+
+// forget interrupted print, DONE record is written by journal_cycle
+extern void journal_discard_resume(void);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //_PRINT_JOURNAL_H
@@ -10,3 +10,30 @@ extern "C" void print_begin(const char *filename) {
     // in Marlin. Needs refactoring!
     oProgressData.mInit();
 }
+
+extern "C" void print_resume(const journal_rec_t *rec, const char *filename) {
+    marlin_journal_restore_mesh(); // leveling grid probed by the interrupted print
+    marlin_gcode_printf("M140 S%d", rec->temp_bed);
+    marlin_gcode_printf("M104 S%d", rec->temp_nozzle);
+    marlin_gcode_printf("M190 S%d", rec->temp_bed);
+    marlin_gcode_printf("M109 S%d", rec->temp_nozzle);
+    marlin_gcode("G90"); // restore moves are absolute
+    marlin_gcode_printf("G92 Z%.3f", (double)rec->pos[2]);
+    marlin_gcode_printf("G1 Z%.3f F600", (double)(rec->pos[2] + 2)); // lift before XY homing
+    marlin_gcode("G28 X Y");
+    if (rec->modes & JOURNAL_MODE_LEVELING)
+        marlin_gcode("M420 S1"); // G28 disables leveling
+    marlin_gcode_printf("G1 X%.3f Y%.3f F3000", (double)rec->pos[0], (double)rec->pos[1]);
+    marlin_gcode_printf("G1 Z%.3f F600", (double)rec->pos[2]);
+    marlin_gcode_printf("G92 E%.5f", (double)rec->pos[3]);
+    marlin_gcode_printf("M220 S%u", rec->print_speed);
+    marlin_gcode_printf("M221 S%u", rec->flow_factor);
+    marlin_gcode_printf("M106 S%u", rec->fan_speed);
+    marlin_gcode_printf("G1 F%d", (int)(rec->feedrate * 60));
+    marlin_gcode((rec->modes & JOURNAL_MODE_REL_XYZ) ? "G91" : "G90"); // modes of the replayed lines
+    marlin_gcode((rec->modes & JOURNAL_MODE_REL_E) ? "M83" : "M82");
+    marlin_gcode_printf("M23 %s", filename);
+    marlin_gcode_printf("M26 S%u", (unsigned)rec->sdpos);
+    marlin_gcode("M24");
+    oProgressData.mInit();
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "print_journal.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif //__cplusplus
@@ -10,6 +12,13 @@ extern "C" {
 /// is the caller's responsibility.
 void print_begin(const char *filename);
 
+/// Resumes a print interrupted by power loss.
+///
+/// Heats up, restores Z from the journal (Z is not homed, the nozzle
+/// is above the print), homes XY and continues from the journaled
+/// file position.
+void print_resume(const journal_rec_t *rec, const char *filename);
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
@@ -9,6 +9,7 @@
 #include "diag.h"
 #include "app.h"
 #include "marlin_server.h"
+#include "config.h"
 #include "sim_motion.h"
 #include "otp.h"
 #ifdef BUDDY_ENABLE_ETHERNET
@@ -83,6 +84,8 @@ int putslave_parse_cmd_id(uartslave_t *pslave, char *pstr, uint16_t *pcmd_id) {
             cmd_id = PUTSLAVE_CMD_ID_MOVE;
         else if (strncmp(pstr, "gpup", 4) == 0)
             cmd_id = PUTSLAVE_CMD_ID_GPUP;
+        else if (strncmp(pstr, "smtr", 4) == 0)
+            cmd_id = PUTSLAVE_CMD_ID_SMTR;
     } else if ((pstr[5] == 0) || (pstr[5] == ' ')) {
         ret = 5;
         if (strncmp(pstr, "gcode", 5) == 0)
@@ -542,6 +545,30 @@ int putslave_do_cmd_a_move(uartslave_t *pslave, char *pstr) {
     return UARTSLAVE_OK;
 }
 
+#ifdef SIM_MOTION_TRACE
+//?smtr - number of lost trace records
+int putslave_do_cmd_q_smtr(uartslave_t *pslave) {
+    uartslave_printf(pslave, "%u ", (unsigned int)sim_motion_trace_lost());
+    return UARTSLAVE_OK;
+}
+
+//!smtr 1 - start motion trace, !smtr 0 [file] - stop and append trace to file on usb flash
+int putslave_do_cmd_a_smtr(uartslave_t *pslave, char *pstr) {
+    char fn[32] = "smtrace.bin";
+    int state;
+    if (sscanf(pstr, "%d %31s", &state, fn) < 1)
+        return UARTSLAVE_ERR_SYN;
+    if ((state < 0) || (state > 1))
+        return UARTSLAVE_ERR_OOR;
+    if (state) {
+        sim_motion_trace_start();
+        return UARTSLAVE_OK;
+    }
+    sim_motion_trace_stop();
+    return sim_motion_trace_save(fn) ? UARTSLAVE_OK : UARTSLAVE_ERR_UNK;
+}
+#endif //SIM_MOTION_TRACE
+
 int putslave_do_cmd(uartslave_t *pslave, uint16_t mod_msk, char cmd, uint16_t cmd_id, char *pstr) {
     if (cmd == '?') {
         if (mod_msk == 0)
@@ -578,6 +605,10 @@ int putslave_do_cmd(uartslave_t *pslave, uint16_t mod_msk, char cmd, uint16_t cm
                 return putslave_do_cmd_q_tdg(pslave);
             case PUTSLAVE_CMD_ID_GPUP:
                 return putslave_do_cmd_q_gpup(pslave, pstr);
+#ifdef SIM_MOTION_TRACE
+            case PUTSLAVE_CMD_ID_SMTR:
+                return putslave_do_cmd_q_smtr(pslave);
+#endif //SIM_MOTION_TRACE
             }
     } else if (cmd == '!') {
         if (mod_msk == 0)
@@ -620,6 +651,10 @@ int putslave_do_cmd(uartslave_t *pslave, uint16_t mod_msk, char cmd, uint16_t cm
                 return putslave_do_cmd_a_ten(pslave, pstr);
             case PUTSLAVE_CMD_ID_MOVE:
                 return putslave_do_cmd_a_move(pslave, pstr);
+#ifdef SIM_MOTION_TRACE
+            case PUTSLAVE_CMD_ID_SMTR:
+                return putslave_do_cmd_a_smtr(pslave, pstr);
+#endif //SIM_MOTION_TRACE
             }
     }
     return UARTSLAVE_ERR_CNF;
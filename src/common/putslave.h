@@ -31,6 +31,7 @@
 #define PUTSLAVE_CMD_ID_MOVE  0xc9
 #define PUTSLAVE_CMD_ID_TDG   0xd0
 #define PUTSLAVE_CMD_ID_GPUP  0xd1
+#define PUTSLAVE_CMD_ID_SMTR  0xd2
 
 #define FLASH_START_ADRESS 0x08020200
 
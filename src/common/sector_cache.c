@@ -0,0 +1,228 @@
+// sector_cache.c - LRU block cache with read-ahead and write coalescing for block devices
+
+#include "sector_cache.h"
+#include <string.h>
+
+#define SECTOR_SIZE SECTOR_CACHE_SECTOR_SIZE
+
+static inline uint8_t *sector_cache_ptr(sector_cache_t *cache, int index, uint32_t offs) {
+    return cache->data + ((uint32_t)index * cache->line_sectors + offs) * SECTOR_SIZE;
+}
+
+// mask of count sectors starting at offs
+static inline uint8_t sector_cache_mask(uint32_t offs, uint32_t count) {
+    return (uint8_t)(((1U << count) - 1) << offs);
+}
+
+static inline void sector_cache_touch(sector_cache_t *cache, int index) {
+    cache->line[index].used = ++cache->clock;
+}
+
+// transfer is not cached (disabled, line size or more, last incomplete line of device)
+static inline int sector_cache_bypass(sector_cache_t *cache, uint32_t sector, uint32_t count) {
+    uint32_t end = (sector & ~(uint32_t)(cache->line_sectors - 1)) + cache->line_sectors;
+    return (cache->sector_count == 0) || (count >= cache->line_sectors) || (end > cache->sector_count);
+}
+
+// line index of sector or -1
+static int sector_cache_find(sector_cache_t *cache, uint32_t sector) {
+    uint32_t base = sector & ~(uint32_t)(cache->line_sectors - 1);
+    int i;
+    for (i = 0; i < cache->lines; i++)
+        if (cache->line[i].valid && (cache->line[i].sector == base))
+            return i;
+    return -1;
+}
+
+// write modified sectors of line, consecutive sectors in one transaction
+static int sector_cache_clean(sector_cache_t *cache, int index) {
+    sector_cache_line_t *line = cache->line + index;
+    uint32_t offs = 0;
+    uint32_t count;
+    int res;
+    while (line->dirty) {
+        while (!(line->dirty & (1 << offs)))
+            offs++;
+        count = 1;
+        while ((offs + count) < cache->line_sectors && (line->dirty & (1 << (offs + count))))
+            count++;
+        cache->transfers++;
+        if ((res = cache->write(sector_cache_ptr(cache, index, offs), line->sector + offs, count)) != 0)
+            return res;
+        line->dirty &= ~sector_cache_mask(offs, count);
+        offs += count;
+    }
+    return 0;
+}
+
+// get free or least recently used line (written to device when modified)
+static int sector_cache_evict(sector_cache_t *cache, uint32_t sector, int *index) {
+    int lru = 0;
+    int i;
+    int res;
+    for (i = 0; i < cache->lines; i++) {
+        if (!cache->line[i].valid) {
+            lru = i;
+            break;
+        }
+        if ((int32_t)(cache->line[i].used - cache->line[lru].used) < 0)
+            lru = i;
+    }
+    if ((res = sector_cache_clean(cache, lru)) != 0)
+        return res;
+    cache->line[lru].sector = sector & ~(uint32_t)(cache->line_sectors - 1);
+    cache->line[lru].valid = 0;
+    *index = lru;
+    return 0;
+}
+
+// read whole line of sector from device (read-ahead)
+static int sector_cache_load(sector_cache_t *cache, uint32_t sector, int *index) {
+    int i = sector_cache_find(cache, sector);
+    int res;
+    if (i < 0)
+        res = sector_cache_evict(cache, sector, &i);
+    else
+        res = sector_cache_clean(cache, i); // modified sectors would be overwritten
+    if (res)
+        return res;
+    cache->line[i].valid = 0;
+    cache->transfers++;
+    if ((res = cache->read(sector_cache_ptr(cache, i, 0), cache->line[i].sector, cache->line_sectors)) != 0)
+        return res;
+    cache->line[i].valid = sector_cache_mask(0, cache->line_sectors);
+    *index = i;
+    return 0;
+}
+
+// read from device, modified cached sectors are newer
+static int sector_cache_read_direct(sector_cache_t *cache, uint8_t *buff, uint32_t sector, uint32_t count) {
+    sector_cache_line_t *line;
+    uint32_t offs;
+    int res;
+    int i;
+    cache->transfers++;
+    if ((res = cache->read(buff, sector, count)) != 0)
+        return res;
+    for (i = 0; i < cache->lines; i++) {
+        line = cache->line + i;
+        for (offs = 0; line->dirty && (offs < cache->line_sectors); offs++)
+            if ((line->dirty & (1 << offs)) && ((line->sector + offs - sector) < count))
+                memcpy(buff + (line->sector + offs - sector) * SECTOR_SIZE, sector_cache_ptr(cache, i, offs), SECTOR_SIZE);
+    }
+    return 0;
+}
+
+// write to device, cached sectors are updated and no longer modified
+static int sector_cache_write_direct(sector_cache_t *cache, const uint8_t *buff, uint32_t sector, uint32_t count) {
+    sector_cache_line_t *line;
+    uint32_t offs;
+    int res;
+    int i;
+    cache->transfers++;
+    if ((res = cache->write((uint8_t *)buff, sector, count)) != 0)
+        return res;
+    for (i = 0; i < cache->lines; i++) {
+        line = cache->line + i;
+        for (offs = 0; line->valid && (offs < cache->line_sectors); offs++)
+            if ((line->sector + offs - sector) < count) {
+                memcpy(sector_cache_ptr(cache, i, offs), buff + (line->sector + offs - sector) * SECTOR_SIZE, SECTOR_SIZE);
+                line->valid |= (1 << offs);
+                line->dirty &= ~(1 << offs);
+            }
+    }
+    return 0;
+}
+
+void sector_cache_init(sector_cache_t *cache, sector_cache_line_t *line, uint8_t *data, uint8_t lines, uint8_t line_sectors, sector_cache_io_t *read, sector_cache_io_t *write) {
+    memset(cache, 0, sizeof(sector_cache_t));
+    cache->read = read;
+    cache->write = write;
+    cache->line = line;
+    cache->data = data;
+    cache->lines = lines;
+    cache->line_sectors = line_sectors;
+    memset(line, 0, lines * sizeof(sector_cache_line_t));
+}
+
+void sector_cache_reset(sector_cache_t *cache, uint32_t sector_count) {
+    memset(cache->line, 0, cache->lines * sizeof(sector_cache_line_t));
+    cache->sector_count = sector_count;
+    cache->clock = 0;
+}
+
+int sector_cache_read(sector_cache_t *cache, uint8_t *buff, uint32_t sector, uint32_t count) {
+    uint32_t offs;
+    uint32_t n;
+    uint8_t mask;
+    int res;
+    int i;
+    if (sector_cache_bypass(cache, sector, count))
+        return sector_cache_read_direct(cache, buff, sector, count);
+    while (count) {
+        offs = sector & (cache->line_sectors - 1);
+        n = cache->line_sectors - offs;
+        if (n > count)
+            n = count;
+        mask = sector_cache_mask(offs, n);
+        if (sector_cache_bypass(cache, sector, n)) {
+            if ((res = sector_cache_read_direct(cache, buff, sector, n)) != 0)
+                return res;
+        } else {
+            i = sector_cache_find(cache, sector);
+            if ((i >= 0) && ((cache->line[i].valid & mask) == mask))
+                cache->hits += n;
+            else if ((res = sector_cache_load(cache, sector, &i)) != 0)
+                return res;
+            memcpy(buff, sector_cache_ptr(cache, i, offs), n * SECTOR_SIZE);
+            sector_cache_touch(cache, i);
+        }
+        buff += n * SECTOR_SIZE;
+        sector += n;
+        count -= n;
+    }
+    return 0;
+}
+
+int sector_cache_write(sector_cache_t *cache, const uint8_t *buff, uint32_t sector, uint32_t count) {
+    uint32_t offs;
+    uint32_t n;
+    uint8_t mask;
+    int res;
+    int i;
+    if (sector_cache_bypass(cache, sector, count))
+        return sector_cache_write_direct(cache, buff, sector, count);
+    while (count) {
+        offs = sector & (cache->line_sectors - 1);
+        n = cache->line_sectors - offs;
+        if (n > count)
+            n = count;
+        mask = sector_cache_mask(offs, n);
+        if (sector_cache_bypass(cache, sector, n)) {
+            if ((res = sector_cache_write_direct(cache, buff, sector, n)) != 0)
+                return res;
+        } else {
+            if ((i = sector_cache_find(cache, sector)) >= 0)
+                cache->hits += n;
+            else if ((res = sector_cache_evict(cache, sector, &i)) != 0)
+                return res;
+            memcpy(sector_cache_ptr(cache, i, offs), buff, n * SECTOR_SIZE);
+            cache->line[i].valid |= mask;
+            cache->line[i].dirty |= mask;
+            sector_cache_touch(cache, i);
+        }
+        buff += n * SECTOR_SIZE;
+        sector += n;
+        count -= n;
+    }
+    return 0;
+}
+
+int sector_cache_flush(sector_cache_t *cache) {
+    int res;
+    int i;
+    for (i = 0; i < cache->lines; i++)
+        if ((res = sector_cache_clean(cache, i)) != 0)
+            return res;
+    return 0;
+}
@@ -0,0 +1,62 @@
+// sector_cache.h - LRU block cache with read-ahead and write coalescing for block devices
+#ifndef _SECTOR_CACHE_H
+#define _SECTOR_CACHE_H
+
+#include <inttypes.h>
+
+// Cache line holds sector_cache_t.line_sectors consecutive sectors aligned to line size.
+// Small reads fill whole lines in one device transaction (read-ahead), small writes are
+// collected in lines (write-back) and written as runs of consecutive sectors on eviction
+// or flush. Transfers of at least one line size bypass the cache.
+// Device is accessed only through callbacks, so the cache is independent of USB/FatFS.
+
+#define SECTOR_CACHE_SECTOR_SIZE 512
+#define SECTOR_CACHE_LINE_MAX    8 // max. sectors per line (bit masks are uint8_t)
+
+// device read/write callback, returns 0 on success or error code (passed to caller)
+typedef int(sector_cache_io_t)(uint8_t *buff, uint32_t sector, uint32_t count);
+
+typedef struct _sector_cache_line_t {
+    uint32_t sector; // first sector (aligned to line size)
+    uint32_t used;   // LRU stamp
+    uint8_t valid;   // valid sectors mask
+    uint8_t dirty;   // modified sectors mask
+} sector_cache_line_t;
+
+typedef struct _sector_cache_t {
+    sector_cache_io_t *read;   // device read
+    sector_cache_io_t *write;  // device write
+    sector_cache_line_t *line; // line descriptors
+    uint8_t *data;             // line data (lines * line_sectors * SECTOR_CACHE_SECTOR_SIZE)
+    uint8_t lines;             // number of lines
+    uint8_t line_sectors;      // sectors per line, power of 2 up to SECTOR_CACHE_LINE_MAX
+    uint32_t sector_count;     // device size [sectors], 0 = cache disabled (all transfers bypass)
+    uint32_t clock;            // LRU clock
+    uint32_t hits;             // sectors read or written from/to cache
+    uint32_t transfers;        // device transactions
+} sector_cache_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// initialize cache with static storage, cache is disabled until sector_cache_reset
+extern void sector_cache_init(sector_cache_t *cache, sector_cache_line_t *line, uint8_t *data, uint8_t lines, uint8_t line_sectors, sector_cache_io_t *read, sector_cache_io_t *write);
+
+// drop all lines including unwritten data (media change), sector_count 0 disables cache
+extern void sector_cache_reset(sector_cache_t *cache, uint32_t sector_count);
+
+// read count sectors to buff
+extern int sector_cache_read(sector_cache_t *cache, uint8_t *buff, uint32_t sector, uint32_t count);
+
+// write count sectors from buff (buffered in cache when smaller than line)
+extern int sector_cache_write(sector_cache_t *cache, const uint8_t *buff, uint32_t sector, uint32_t count);
+
+// write all modified sectors to device
+extern int sector_cache_flush(sector_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //_SECTOR_CACHE_H
@@ -7,6 +7,10 @@
     #include "sim_motion.h"
     #include "../Marlin/src/module/stepper.h"
     #include "dbg.h"
+    #ifdef SIM_MOTION_TRACE
+        #include "stm32f4xx_hal.h"
+        #include "ff.h"
+    #endif //SIM_MOTION_TRACE
 
     #define BUFF_SIZE 256
 
@@ -22,7 +26,116 @@ uint8_t sim_motion_buff[BUFF_SIZE];
 int sim_motion_bufc = 0;
 int sim_motion_bufi = 0;
 
+    #ifdef SIM_MOTION_TRACE
+
+        #define SIM_MOTION_TRACE_MASK      (SIM_MOTION_TRACE_SIZE - 1)
+        #define SIM_MOTION_TRACE_TICK_MASK (0xffffffff >> SIM_MOTION_TRACE_SHIFT)
+
+static uint8_t sim_motion_trace_buff[SIM_MOTION_TRACE_SIZE];
+static volatile uint32_t sim_motion_trace_wr = 0; // write index (free running)
+static volatile uint32_t sim_motion_trace_rd = 0; // read index (free running)
+static uint32_t sim_motion_trace_last = 0;        // timestamp of last record
+static uint32_t sim_motion_trace_lost_cnt = 0;    // records lost (full ring)
+static uint8_t sim_motion_trace_sync = 0;         // next record is sync record
+static uint8_t sim_motion_trace_active = 0;       // recording enabled
+static int32_t sim_motion_trace_pos0[4];          // positions at trace start
+
+static inline uint32_t sim_motion_trace_tick(void) {
+    return DWT->CYCCNT >> SIM_MOTION_TRACE_SHIFT;
+}
+
+// called from step isr, record is written only if it fits as a whole
+static void sim_motion_trace_put(uint8_t axis, uint8_t dir) {
+    uint8_t rec[6];
+    int cnt = 0;
+    uint32_t tick = sim_motion_trace_tick();
+    uint32_t flg = axis | (dir ? SIM_MOTION_TRACE_FLG_DIR : 0);
+    uint64_t val;
+    if (sim_motion_trace_sync)
+        val = ((uint64_t)tick << 4) | SIM_MOTION_TRACE_FLG_SYNC | flg;
+    else
+        val = ((uint64_t)((tick - sim_motion_trace_last) & SIM_MOTION_TRACE_TICK_MASK) << 4) | flg;
+    do {
+        rec[cnt++] = (val & 0x7f) | ((val > 0x7f) ? 0x80 : 0);
+        val >>= 7;
+    } while (val);
+    if ((SIM_MOTION_TRACE_SIZE - (sim_motion_trace_wr - sim_motion_trace_rd)) < (uint32_t)cnt) {
+        sim_motion_trace_lost_cnt++;
+        sim_motion_trace_sync = 1;
+        return;
+    }
+    for (int i = 0; i < cnt; i++)
+        sim_motion_trace_buff[(sim_motion_trace_wr + i) & SIM_MOTION_TRACE_MASK] = rec[i];
+    sim_motion_trace_wr += cnt;
+    sim_motion_trace_last = tick;
+    sim_motion_trace_sync = 0;
+}
+
+void sim_motion_trace_start(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    sim_motion_trace_active = 0;
+    sim_motion_trace_rd = sim_motion_trace_wr;
+    sim_motion_trace_lost_cnt = 0;
+    sim_motion_trace_sync = 1;
+    for (int i = 0; i < 4; i++)
+        sim_motion_trace_pos0[i] = sim_motion_pos[i];
+    sim_motion_trace_active = 1;
+}
+
+void sim_motion_trace_stop(void) {
+    sim_motion_trace_active = 0;
+}
+
+int sim_motion_trace_read(uint8_t *data, int size) {
+    uint32_t rd = sim_motion_trace_rd;
+    int cnt = sim_motion_trace_wr - rd;
+    if (cnt > size)
+        cnt = size;
+    for (int i = 0; i < cnt; i++)
+        data[i] = sim_motion_trace_buff[(rd + i) & SIM_MOTION_TRACE_MASK];
+    sim_motion_trace_rd = rd + cnt;
+    return cnt;
+}
+
+uint32_t sim_motion_trace_lost(void) {
+    return sim_motion_trace_lost_cnt;
+}
+
+int sim_motion_trace_save(const char *fn) {
+    FIL fil;
+    UINT bw;
+    uint8_t buff[512];
+    int cnt;
+    int ret = 0;
+    if (f_open(&fil, fn, FA_WRITE | FA_OPEN_ALWAYS) != FR_OK)
+        return 0;
+    if (f_size(&fil) == 0) {
+        sim_motion_trace_hdr_t hdr;
+        hdr.magic = SIM_MOTION_TRACE_MAGIC;
+        hdr.tick_freq = SystemCoreClock >> SIM_MOTION_TRACE_SHIFT;
+        for (int i = 0; i < 4; i++)
+            hdr.pos[i] = sim_motion_trace_pos0[i];
+        if ((f_write(&fil, &hdr, sizeof(hdr), &bw) != FR_OK) || (bw != sizeof(hdr)))
+            goto _e_0;
+    } else if (f_lseek(&fil, f_size(&fil)) != FR_OK)
+        goto _e_0;
+    ret = 1;
+    while (ret && ((cnt = sim_motion_trace_read(buff, sizeof(buff))) > 0))
+        ret = (f_write(&fil, buff, cnt, &bw) == FR_OK) && (bw == (UINT)cnt);
+_e_0:
+    f_close(&fil);
+    return ret;
+}
+
+    #endif //SIM_MOTION_TRACE
+
 void sim_motion_cycle(void) {
+    #ifdef SIM_MOTION_TRACE
+    // idle longer than half of tick range - delta would overflow, next record will be sync
+    if (sim_motion_trace_active && (((sim_motion_trace_tick() - sim_motion_trace_last) & SIM_MOTION_TRACE_TICK_MASK) > (SIM_MOTION_TRACE_TICK_MASK >> 1)))
+        sim_motion_trace_sync = 1;
+    #endif //SIM_MOTION_TRACE
     static uint8_t cnt = 0;
     static int32_t x0;
     static int32_t y0;
@@ -77,6 +190,10 @@ int sim_motion_get_max_end(uint8_t axis) {
 
 void sim_motion_set_stp(uint8_t axis, int state) {
     if (state) {
+    #ifdef SIM_MOTION_TRACE
+        if (sim_motion_trace_active)
+            sim_motion_trace_put(axis, ((sim_motion_stpdir ^ (sim_motion_invdir << 4)) & (0x10 << axis)) ? 1 : 0);
+    #endif //SIM_MOTION_TRACE
         if ((sim_motion_stpdir ^ (sim_motion_invdir << 4)) & (0x10 << axis)) {
             sim_motion_endstops &= ~(0x01 << axis); //clear min endstop
             sim_motion_pos[axis]++;                 //increment position
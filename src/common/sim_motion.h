@@ -27,6 +27,39 @@ extern void sim_motion_set_ena(uint8_t axis, int state);
 
 extern void sim_motion_print_buff(void);
 
+#ifdef SIM_MOTION_TRACE
+
+// trace record (LEB128 varint): value = (dt << 4) | (sync << 3) | (dir << 2) | axis
+// dt is timestamp delta from previous record in trace ticks (cycle counter >> SIM_MOTION_TRACE_SHIFT),
+// sync record carries absolute timestamp instead (first record and first record after overflow)
+    #define SIM_MOTION_TRACE_FLG_DIR  0x04
+    #define SIM_MOTION_TRACE_FLG_SYNC 0x08
+
+// trace file header
+typedef struct _sim_motion_trace_hdr_t {
+    uint32_t magic;     // "SMTR"
+    uint32_t tick_freq; // trace ticks per second
+    int32_t pos[4];     // axis positions at trace start [steps]
+} sim_motion_trace_hdr_t;
+
+    #define SIM_MOTION_TRACE_MAGIC 0x52544d53
+
+// start/restart recording (resets ring, enables cycle counter)
+extern void sim_motion_trace_start(void);
+
+extern void sim_motion_trace_stop(void);
+
+// drain recorded bytes, returns number of bytes copied
+extern int sim_motion_trace_read(uint8_t *data, int size);
+
+// number of records lost due to full ring
+extern uint32_t sim_motion_trace_lost(void);
+
+// drain ring to file (appends, writes header if file is empty), returns 1 on success
+extern int sim_motion_trace_save(const char *fn);
+
+#endif //SIM_MOTION_TRACE
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
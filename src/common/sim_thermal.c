@@ -0,0 +1,117 @@
+// sim_thermal.c
+
+#include "sim_thermal.h"
+#include <string.h>
+
+#define SIM_THERMAL_STEP_SAFETY 0.5F // explicit euler stability margin
+#define SIM_THERMAL_STEP_MAX    0.1F // [s] sub-step limit for accuracy
+
+sim_thermal_cfg_t sim_thermal_cfg;
+
+static float sim_thermal_T[SIM_THERMAL_NODES];    // [K] node temperatures
+static float sim_thermal_duty[SIM_THERMAL_NODES]; // heater duty
+static float sim_thermal_fan = 0;                 // part cooling fan duty
+static float sim_thermal_vex = 0;                 // [mm/s] extrusion speed
+static float sim_thermal_dt_max = 0;              // [s] sub-step, updated from configuration
+
+// largest stable sub-step: C / sum(G) of the fastest node, with fan at full speed
+static float sim_thermal_calc_dt_max(void) {
+    float Gsum[SIM_THERMAL_NODES];
+    float dt = SIM_THERMAL_STEP_MAX;
+    float dt_node;
+    int i;
+    memset(Gsum, 0, sizeof(Gsum));
+    for (i = 0; i < SIM_THERMAL_LINKS; i++) {
+        const sim_thermal_link_t *pl = sim_thermal_cfg.link + i;
+        Gsum[pl->a] += pl->G + pl->Gfan;
+        if (pl->b != SIM_THERMAL_AMBIENT)
+            Gsum[pl->b] += pl->G + pl->Gfan;
+    }
+    for (i = 0; i < SIM_THERMAL_NODES; i++)
+        if (Gsum[i] > 0) {
+            dt_node = SIM_THERMAL_STEP_SAFETY * sim_thermal_cfg.C[i] / Gsum[i];
+            if (dt_node < dt)
+                dt = dt_node;
+        }
+    if ((sim_thermal_cfg.dt_max > 0) && (sim_thermal_cfg.dt_max < dt))
+        dt = sim_thermal_cfg.dt_max;
+    return dt;
+}
+
+void sim_thermal_init(void) {
+    //heater block and sensor (MINI hotend)
+    sim_thermal_cfg.C[SIM_THERMAL_NOZZLE] = 10.4F;       // [J/K]
+    sim_thermal_cfg.C[SIM_THERMAL_NOZZLE_SENSOR] = 0.6F; // [J/K]
+    sim_thermal_cfg.Pmax[SIM_THERMAL_NOZZLE] = 40.0F;    // [W]
+    sim_thermal_cfg.Pmax[SIM_THERMAL_NOZZLE_SENSOR] = 0;
+    //heatbed and sensor
+    sim_thermal_cfg.C[SIM_THERMAL_BED] = 150.0F;      // [J/K]
+    sim_thermal_cfg.C[SIM_THERMAL_BED_SENSOR] = 0.2F; // [J/K]
+    sim_thermal_cfg.Pmax[SIM_THERMAL_BED] = 100.0F;   // [W]
+    sim_thermal_cfg.Pmax[SIM_THERMAL_BED_SENSOR] = 0;
+    //links (G = 1/R)
+    sim_thermal_cfg.link[0] = (sim_thermal_link_t) { SIM_THERMAL_NOZZLE, SIM_THERMAL_AMBIENT, 1 / 22.0F, 0.03F };
+    sim_thermal_cfg.link[1] = (sim_thermal_link_t) { SIM_THERMAL_NOZZLE, SIM_THERMAL_NOZZLE_SENSOR, 1 / 9.0F, 0 };
+    sim_thermal_cfg.link[2] = (sim_thermal_link_t) { SIM_THERMAL_BED, SIM_THERMAL_AMBIENT, 1 / 0.8F, 0.05F };
+    sim_thermal_cfg.link[3] = (sim_thermal_link_t) { SIM_THERMAL_BED, SIM_THERMAL_BED_SENSOR, 1 / 50.0F, 0 };
+    sim_thermal_cfg.Ta = 298.15F; // [K]
+    sim_thermal_cfg.Ex = 0.2F;    // [J/mm]
+    sim_thermal_cfg.dt_max = 0;
+    sim_thermal_reset();
+}
+
+void sim_thermal_reset(void) {
+    int i;
+    for (i = 0; i < SIM_THERMAL_NODES; i++) {
+        sim_thermal_T[i] = sim_thermal_cfg.Ta;
+        sim_thermal_duty[i] = 0;
+    }
+    sim_thermal_fan = 0;
+    sim_thermal_vex = 0;
+    sim_thermal_dt_max = sim_thermal_calc_dt_max();
+}
+
+// one explicit euler step over all links and nodes
+static void sim_thermal_step(float h) {
+    float Q[SIM_THERMAL_NODES]; // [W] net heat flow into node
+    float Tb;
+    float P;
+    int i;
+    for (i = 0; i < SIM_THERMAL_NODES; i++)
+        Q[i] = sim_thermal_cfg.Pmax[i] * sim_thermal_duty[i];
+    Q[SIM_THERMAL_NOZZLE] -= sim_thermal_cfg.Ex * sim_thermal_vex;
+    for (i = 0; i < SIM_THERMAL_LINKS; i++) {
+        const sim_thermal_link_t *pl = sim_thermal_cfg.link + i;
+        Tb = (pl->b == SIM_THERMAL_AMBIENT) ? sim_thermal_cfg.Ta : sim_thermal_T[pl->b];
+        P = (pl->G + pl->Gfan * sim_thermal_fan) * (sim_thermal_T[pl->a] - Tb);
+        Q[pl->a] -= P;
+        if (pl->b != SIM_THERMAL_AMBIENT)
+            Q[pl->b] += P;
+    }
+    for (i = 0; i < SIM_THERMAL_NODES; i++)
+        sim_thermal_T[i] += Q[i] * h / sim_thermal_cfg.C[i];
+}
+
+void sim_thermal_cycle(float dt) {
+    int n = (int)(dt / sim_thermal_dt_max) + 1;
+    float h = dt / n;
+    while (n--)
+        sim_thermal_step(h);
+}
+
+void sim_thermal_set_power(uint8_t node, float duty) {
+    if (node < SIM_THERMAL_NODES)
+        sim_thermal_duty[node] = duty;
+}
+
+void sim_thermal_set_fan(float duty) {
+    sim_thermal_fan = duty;
+}
+
+void sim_thermal_set_extrusion(float vex) {
+    sim_thermal_vex = vex;
+}
+
+float sim_thermal_get_temp(uint8_t node) {
+    return (node < SIM_THERMAL_NODES) ? sim_thermal_T[node] : sim_thermal_cfg.Ta;
+}
@@ -0,0 +1,70 @@
+// sim_thermal.h - lumped-capacitance thermal model (nozzle, bed, ambient, part cooling fan)
+#ifndef _SIM_THERMAL_H
+#define _SIM_THERMAL_H
+
+#include <inttypes.h>
+
+//thermal nodes
+#define SIM_THERMAL_NOZZLE        0 // heater block
+#define SIM_THERMAL_NOZZLE_SENSOR 1 // nozzle thermistor
+#define SIM_THERMAL_BED           2 // heatbed
+#define SIM_THERMAL_BED_SENSOR    3 // bed thermistor
+#define SIM_THERMAL_NODES         4
+
+#define SIM_THERMAL_AMBIENT 0xff // link to ambient (infinite capacity)
+
+#define SIM_THERMAL_LINKS 4
+
+#pragma pack(push)
+#pragma pack(1)
+
+typedef struct _sim_thermal_link_t {
+    uint8_t a;  // node index
+    uint8_t b;  // node index or SIM_THERMAL_AMBIENT
+    float G;    // [W/K] thermal conductance
+    float Gfan; // [W/K] additional conductance at full part cooling fan speed
+} sim_thermal_link_t;
+
+typedef struct _sim_thermal_cfg_t {
+    float C[SIM_THERMAL_NODES];                   // [J/K] node heat capacities
+    float Pmax[SIM_THERMAL_NODES];                // [W] heater power at full pwm (0 for passive nodes)
+    sim_thermal_link_t link[SIM_THERMAL_LINKS];   // thermal links
+    float Ta;                                     // [K] ambient temperature
+    float Ex;                                     // [J/mm] extrusion energy factor (nozzle)
+    float dt_max;                                 // [s] integrator sub-step limit, 0 = from stability
+} sim_thermal_cfg_t;
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+extern sim_thermal_cfg_t sim_thermal_cfg;
+
+// load default MINI parameters and reset to ambient
+extern void sim_thermal_init(void);
+
+// reset all node temperatures to ambient (keeps configuration)
+extern void sim_thermal_reset(void);
+
+// advance model by dt [s], sub-stepped internally
+extern void sim_thermal_cycle(float dt);
+
+// heater power in range 0..1 (pwm duty)
+extern void sim_thermal_set_power(uint8_t node, float duty);
+
+// part cooling fan in range 0..1
+extern void sim_thermal_set_fan(float duty);
+
+// extrusion speed [mm/s] (filament cooling the nozzle, from sim_motion E axis)
+extern void sim_thermal_set_extrusion(float vex);
+
+// node temperature [K]
+extern float sim_thermal_get_temp(uint8_t node);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif // _SIM_THERMAL_H
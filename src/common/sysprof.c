@@ -0,0 +1,137 @@
+// sysprof.c
+
+#include "sysprof.h"
+#include "stm32f4xx_hal.h"
+#include "cmsis_os.h"
+#include <string.h>
+
+// previous run-time counter of task (tasks are matched by handle)
+typedef struct _sysprof_prev_t {
+    TaskHandle_t handle;
+    uint32_t runtime;
+} sysprof_prev_t;
+
+static sysprof_t sysprof;                                  // last complete sample
+static TaskStatus_t sysprof_status[SYSPROF_MAX_TASKS];     // uxTaskGetSystemState output
+static sysprof_prev_t sysprof_prev[SYSPROF_MAX_TASKS];     // counters at previous sample
+static uint32_t sysprof_prev_total = 0;                    // total counter at previous sample
+static uint32_t sysprof_last_tick = 0;                     // tick of previous sample
+static volatile uint32_t sysprof_isr_cycles = 0;           // isr cycles in current period
+static volatile uint32_t sysprof_isr_count = 0;            // isr calls in current period
+static volatile uint32_t sysprof_isr_max_cycles = 0;       // longest isr in current period
+static uint8_t sysprof_server_queue_max = 0;
+static uint8_t sysprof_client_queue_max[MARLIN_MAX_CLIENTS] = { 0 };
+
+extern osMessageQId marlin_server_queue;                    // marlin_server.cpp
+extern osMessageQId marlin_client_queue[MARLIN_MAX_CLIENTS]; // marlin_client.c
+
+void sysprof_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t sysprof_isr_begin(void) {
+    return DWT->CYCCNT;
+}
+
+void sysprof_isr_end(uint32_t begin) {
+    const uint32_t cycles = DWT->CYCCNT - begin;
+    sysprof_isr_cycles += cycles;
+    sysprof_isr_count++;
+    if (cycles > sysprof_isr_max_cycles)
+        sysprof_isr_max_cycles = cycles;
+}
+
+static uint32_t sysprof_prev_runtime(TaskHandle_t handle) {
+    for (int i = 0; i < SYSPROF_MAX_TASKS; i++)
+        if (sysprof_prev[i].handle == handle)
+            return sysprof_prev[i].runtime;
+    return 0; // new task, counter started at zero
+}
+
+// cycles to 0.1us
+static uint16_t sysprof_cycles_to_us10(uint32_t cycles) {
+    const uint32_t us10 = (uint32_t)(((uint64_t)cycles * 10000000) / SystemCoreClock);
+    return (us10 > 0xffff) ? 0xffff : us10;
+}
+
+static uint8_t sysprof_queue_depth(osMessageQId queue) {
+    const uint32_t depth = queue ? osMessageWaiting(queue) : 0;
+    return (depth > 0xff) ? 0xff : depth;
+}
+
+void sysprof_cycle(void) {
+    static sysprof_t sample; // not on stack
+    static sysprof_prev_t prev[SYSPROF_MAX_TASKS];
+    uint32_t total;
+    uint32_t tick = HAL_GetTick();
+    if ((tick - sysprof_last_tick) < SYSPROF_PERIOD)
+        return;
+    sysprof_last_tick = tick;
+
+    // queues are sampled before the (relatively long) task scan
+    memset(&sample, 0, sizeof(sample));
+    sample.server_queue = sysprof_queue_depth(marlin_server_queue);
+    if (sample.server_queue > sysprof_server_queue_max)
+        sysprof_server_queue_max = sample.server_queue;
+    sample.server_queue_max = sysprof_server_queue_max;
+    for (int i = 0; i < MARLIN_MAX_CLIENTS; i++) {
+        sample.client_queue[i] = sysprof_queue_depth(marlin_client_queue[i]);
+        if (sample.client_queue[i] > sysprof_client_queue_max[i])
+            sysprof_client_queue_max[i] = sample.client_queue[i];
+        sample.client_queue_max[i] = sysprof_client_queue_max[i];
+    }
+
+    // tasks, counters are free running 32bit (wrap safe differences)
+    // uxTaskGetSystemState fills nothing and returns 0 when the array is too small
+    configASSERT(uxTaskGetNumberOfTasks() <= SYSPROF_MAX_TASKS);
+    const UBaseType_t count = uxTaskGetSystemState(sysprof_status, SYSPROF_MAX_TASKS, &total);
+    const uint32_t period = total - sysprof_prev_total;
+    uint32_t idle = 0;
+    sysprof_prev_total = total;
+    for (UBaseType_t i = 0; i < count; i++) {
+        TaskStatus_t *status = sysprof_status + i;
+        sysprof_task_t *task = sample.task + i;
+        const uint32_t runtime = status->ulRunTimeCounter - sysprof_prev_runtime(status->xHandle);
+        prev[i].handle = status->xHandle;
+        prev[i].runtime = status->ulRunTimeCounter;
+        strncpy(task->name, status->pcTaskName, SYSPROF_NAME_LEN - 1);
+        task->cpu = period ? (uint16_t)(((uint64_t)runtime * 1000) / period) : 0;
+        task->stack_free = status->usStackHighWaterMark * sizeof(StackType_t);
+        task->priority = status->uxCurrentPriority;
+        if (strcmp(status->pcTaskName, "IDLE") == 0) // FreeRTOS idle task (not app idleTask)
+            idle = runtime;
+    }
+    memcpy(sysprof_prev, prev, sizeof(prev));
+    memset(prev, 0, sizeof(prev));
+    sample.task_count = count;
+    sample.cpu = period ? (uint16_t)(1000 - ((uint64_t)idle * 1000) / period) : 0;
+
+    // isr, counters are reset for next period
+    taskENTER_CRITICAL();
+    const uint32_t isr_cycles = sysprof_isr_cycles;
+    const uint32_t isr_count = sysprof_isr_count;
+    const uint32_t isr_max = sysprof_isr_max_cycles;
+    sysprof_isr_cycles = sysprof_isr_count = sysprof_isr_max_cycles = 0;
+    taskEXIT_CRITICAL();
+    sample.isr_load = period ? (uint16_t)(((uint64_t)isr_cycles * 1000) / period) : 0;
+    sample.isr_avg = isr_count ? sysprof_cycles_to_us10(isr_cycles / isr_count) : 0;
+    sample.isr_max = sysprof_cycles_to_us10(isr_max);
+
+    sample.heap_size = configTOTAL_HEAP_SIZE;
+    sample.heap_free = xPortGetFreeHeapSize();
+    sample.heap_min_free = xPortGetMinimumEverFreeHeapSize();
+    sample.heap_max_block = xPortGetLargestFreeBlockSize();
+
+    taskENTER_CRITICAL();
+    sample.seq = sysprof.seq + 1;
+    memcpy(&sysprof, &sample, sizeof(sysprof_t));
+    taskEXIT_CRITICAL();
+}
+
+void sysprof_get(sysprof_t *prof) {
+    taskENTER_CRITICAL();
+    memcpy(prof, &sysprof, sizeof(sysprof_t));
+    taskEXIT_CRITICAL();
+}
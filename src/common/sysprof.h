@@ -0,0 +1,64 @@
+// sysprof.h - runtime cpu/stack/heap/queue profiler
+#ifndef _SYSPROF_H
+#define _SYSPROF_H
+
+#include <inttypes.h>
+#include "config.h"
+
+#define SYSPROF_PERIOD    1000 // sampling period [ms], must be shorter than DWT counter overflow (25s)
+#define SYSPROF_MAX_TASKS 12   // must stay above number of tasks (10), asserted in sysprof_cycle
+#define SYSPROF_NAME_LEN  16   // configMAX_TASK_NAME_LEN
+
+#pragma pack(push)
+#pragma pack(1)
+
+typedef struct _sysprof_task_t {
+    char name[SYSPROF_NAME_LEN]; // task name
+    uint16_t cpu;                // cpu load in last period [0.1%]
+    uint16_t stack_free;         // stack high-water mark (min. free ever) [bytes]
+    uint8_t priority;            // current priority
+} sysprof_task_t;
+
+typedef struct _sysprof_t {
+    uint32_t seq;                               // sample number (incremented every period)
+    uint16_t cpu;                               // total cpu load (all tasks except idle) [0.1%]
+    uint16_t isr_load;                          // 1ms tick isr (TIM14) load [0.1%]
+    uint16_t isr_avg;                           // 1ms tick isr average duration [0.1us]
+    uint16_t isr_max;                           // 1ms tick isr max. duration in last period [0.1us]
+    uint32_t heap_size;                         // total heap size [bytes]
+    uint32_t heap_free;                         // current free heap [bytes]
+    uint32_t heap_min_free;                     // min. free heap ever [bytes]
+    uint32_t heap_max_block;                    // largest free block (fragmentation) [bytes]
+    uint8_t server_queue;                       // marlin server queue depth [chars]
+    uint8_t server_queue_max;                   // max. sampled server queue depth
+    uint8_t client_queue[MARLIN_MAX_CLIENTS];   // marlin client queue depths [messages]
+    uint8_t client_queue_max[MARLIN_MAX_CLIENTS]; // max. sampled client queue depths
+    uint8_t task_count;                         // number of valid task records
+    sysprof_task_t task[SYSPROF_MAX_TASKS];     // per task data
+} sysprof_t;
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+// enable DWT cycle counter (called by scheduler as portCONFIGURE_TIMER_FOR_RUN_TIME_STATS)
+extern void sysprof_init(void);
+
+// take sample when period elapsed (call periodically from any low-priority thread)
+extern void sysprof_cycle(void);
+
+// copy last sample (thread safe)
+extern void sysprof_get(sysprof_t *prof);
+
+// 1ms tick isr timing, begin returns timestamp for end
+extern uint32_t sysprof_isr_begin(void);
+
+extern void sysprof_isr_end(uint32_t begin);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //_SYSPROF_H
@@ -3,6 +3,7 @@
 #include "cmsis_os.h" //osDelay
 #include "filament_sensor.h"
 #include "marlin_client.h"
+#include "sysprof.h"
 
 void StartMeasurementTask(void const *argument) {
     marlin_client_init();
@@ -11,6 +12,7 @@ void StartMeasurementTask(void const *argument) {
     for (;;) {
         marlin_client_loop();
         fs_cycle();
+        sysprof_cycle();
         osDelay(50); //have to wait at least few us, 1ms is very safe
     }
 }
@@ -9,6 +9,7 @@
 
 #include <w25x.h>
 #include "main.h"
+#include "cmsis_os.h"
 
 #define _MFRID     0xEF
 #define _DEVID     0x13
@@ -54,7 +55,13 @@ static inline uint8_t spi_txrx(uint8_t tx) {
 
 int w25x_mfrid_devid(void);
 
+static osSemaphoreId w25x_sema = 0; // thread access lock
+
 int8_t w25x_init(void) {
+    if (w25x_sema == 0) { // first call is at startup (single thread)
+        osSemaphoreDef(w25xSema);
+        w25x_sema = osSemaphoreCreate(osSemaphore(w25xSema), 1);
+    }
     //PIN_OUT(W25X20CL_PIN_CS);
     _CS_HIGH();
     W25X_SPI_ENTER();
@@ -178,3 +185,15 @@ void w25x_wait_busy(void) {
     while (w25x_rd_status_reg() & W25X_STATUS_BUSY)
         ;
 }
+
+void w25x_lock(void) {
+    osSemaphoreWait(w25x_sema, osWaitForever);
+}
+
+int w25x_try_lock(void) {
+    return osSemaphoreWait(w25x_sema, 0) == osOK;
+}
+
+void w25x_unlock(void) {
+    osSemaphoreRelease(w25x_sema);
+}
@@ -33,6 +33,12 @@ extern void w25x_page_program(uint32_t addr, uint8_t *data, uint16_t cnt);
 extern void w25x_rd_uid(uint8_t *uid);
 extern void w25x_wait_busy(void);
 
+// exclusive access from different threads (journal, dump save), not for isr and fault handlers
+extern void w25x_lock(void);
+// non-blocking lock, returns 1 when locked
+extern int w25x_try_lock(void);
+extern void w25x_unlock(void);
+
 #if defined(__cplusplus)
 }
 #endif //defined(__cplusplus)
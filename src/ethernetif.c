@@ -61,8 +61,10 @@
 /* Within 'USER CODE' section, code will be kept by default at each generation */
 /* USER CODE BEGIN 0 */
 #include "lwip/netifapi.h"
+#include "lwip/sys.h"
 #include "otp.h"
 #include "eeprom.h"
+#include "eth_tx.h"
 #include <stdbool.h>
 /* USER CODE END 0 */
 
@@ -76,7 +78,11 @@
 #define IFNAME1 'R'
 
 /* USER CODE BEGIN 1 */
-
+/* Zero-copy: received frames are passed to lwIP in DMA buffers (custom pbufs), the descriptor
+ * gets a spare buffer instead. When lwIP holds all spare buffers, frames are copied to PBUF_POOL.
+ * Transmitted pbufs in DMA accessible RAM are chained to descriptors and freed after transmission. */
+#define ETH_RX_BUF_SPARE 6                                // rx buffers which can be held by lwIP
+#define ETH_RX_BUF_COUNT (ETH_RXBUFNB + ETH_RX_BUF_SPARE) // descriptor ring + spare
 /* USER CODE END 1 */
 
 /* Private variables ---------------------------------------------------------*/
@@ -93,7 +99,7 @@ __ALIGN_BEGIN ETH_DMADescTypeDef DMATxDscrTab[ETH_TXBUFNB] __ALIGN_END; /* Ether
 #if defined(__ICCARM__) /*!< IAR Compiler */
     #pragma data_alignment = 4
 #endif
-__ALIGN_BEGIN uint8_t Rx_Buff[ETH_RXBUFNB][ETH_RX_BUF_SIZE] __ALIGN_END; /* Ethernet Receive Buffer */
+__ALIGN_BEGIN uint8_t Rx_Buff[ETH_RX_BUF_COUNT][ETH_RX_BUF_SIZE] __ALIGN_END; /* Ethernet Receive Buffer */
 
 #if defined(__ICCARM__) /*!< IAR Compiler */
     #pragma data_alignment = 4
@@ -101,7 +107,15 @@ __ALIGN_BEGIN uint8_t Rx_Buff[ETH_RXBUFNB][ETH_RX_BUF_SIZE] __ALIGN_END; /* Ethe
 __ALIGN_BEGIN uint8_t Tx_Buff[ETH_TXBUFNB][ETH_TX_BUF_SIZE] __ALIGN_END; /* Ethernet Transmit Buffer */
 
 /* USER CODE BEGIN 2 */
+// rx buffer lent to lwIP as custom pbuf
+typedef struct _eth_rx_pbuf_t {
+    struct pbuf_custom pc; // must be first, pbuf pointer is cast to eth_rx_pbuf_t
+    uint8_t *buffer;
+    struct _eth_rx_pbuf_t *next; // free list
+} eth_rx_pbuf_t;
 
+static eth_rx_pbuf_t eth_rx_pbuf[ETH_RX_BUF_COUNT]; // index = Rx_Buff index
+static eth_rx_pbuf_t *eth_rx_free = NULL;            // spare buffers (neither in descriptor ring nor in lwIP)
 /* USER CODE END 2 */
 
 /* Semaphore to signal incoming packets */
@@ -208,6 +222,15 @@ void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth) {
     osSemaphoreRelease(s_xSemaphore);
 }
 
+/**
+  * @brief  Ethernet Tx Transfer completed callback (zero-copy frame sent)
+  * @param  heth: ETH handle
+  * @retval None
+  */
+void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth) {
+    osSemaphoreRelease(s_xSemaphore);
+}
+
 /* USER CODE BEGIN 4 */
 void ethernetif_link(const void *arg) {
     struct netif *netif = (struct netif *)arg;
@@ -236,6 +259,45 @@ void ethernetif_link(const void *arg) {
     }
 }
 
+
+// custom pbuf free function, called from any thread
+static void eth_rx_pbuf_free(struct pbuf *p) {
+    eth_rx_pbuf_t *rx = (eth_rx_pbuf_t *)p;
+    SYS_ARCH_DECL_PROTECT(old_level);
+    SYS_ARCH_PROTECT(old_level);
+    rx->next = eth_rx_free;
+    eth_rx_free = rx;
+    SYS_ARCH_UNPROTECT(old_level);
+}
+
+static eth_rx_pbuf_t *eth_rx_pbuf_get(void) {
+    eth_rx_pbuf_t *rx;
+    SYS_ARCH_DECL_PROTECT(old_level);
+    SYS_ARCH_PROTECT(old_level);
+    rx = eth_rx_free;
+    if (rx != NULL)
+        eth_rx_free = rx->next;
+    SYS_ARCH_UNPROTECT(old_level);
+    return rx;
+}
+
+static void eth_rx_pbuf_init(void) {
+    uint32_t i;
+    for (i = 0; i < ETH_RX_BUF_COUNT; i++) {
+        eth_rx_pbuf[i].pc.custom_free_function = eth_rx_pbuf_free;
+        eth_rx_pbuf[i].buffer = Rx_Buff[i];
+        eth_rx_pbuf[i].next = NULL;
+        if (i >= ETH_RXBUFNB) // first ETH_RXBUFNB buffers are in descriptor ring
+            eth_rx_pbuf_free(&eth_rx_pbuf[i].pc.pbuf);
+    }
+}
+
+// descriptor buffer for copy mode (descriptor may point to pbuf payload after zero-copy frame)
+static uint8_t *eth_tx_buffer(__IO ETH_DMADescTypeDef *desc) {
+    uint8_t *buffer = Tx_Buff[desc - DMATxDscrTab];
+    desc->Buffer1Addr = (uint32_t)buffer;
+    return buffer;
+}
 /* USER CODE END 4 */
 
 /*******************************************************************************
@@ -279,6 +341,12 @@ static void low_level_init(struct netif *netif) {
     /* Initialize Rx Descriptors list: Chain Mode  */
     HAL_ETH_DMARxDescListInit(&heth, DMARxDscrTab, &Rx_Buff[0][0], ETH_RXBUFNB);
 
+    /* USER CODE BEGIN DESCRIPTORS */
+    eth_rx_pbuf_init();
+    /* transmit interrupt (set for zero-copy frames only) */
+    __HAL_ETH_DMA_ENABLE_IT(&heth, ETH_DMA_IT_T);
+    /* USER CODE END DESCRIPTORS */
+
 #if LWIP_ARP || LWIP_ETHERNET
 
     /* set MAC hardware address length */
@@ -357,13 +425,21 @@ static void low_level_init(struct netif *netif) {
 static err_t low_level_output(struct netif *netif, struct pbuf *p) {
     err_t errval;
     struct pbuf *q;
-    uint8_t *buffer = (uint8_t *)(heth.TxDesc->Buffer1Addr);
+    uint8_t *buffer;
     __IO ETH_DMADescTypeDef *DmaTxDesc;
     uint32_t framelength = 0;
     uint32_t bufferoffset = 0;
     uint32_t byteslefttocopy = 0;
     uint32_t payloadoffset = 0;
+
+    eth_tx_reclaim();
+    if (eth_tx_zero_copy(&heth, p)) {
+        errval = ERR_OK;
+        goto error; // resume transmission
+    }
+
     DmaTxDesc = heth.TxDesc;
+    buffer = eth_tx_buffer(DmaTxDesc);
     bufferoffset = 0;
 
     /* copy frame from pbufs to driver buffers */
@@ -392,7 +468,7 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p) {
                 goto error;
             }
 
-            buffer = (uint8_t *)(DmaTxDesc->Buffer1Addr);
+            buffer = eth_tx_buffer(DmaTxDesc);
 
             byteslefttocopy = byteslefttocopy - (ETH_TX_BUF_SIZE - bufferoffset);
             payloadoffset = payloadoffset + (ETH_TX_BUF_SIZE - bufferoffset);
@@ -413,6 +489,12 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p) {
 
 error:
 
+    /* When Tx Buffer unavailable flag is set: clear it and resume transmission (zero-copy frame) */
+    if ((heth.Instance->DMASR & ETH_DMASR_TBUS) != (uint32_t)RESET) {
+        heth.Instance->DMASR = ETH_DMASR_TBUS;
+        heth.Instance->DMATPDR = 0;
+    }
+
     /* When Transmit Underflow flag is set, clear it and issue a Transmit Poll Demand to resume transmission */
     if ((heth.Instance->DMASR & ETH_DMASR_TUS) != (uint32_t)RESET) {
         /* Clear TUS ETHERNET DMA flag */
@@ -451,12 +533,21 @@ static struct pbuf *low_level_input(struct netif *netif) {
     len = heth.RxFrameInfos.length;
     buffer = (uint8_t *)heth.RxFrameInfos.buffer;
 
+    /* USER CODE BEGIN ZERO_COPY_RX */
+    eth_rx_pbuf_t *spare = NULL;
+    if ((len > 0) && (heth.RxFrameInfos.SegCount == 1) && ((spare = eth_rx_pbuf_get()) != NULL)) {
+        /* pass the DMA buffer to lwIP, descriptor gets the spare one */
+        eth_rx_pbuf_t *rx = &eth_rx_pbuf[(buffer - &Rx_Buff[0][0]) / ETH_RX_BUF_SIZE];
+        heth.RxFrameInfos.FSRxDesc->Buffer1Addr = (uint32_t)spare->buffer;
+        p = pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF, &rx->pc, rx->buffer, ETH_RX_BUF_SIZE);
+    } else
+    /* USER CODE END ZERO_COPY_RX */
     if (len > 0) {
         /* We allocate a pbuf chain of pbufs from the Lwip buffer pool */
         p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
     }
 
-    if (p != NULL) {
+    if ((p != NULL) && (spare == NULL)) {
         dmarxdesc = heth.RxFrameInfos.FSRxDesc;
         bufferoffset = 0;
         for (q = p; q != NULL; q = q->next) {
@@ -519,6 +610,7 @@ void ethernetif_input(void const *argument) {
 
     for (;;) {
         if (osSemaphoreWait(s_xSemaphore, TIME_WAITING_FOR_INPUT) == osOK) {
+            eth_tx_reclaim();
             do {
                 p = low_level_input(netif);
                 if (p != NULL) {
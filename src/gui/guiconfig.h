@@ -14,6 +14,9 @@
 //redraw (gui thread is waiting for this signal, window_0.draw is called)
 #define GUI_SIG_REDRAW 0x0001
 
+//jogwheel event queued (triggered from jogwheel interrupt, gui thread is waiting for this signal)
+#define GUI_SIG_JOGWHEEL 0x0002
+
 //st7789v - spi DMA transmit complete (triggered from callback, gui thread is waiting for this signal)
 #define ST7789V_SIG_SPI_TX 0x0008
 
@@ -15,6 +15,7 @@
 #include "screen_print_preview.h"
 #include "screen_printing.h"
 #include "print_utils.h"
+#include "print_journal.h"
 
 #include "../Marlin/src/sd/cardreader.h"
 
@@ -76,6 +77,7 @@ typedef struct
 #define pw ((screen_home_data_t *)screen->pdata)
 
 static bool find_latest_gcode(char *fpath, int fpath_len, char *fname, int fname_len);
+static bool screen_home_check_resume(void);
 void screen_home_disable_print_button(screen_t *screen);
 
 void screen_home_init(screen_t *screen) {
@@ -164,6 +166,8 @@ int screen_home_event(screen_t *screen, window_t *window, uint8_t event, void *p
         p_window_header_event_clr(&(pw->header), MARLIN_EVT_MediaInserted);
         p_window_header_event_clr(&(pw->header), MARLIN_EVT_MediaRemoved);
         p_window_header_event_clr(&(pw->header), MARLIN_EVT_MediaError);
+    } else if (screen_home_check_resume()) {
+        return 1;
     }
 
     if (p_window_header_event_clr(&(pw->header), MARLIN_EVT_MediaInserted) &&
@@ -253,6 +257,30 @@ static bool find_latest_gcode(char *fpath, int fpath_len, char *fname, int fname
     return result == FR_OK && fname[0] != 0 ? true : false;
 }
 
+// offer resume of print interrupted by power loss (found in journal at startup), once after media is ready
+static bool screen_home_check_resume(void) {
+    static bool checked = false;
+    static char path[JOURNAL_PATH_LEN];
+    journal_rec_t rec;
+    FILINFO finfo = { 0 };
+    if (checked || !IS_SD_INSERTED())
+        return false;
+    checked = true;
+    if (!journal_get_resume(&rec, path))
+        return false;
+    if ((strlen(path) >= sizeof(screen_printing_file_path)) || (f_stat(path, &finfo) != FR_OK))
+        return false; // different media, ask again after next start
+    if (gui_msgbox("The print was interrupted by power loss. Do you want to resume it?", MSGBOX_BTN_YESNO | MSGBOX_ICO_QUESTION) != MSGBOX_RES_YES) {
+        journal_discard_resume();
+        return false;
+    }
+    strcpy(screen_printing_file_path, path);
+    snprintf(screen_printing_file_name, sizeof(screen_printing_file_name), "%s", finfo.fname);
+    print_resume(&rec, screen_printing_file_path);
+    screen_open(pscreen_printing->id);
+    return true;
+}
+
 void screen_home_disable_print_button(screen_t *screen) {
     pw->w_buttons[0].win.f_disabled = 1;
     pw->w_buttons[0].win.f_enabled = 0; // cant't be focused
@@ -34,7 +34,7 @@ void screen_menu_move_init(screen_t *screen) {
     psmd->items[MI_MOVE_Z].item.wi_spin.value = (int32_t)(vars->pos[2] * 1000);
     if (vars->temp_nozzle < extrude_min_temp)
         psmd->items[MI_MOVE_E].item.type |= WI_DISABLED;
-    gui_timer_create_periodical(500, 0);
+    gui_timer_create_periodical(500, psmd->root.win.id); // deleted with screen windows
 }
 
 int screen_menu_move_event(screen_t *screen, window_t *window, uint8_t event, void *param) {
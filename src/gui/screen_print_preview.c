@@ -1,7 +1,9 @@
 #include "screen_print_preview.h"
+#include "config.h"
 #include "dbg.h"
 #include "ff.h"
 #include "gcode_file.h"
+#include "gcode_crc.h"
 #include "gui.h"
 #include "marlin_client.h"
 #include "resource.h"
@@ -22,7 +24,7 @@ typedef struct {
 typedef struct {
     window_frame_t frame;
     window_text_t title_text;
-    description_line_t description_lines[4];
+    description_line_t description_lines[5];
     window_icon_t print_button;
     window_text_t print_label;
     window_icon_t back_button;
@@ -34,6 +36,7 @@ typedef struct {
     char gcode_filament_type[8];
     unsigned gcode_filament_used_g;
     unsigned gcode_filament_used_mm;
+    uint8_t gcode_crc_state;
     bool redraw_thumbnail;
 } screen_print_preview_data_t;
 
@@ -166,18 +169,42 @@ static void initialize_description_lines(screen_t *screen, int y) {
             y += LINE_HEIGHT + LINE_SPACING;
         }
     }
+
+    // integrity check result of previous print (or pending verification)
+    switch (pd->gcode_crc_state) {
+    case GCODE_CRC_OK:
+        initialize_description_line(screen, line_idx++, y, "checksum", "ok");
+        break;
+    case GCODE_CRC_MISMATCH:
+        initialize_description_line(screen, line_idx++, y, "checksum", "MISMATCH");
+        break;
+    case GCODE_CRC_PENDING:
+        initialize_description_line(screen, line_idx++, y, "checksum", "not verified");
+        break;
+    }
+}
+
+static uint8_t gcode_file_crc_state(void) {
+#ifdef GCODE_CRC
+    gcode_crc_t crc;
+    return gcode_crc_open(&crc, gcode_file_path);
+#else
+    return GCODE_CRC_NONE;
+#endif //GCODE_CRC
 }
 
 static void initialize_gcode_file(screen_t *screen) {
     memset(&pd->gcode_file, 1, sizeof(FIL));
     pd->gcode_file_opened = false;
     pd->gcode_has_thumbnail = false;
+    pd->gcode_crc_state = GCODE_CRC_NONE;
 
     // try to open the file first
     if (!gcode_file_path || f_open(&pd->gcode_file, gcode_file_path, FA_READ) != FR_OK) {
         return;
     }
     pd->gcode_file_opened = true;
+    f_gcode_fast_seek_attach(&pd->gcode_file); // seeks to thumbnail and to end of file
 
     // thubnail presence check
     {
@@ -217,6 +244,8 @@ static void initialize_gcode_file(screen_t *screen) {
             sscanf(value_buffer, "%u", &pd->gcode_filament_used_g);
         }
     }
+
+    pd->gcode_crc_state = gcode_file_crc_state();
 }
 
 static void screen_print_preview_init(screen_t *screen) {
@@ -282,6 +311,7 @@ static void screen_print_preview_init(screen_t *screen) {
 
 static void screen_print_preview_done(screen_t *screen) {
     if (pd->gcode_file_opened) {
+        f_gcode_fast_seek_detach(&pd->gcode_file);
         f_close(&pd->gcode_file);
         pd->gcode_file_opened = false;
         pd->gcode_has_thumbnail = false;
@@ -14,6 +14,7 @@
 #include "filament.h"
 #include "screen_printing.h"
 #include "marlin_server.h"
+#include "print_estimate.h"
 
 #include "ffconf.h"
 
@@ -124,6 +125,7 @@ typedef struct
     char text_time[13];    // 999d 23h 30m\0
     char text_etime[9];    // 999X 23Y\0
     char text_filament[5]; // 999m\0 | 1.2m\0
+    char text_message[MSG_MAX_LENGTH];
 
     window_text_t w_message; //Messages from onStatusChanged()
     uint32_t message_timer;
@@ -213,6 +215,19 @@ struct pduration_t : duration_t {
 
 static void screen_printing_update_remaining_time_progress(screen_t *screen);
 
+#ifdef PRINT_ESTIMATE
+// fits text_etime (8 characters)
+static void screen_printing_format_etime(char *buffer, uint32_t seconds) {
+    const uint32_t m = seconds / 60, h = m / 60, d = h / 24;
+    if (d)
+        sprintf(buffer, "%lud %luh", (unsigned long)(d % 1000), (unsigned long)(h % 24));
+    else if (h)
+        sprintf(buffer, "%luh %lum", (unsigned long)h, (unsigned long)(m % 60));
+    else
+        sprintf(buffer, "%lum", (unsigned long)m);
+}
+#endif //PRINT_ESTIMATE
+
 void screen_printing_init(screen_t *screen) {
     marlin_error_clr(MARLIN_ERR_ProbingFailed);
     int16_t id;
@@ -349,7 +364,8 @@ static void open_popup_message(screen_t *screen) {
     window_hide(pw->w_time_label.win.id);
     window_hide(pw->w_time_value.win.id);
 
-    window_set_text(pw->w_message.win.id, msg_stack.msg_data[0]);
+    marlin_get_message(pw->text_message);
+    window_set_text(pw->w_message.win.id, pw->text_message);
 
     window_show(pw->w_message.win.id);
     pw->message_timer = HAL_GetTick();
@@ -527,7 +543,8 @@ void _state_loop(screen_t *screen) {
     //todo it is static, because menu tune is not dialog
     //switch (pw->state__readonly__use_change_print_state)
 
-    auto p_vars = marlin_update_vars(MARLIN_VAR_MSK(MARLIN_VAR_SD_PRINT));
+    // print speed can be changed by M220 from host, file position is polled only here (estimate)
+    auto p_vars = marlin_update_vars(MARLIN_VAR_MSK(MARLIN_VAR_SD_PRINT) | MARLIN_VAR_MSK(MARLIN_VAR_PRNSPEED) | MARLIN_VAR_MSK(MARLIN_VAR_SD_POS));
     switch (state__readonly__use_change_print_state) {
     case P_PRINTING:
         if ((!p_vars->sd_printing) && (marlin_command() != MARLIN_CMD_M600) && // prevent false trigering durring M600 TODO: better solution
@@ -563,6 +580,12 @@ static void screen_printing_update_remaining_time_progress(screen_t *screen) {
     } else {
         nPercent = marlin_vars()->sd_percent_done;
         strcpy_P(pw->text_etime, PSTR("N/A"));
+#ifdef PRINT_ESTIMATE
+        // no M73 in file, use pre-scan estimate (already scaled by print speed)
+        const int32_t remaining = estimate_remaining(marlin_vars()->sd_pos, marlin_vars()->print_speed);
+        if (remaining >= 0)
+            screen_printing_format_etime(pw->text_etime, remaining);
+#endif //PRINT_ESTIMATE
         pw->w_etime_value.color_text = COLOR_VALUE_VALID;
         pw->w_progress.color_text = COLOR_VALUE_INVALID;
         //_dbg(".progress: %d ???\r",nPercent);
@@ -11,7 +11,13 @@
 #include "stm32f4xx_hal.h"
 
 #include "sys.h"
-#include "../Middlewares/ST/Utilites/CPU/cpu_utils.h"
+#include "sysprof.h"
+#include <stdio.h>
+
+#define SYSINFO_ROWS      (4 + SYSPROF_MAX_TASKS)
+#define SYSINFO_ROW_LEN   35 // 34 characters of small font on 240px
+#define SYSINFO_ROW_H     16
+#define SYSINFO_ROW_TASKS 4 // first task row
 
 #pragma pack(push)
 #pragma pack(1)
@@ -20,8 +26,9 @@ typedef struct
 {
     window_frame_t frame;
     window_text_t textMenuName;
-    window_text_t textCPU_load;
-    window_numb_t textCPU_load_val;
+    window_text_t textRows[SYSINFO_ROWS];
+    char rows[SYSINFO_ROWS][SYSINFO_ROW_LEN];
+    uint32_t seq; // last displayed sysprof sample
 
     window_text_t textExit;
 } screen_sysinfo_data_t;
@@ -32,20 +39,41 @@ typedef struct
 /******************************************************************************************************/
 //variables
 
-static int actual_CPU_load = -1;
-static int last_CPU_load = -1;
+static sysprof_t sysinfo_prof; // not on stack
 
 /******************************************************************************************************/
 //methods
 
+static void screen_sysinfo_update(screen_t *screen) {
+    sysprof_t *prof = &sysinfo_prof;
+    int row;
+    int len;
+    sysprof_get(prof);
+    if (prof->seq == pd->seq)
+        return;
+    pd->seq = prof->seq;
+    snprintf(pd->rows[0], SYSINFO_ROW_LEN, "CPU %u.%u%%  tick isr %u.%u%%",
+        prof->cpu / 10, prof->cpu % 10, prof->isr_load / 10, prof->isr_load % 10);
+    snprintf(pd->rows[1], SYSINFO_ROW_LEN, "isr avg %u.%uus max %u.%uus",
+        prof->isr_avg / 10, prof->isr_avg % 10, prof->isr_max / 10, prof->isr_max % 10);
+    snprintf(pd->rows[2], SYSINFO_ROW_LEN, "heap %lu min %lu blk %lu",
+        (unsigned long)prof->heap_free, (unsigned long)prof->heap_min_free, (unsigned long)prof->heap_max_block);
+    len = snprintf(pd->rows[3], SYSINFO_ROW_LEN, "queue srv %u/%u cl", prof->server_queue, prof->server_queue_max);
+    for (int i = 0; (i < MARLIN_MAX_CLIENTS) && (len < SYSINFO_ROW_LEN); i++)
+        len += snprintf(pd->rows[3] + len, SYSINFO_ROW_LEN - len, " %u", prof->client_queue[i]);
+    for (row = 0; row < SYSPROF_MAX_TASKS; row++)
+        if (row < prof->task_count)
+            snprintf(pd->rows[SYSINFO_ROW_TASKS + row], SYSINFO_ROW_LEN, "%-14.14s %3u.%u%% %5u",
+                prof->task[row].name, prof->task[row].cpu / 10, prof->task[row].cpu % 10, prof->task[row].stack_free);
+        else
+            pd->rows[SYSINFO_ROW_TASKS + row][0] = 0;
+    for (row = 0; row < SYSINFO_ROWS; row++)
+        window_set_text(pd->textRows[row].win.id, pd->rows[row]);
+}
+
 /******************************************************************************************************/
 //column specifications
-enum { col_0 = 2,
-    col_1 = 96 };
-enum { col_0_w = col_1 - col_0,
-    col_1_w = 240 - col_1 - col_0 };
-enum { col_2_w = 38 };
-#define RECT_MACRO(col) rect_ui16(col_##col, row2draw, col_##col##_w, row_h)
+enum { col_0 = 2 };
 
 enum {
     TAG_QUIT = 10
@@ -55,26 +83,26 @@ enum {
 void screen_sysinfo_init(screen_t *screen) {
     int16_t row2draw = 0;
     int16_t id;
-    int16_t row_h = 20;
+    int row;
 
     int16_t id0 = window_create_ptr(WINDOW_CLS_FRAME, -1, rect_ui16(0, 0, 0, 0), &(pd->frame));
 
     id = window_create_ptr(WINDOW_CLS_TEXT, id0, rect_ui16(0, 0, display->w, 22), &(pd->textMenuName));
     pd->textMenuName.font = resource_font(IDR_FNT_BIG);
-    window_set_text(id, (const char *)"Disp. TEST rd mem.");
+    window_set_text(id, (const char *)"System info");
 
     row2draw += 25;
 
-    //write pattern
-    id = window_create_ptr(WINDOW_CLS_TEXT, id0, RECT_MACRO(0), &(pd->textCPU_load));
-    pd->textCPU_load.font = resource_font(IDR_FNT_NORMAL);
-    window_set_text(id, (const char *)"CPU load");
-
-    id = window_create_ptr(WINDOW_CLS_NUMB, id0, RECT_MACRO(1), &(pd->textCPU_load_val));
-    window_set_format(id, (const char *)"%.0f");
-    window_set_value(id, osGetCPUUsage());
-
-    row2draw += 25;
+    // summary rows, then "task cpu stack_free" rows
+    for (row = 0; row < SYSINFO_ROWS; row++) {
+        pd->rows[row][0] = 0;
+        id = window_create_ptr(WINDOW_CLS_TEXT, id0, rect_ui16(col_0, row2draw, display->w - 2 * col_0, SYSINFO_ROW_H), &(pd->textRows[row]));
+        pd->textRows[row].font = resource_font(IDR_FNT_SMALL);
+        window_set_text(id, pd->rows[row]);
+        row2draw += SYSINFO_ROW_H;
+    }
+    pd->seq = 0;
+    screen_sysinfo_update(screen);
 
     id = window_create_ptr(WINDOW_CLS_TEXT, id0, rect_ui16(col_0, 290, 60, 22), &(pd->textExit));
     pd->textExit.font = resource_font(IDR_FNT_BIG);
@@ -98,13 +126,8 @@ int screen_sysinfo_event(screen_t *screen, window_t *window, uint8_t event, void
             return 1;
         }
 
-    if (event == WINDOW_EVENT_LOOP) {
-        actual_CPU_load = osGetCPUUsage();
-        if (last_CPU_load != actual_CPU_load) {
-            window_set_value(pd->textCPU_load_val.win.id, actual_CPU_load);
-            last_CPU_load = actual_CPU_load;
-        }
-    }
+    if (event == WINDOW_EVENT_LOOP)
+        screen_sysinfo_update(screen);
 
     return 0;
 }
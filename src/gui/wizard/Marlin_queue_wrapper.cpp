@@ -4,3 +4,7 @@
 uint8_t get_gcode_queue_length(void) {
     return queue.length;
 }
+
+uint8_t get_gcode_queue_free(void) {
+    return BUFSIZE - queue.length;
+}
@@ -7,8 +7,12 @@ extern "C" {
 
 #include <stdint.h>
 
+// number of commands in marlin gcode queue (read directly, no marlin_server round trip)
 uint8_t get_gcode_queue_length(void);
 
+// number of free slots in marlin gcode queue
+uint8_t get_gcode_queue_free(void);
+
 #ifdef __cplusplus
 } //extern "C"
 #endif
@@ -14,31 +14,39 @@
 #include "guitypes.h" //font_meas_text
 #include "menu_vars.h"
 #include "filament.h"
+#include "Marlin_queue_wrapper.h"
+#include <math.h>
 
 const char *V2_gcodes_head_PLA[];
 const char *V2_gcodes_head_PETG[];
 const char *V2_gcodes_head_ASA[];
 const char *V2_gcodes_head_FLEX[];
-const char *V2_gcodes_body[];
 
 const size_t V2_gcodes_head_PLA_sz;
 const size_t V2_gcodes_head_PETG_sz;
 const size_t V2_gcodes_head_ASA_sz;
 const size_t V2_gcodes_head_FLEX_sz;
-const size_t V2_gcodes_body_sz;
 
-//todo use marlin api
-const size_t commands_in_queue_size = 8;
-const size_t commands_in_queue_use_max = 6;
-const size_t max_gcodes_in_one_run = 20; //milion of small gcodes could be done instantly but block gui
+const size_t commands_in_queue_reserve = 2; //free marlin queue slots left for other clients (serial, wui)
+const size_t max_gcodes_in_one_run = 20;    //milion of small gcodes could be done instantly but block gui
+
+//returns gcode line (static string or formatted in buff)
+typedef const char *(firstlay_gcode_t)(uint32_t line, char *buff);
+#define FIRSTLAY_GCODE_LEN 32 //max length of generated line
+
+//first layer pattern (body) is generated from path points
+#define FIRSTLAY_LAYER_HEIGHT  0.2F
+#define FIRSTLAY_FILAMENT_AREA (3.1415927F * 1.75F * 1.75F / 4)
+#define FIRSTLAY_SNAKE_WIDTH   0.4F //extrusion width of snake
+#define FIRSTLAY_SQUARE_WIDTH  0.5F //extrusion width of frame and square
+#define FIRSTLAY_SNAKE_CNT     11   //160mm lines in X, 20mm steps in -Y
+#define FIRSTLAY_SQUARE_CNT    50   //20mm lines in X, 0.5mm steps in -Y
 
 static uint32_t line_head = 0;
 static uint32_t line_body = 0;
 
 static const char **head_gcode = NULL;
-static const char **body_gcode = NULL;
 static size_t head_gcode_sz = -1;
-static size_t body_gcode_sz = -1;
 static size_t gcode_sz = -1;
 static size_t G28_pos = -1;
 static size_t G29_pos = -1;
@@ -57,11 +65,15 @@ static const char *_wizard_firstlay_text = "Once the printer   \n"
                                            "until the filament \n"
                                            "sticks to the print\n"
                                            "sheet.";
-int _run_gcode_line(uint32_t *p_line, const char *gcodes[], size_t gcodes_count);
+int _run_gcode_line(uint32_t *p_line, size_t gcodes_count, firstlay_gcode_t *gcode);
 #else
-int _run_gcode_line(uint32_t *p_line, const char *gcodes[], size_t gcodes_count, window_term_t *term);
+int _run_gcode_line(uint32_t *p_line, size_t gcodes_count, firstlay_gcode_t *gcode, window_term_t *term);
 #endif
 
+static const char *_head_gcode(uint32_t line, char *buff);
+static const char *_body_gcode(uint32_t line, char *buff);
+static size_t _body_gcode_count(void);
+
 void _wizard_firstlay_Z_step(firstlay_screen_t *p_screen);
 
 void wizard_init_screen_firstlay(int16_t id_body, firstlay_screen_t *p_screen, firstlay_data_t *p_data) {
@@ -120,8 +132,6 @@ int wizard_firstlay_print(int16_t id_body, firstlay_screen_t *p_screen, firstlay
         p_screen->state = _FL_INIT;
         p_data->state_print = _TEST_RUN;
 
-        body_gcode = V2_gcodes_body;
-        body_gcode_sz = V2_gcodes_body_sz;
         switch (get_filament()) {
         case FILAMENT_PETG:
             head_gcode = V2_gcodes_head_PETG;
@@ -142,7 +152,7 @@ int wizard_firstlay_print(int16_t id_body, firstlay_screen_t *p_screen, firstlay
             break;
         }
 
-        gcode_sz = body_gcode_sz + head_gcode_sz;
+        gcode_sz = _body_gcode_count() + head_gcode_sz;
 
         //G28 must be before G29, both must be present or head is invalid
         //find "G29" == MBL
@@ -191,13 +201,14 @@ int wizard_firstlay_print(int16_t id_body, firstlay_screen_t *p_screen, firstlay
             }
         }
 #if DEBUG_TERM == 0
-        remaining_lines = _run_gcode_line(&line_head, head_gcode,
-            head_gcode_sz);
+        remaining_lines = _run_gcode_line(&line_head, head_gcode_sz,
+            _head_gcode);
 #else
-        remaining_lines = _run_gcode_line(&line_head, head_gcode,
-            head_gcode_sz, &p_screen->term);
+        remaining_lines = _run_gcode_line(&line_head, head_gcode_sz,
+            _head_gcode, &p_screen->term);
 #endif
-        if (remaining_lines < 1) {
+        //failed MBL is handled in next cycle
+        if ((remaining_lines < 1) && !marlin_error(MARLIN_ERR_ProbingFailed)) {
             p_screen->state = _FL_GCODE_BODY;
 #if DEBUG_TERM == 1
             term_printf(&p_screen->terminal, "BODY\n");
@@ -211,11 +222,11 @@ int wizard_firstlay_print(int16_t id_body, firstlay_screen_t *p_screen, firstlay
     case _FL_GCODE_BODY:
         _wizard_firstlay_Z_step(p_screen);
 #if DEBUG_TERM == 0
-        remaining_lines = _run_gcode_line(&line_body, body_gcode,
-            body_gcode_sz);
+        remaining_lines = _run_gcode_line(&line_body, _body_gcode_count(),
+            _body_gcode);
 #else
-        remaining_lines = _run_gcode_line(&line_body, body_gcode,
-            body_gcode_sz, &p_screen->term);
+        remaining_lines = _run_gcode_line(&line_body, _body_gcode_count(),
+            _body_gcode, &p_screen->term);
 #endif
         if (remaining_lines < 1) {
             p_screen->state = _FL_GCODE_DONE;
@@ -333,104 +344,85 @@ const char *V2_gcodes_head_FLEX[] = {
 };
 const size_t V2_gcodes_head_FLEX_sz = sizeof(V2_gcodes_head_FLEX) / sizeof(V2_gcodes_head_FLEX[0]);
 
-//EXTRUDE_PER_MM  0.2 * 0.5 / (pi * 1.75 ^ 2 / 4) = 0.041575
+static const char *_head_gcode(uint32_t line, char *buff) {
+    return head_gcode[line];
+}
 
-//todo generate me
-const char *V2_gcodes_body[] = {
+static const char *V2_gcodes_body_begin[] = {
     "G1 Z4 F1000",
     "G1 X0 Y-2 Z0.2 F3000.0",
     "G1 E6 F2000",
     "G1 X60 E9 F1000.0",
     "G1 X100 E12.5 F1000.0",
     "G1 Z2 E-6 F2100.00000",
+    "G1 X10 Y150 Z0.2 F3000", //path start point
+    "G1 E6 F2000",
+    "G1 F1000"
+};
+#define V2_GCODES_BODY_BEGIN_CNT (sizeof(V2_gcodes_body_begin) / sizeof(V2_gcodes_body_begin[0]))
 
-    "G1 X10 Y150 Z0.2 F3000",
-    "G1 E6 F2000"
-
-    "G1 F1000",
-    //E = extrusion_length * layer_height * extrusion_width / (PI * pow(1.75, 2) / 4)
-    "G1 X170 Y150 E5.322", //160 * 0.2 * 0.4 / (pi * 1.75 ^ 2 / 4) = 5.322
-    "G1 X170 Y130 E0.665", //20 * 0.2 * 0.4 / (pi * 1.75 ^ 2 / 4) = 0.665
-    "G1 X10  Y130 E5.322",
-    "G1 X10  Y110 E0.665",
-    "G1 X170 Y110 E5.322",
-    "G1 X170 Y90  E0.665",
-    "G1 X10  Y90  E5.322",
-    "G1 X10  Y70  E0.665",
-    "G1 X170 Y70  E5.322",
-    "G1 X170 Y50  E0.665",
-    "G1 X10  Y50  E5.322",
-
-    //frame around
-    "G1 X10    Y17    E1.371975",  //33 * 0.041575 = 1.371975
-    "G1 X31    Y17    E1.288825",  //31 * 0.041575 = 1.288825
-    "G1 X31    Y30.5  E0.5612625", //13.5 * 0.041575 = 0.5612625
-    "G1 X10.5  Y30.5  E0.832",     //20 * 0.2 * 0.5 / (pi * 1.75 ^ 2 / 4) = 0.832
-    "G1 X10.5  Y30.0  E0.0208",    //0.5 * 0.2 * 0.5 / (pi * 1.75 ^ 2 / 4) = 0.0208
-
-    "G1 F1000",
-    "G1 X30.5  Y30.0  E0.832",
-    "G1 X30.5  Y29.5  E0.0208",
-    "G1 X10.5  Y29.5  E0.832",
-    "G1 X10.5  Y29.0  E0.0208",
-    "G1 X30.5  Y29.0  E0.832",
-    "G1 X30.5  Y28.5  E0.0208",
-    "G1 X10.5  Y28.5  E0.832",
-    "G1 X10.5  Y28.0  E0.0208",
-    "G1 X30.5  Y28.0  E0.832",
-    "G1 X30.5  Y27.5  E0.0208",
-    "G1 X10.5  Y27.5  E0.832",
-    "G1 X10.5  Y27.0  E0.0208",
-    "G1 X30.5  Y27.0  E0.832",
-    "G1 X30.5  Y26.5  E0.0208",
-    "G1 X10.5  Y26.5  E0.832",
-    "G1 X10.5  Y26.0  E0.0208",
-    "G1 X30.5  Y26.0  E0.832",
-    "G1 X30.5  Y25.5  E0.0208",
-    "G1 X10.5  Y25.5  E0.832",
-    "G1 X10.5  Y25.0  E0.0208",
-    "G1 X30.5  Y25.0  E0.832",
-    "G1 X30.5  Y24.5  E0.0208",
-    "G1 X10.5  Y24.5  E0.832",
-    "G1 X10.5  Y24.0  E0.0208",
-    "G1 X30.5  Y24.0  E0.832",
-    "G1 X30.5  Y23.5  E0.0208",
-    "G1 X10.5  Y23.5  E0.832",
-    "G1 X10.5  Y23.0  E0.0208",
-    "G1 X30.5  Y23.0  E0.832",
-    "G1 X30.5  Y22.5  E0.0208",
-    "G1 X10.5  Y22.5  E0.832",
-    "G1 X10.5  Y22.0  E0.0208",
-    "G1 X30.5  Y22.0  E0.832",
-    "G1 X30.5  Y21.5  E0.0208",
-    "G1 X10.5  Y21.5  E0.832",
-    "G1 X10.5  Y21.0  E0.0208",
-    "G1 X30.5  Y21.0  E0.832",
-    "G1 X30.5  Y20.5  E0.0208",
-    "G1 X10.5  Y20.5  E0.832",
-    "G1 X10.5  Y20.0  E0.0208",
-    "G1 X30.5  Y20.0  E0.832",
-    "G1 X30.5  Y19.5  E0.0208",
-    "G1 X10.5  Y19.5  E0.832",
-    "G1 X10.5  Y19.0  E0.0208",
-    "G1 X30.5  Y19.0  E0.832",
-    "G1 X30.5  Y18.5  E0.0208",
-    "G1 X10.5  Y18.5  E0.832",
-    "G1 X10.5  Y18.0  E0.0208",
-    "G1 X30.5  Y18.0  E0.832",
-    "G1 X30.5  Y17.5  E0.0208",
-
+static const char *V2_gcodes_body_end[] = {
     "G1 Z2 E-6 F2100",
     "G1 X178 Y0 Z10 F3000",
-
     "G4",
-
     "M107",
     "M104 S0", // turn off temperature
     "M140 S0", // turn off heatbed
     "M84"      // disable motors
 };
-const size_t V2_gcodes_body_sz = sizeof(V2_gcodes_body) / sizeof(V2_gcodes_body[0]);
+#define V2_GCODES_BODY_END_CNT (sizeof(V2_gcodes_body_end) / sizeof(V2_gcodes_body_end[0]))
+
+//frame around the square, starts at the end of the snake
+static const float V2_frame[][2] = {
+    { 10, 17 }, { 31, 17 }, { 31, 30.5F }, { 10.5F, 30.5F }, { 10.5F, 30 }
+};
+#define V2_FRAME_CNT (sizeof(V2_frame) / sizeof(V2_frame[0]))
+
+#define V2_PATH_CNT (FIRSTLAY_SNAKE_CNT + V2_FRAME_CNT + FIRSTLAY_SQUARE_CNT)
+
+//path point (0 is start point), returns extrusion width of move to the point
+static float _path_point(uint32_t i, float *x, float *y) {
+    if (i-- == 0) {
+        *x = 10;
+        *y = 150;
+        return 0;
+    }
+    if (i < FIRSTLAY_SNAKE_CNT) {
+        *x = ((i & 3) < 2) ? 170 : 10;
+        *y = 150 - 20 * ((i + 1) / 2);
+        return FIRSTLAY_SNAKE_WIDTH;
+    }
+    i -= FIRSTLAY_SNAKE_CNT;
+    if (i < V2_FRAME_CNT) {
+        *x = V2_frame[i][0];
+        *y = V2_frame[i][1];
+        return FIRSTLAY_SQUARE_WIDTH;
+    }
+    i -= V2_FRAME_CNT;
+    *x = ((i / 2) & 1) ? 10.5F : 30.5F;
+    *y = 30 - 0.5F * ((i + 1) / 2);
+    return FIRSTLAY_SQUARE_WIDTH;
+}
+
+static size_t _body_gcode_count(void) {
+    return V2_GCODES_BODY_BEGIN_CNT + V2_PATH_CNT + V2_GCODES_BODY_END_CNT;
+}
+
+//E = extrusion_length * layer_height * extrusion_width / (PI * pow(1.75, 2) / 4)
+static const char *_body_gcode(uint32_t line, char *buff) {
+    float x0, y0, x, y, w, e;
+    if (line < V2_GCODES_BODY_BEGIN_CNT)
+        return V2_gcodes_body_begin[line];
+    line -= V2_GCODES_BODY_BEGIN_CNT;
+    if (line < V2_PATH_CNT) {
+        _path_point(line, &x0, &y0);
+        w = _path_point(line + 1, &x, &y);
+        e = sqrtf((x - x0) * (x - x0) + (y - y0) * (y - y0)) * FIRSTLAY_LAYER_HEIGHT * w / FIRSTLAY_FILAMENT_AREA;
+        snprintf(buff, FIRSTLAY_GCODE_LEN, "G1 X%.1f Y%.1f E%.4f", (double)x, (double)y, (double)e);
+        return buff;
+    }
+    return V2_gcodes_body_end[line - V2_PATH_CNT];
+}
 
 int _get_progress() {
     //if ( _is_gcode_end_line() ) return 100;
@@ -447,27 +439,27 @@ void _set_gcode_first_lines() {
 }
 
 #if DEBUG_TERM == 0
-int _run_gcode_line(uint32_t *p_line, const char *gcodes[], size_t gcodes_count)
+int _run_gcode_line(uint32_t *p_line, size_t gcodes_count, firstlay_gcode_t *gcode)
 #else
-int _run_gcode_line(uint32_t *p_line, const char *gcodes[], size_t gcodes_count, window_term_t *term)
+int _run_gcode_line(uint32_t *p_line, size_t gcodes_count, firstlay_gcode_t *gcode, window_term_t *term)
 #endif
 {
+    char buff[FIRSTLAY_GCODE_LEN];
+    const char *line;
     size_t gcodes_in_this_run = 0;
 
-    //todo "while" does not work ...why?, something with  commands_in_queue?
-    //while(commands_in_queue < commands_in_queue_use_max){
-    if (marlin_get_gqueue() < 1) {
-        if ((*p_line) < gcodes_count) {
-            ++gcodes_in_this_run;
-            marlin_gcode(gcodes[*p_line]);
+    //keep marlin queue full, so the planner is never starved between gui cycles
+    //queue length is read directly - sending only to free slot does not block in marlin_gcode
+    while (((*p_line) < gcodes_count) && (gcodes_in_this_run < max_gcodes_in_one_run) && (get_gcode_queue_free() > commands_in_queue_reserve)) {
+        line = gcode(*p_line, buff);
+        marlin_gcode(line);
 #if DEBUG_TERM == 1
-            term_printf(term->term, "%s\n", gcodes[*p_line]);
-            window_invalidate(term->win.id);
+        term_printf(term->term, "%s\n", line);
+        window_invalidate(term->win.id);
 #endif
-            ++(*p_line);
-        }
+        ++(*p_line);
+        ++gcodes_in_this_run;
     }
 
-    //commands_in_queue does not reflect commands added in this run
-    return gcodes_count - (*p_line) + marlin_get_gqueue() + gcodes_in_this_run;
+    return gcodes_count - (*p_line) + get_gcode_queue_length();
 }
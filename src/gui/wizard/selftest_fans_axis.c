@@ -4,13 +4,11 @@
 #include "dbg.h"
 #include "config.h"
 #include "hwio_a3ides.h"
+#include "stm32f4xx_hal.h" //HAL_GetTick
 #include "marlin_client.h"
 #include "wizard_config.h"
 #include "wizard_ui.h"
 
-extern uint32_t Tacho_FAN0;
-extern uint32_t Tacho_FAN1;
-
 void wizard_init_screen_selftest_fans_axis(int16_t id_body, selftest_fans_axis_screen_t *p_screen,
     selftest_fans_axis_data_t *p_data) {
     int16_t id;
@@ -78,39 +76,44 @@ void wizard_init_screen_selftest_fans_axis(int16_t id_body, selftest_fans_axis_s
     window_set_icon_id(id, wizard_get_test_icon_resource(p_data->state_z));
 }
 
-int wizard_selftest_fan0(int16_t id_body, selftest_fans_axis_screen_t *p_screen, selftest_fans_axis_data_t *p_data) {
-    if (p_data->state_fan0 == _TEST_START) {
-        wizard_init_screen_selftest_fans_axis(id_body, p_screen, p_data);
+// fan passes when its speed stays within limits for _SELFTEST_FAN_STABLE, fails after time
+static int _wizard_selftest_fan(int fan, uint32_t time, uint16_t rpm_min, uint16_t rpm_max,
+    selftest_fans_axis_screen_t *p_screen, _TEST_STATE_t *p_state) {
+    if (*p_state == _TEST_START) {
         marlin_stop_processing();
-        hwio_fan_set_pwm(0, 255);
-        Tacho_FAN0 = 0;
+        hwio_fan_set_pwm(fan, 255);
+        p_screen->timer1 = HAL_GetTick();
+    }
+    int progress = wizard_timer(&p_screen->timer0, time, p_state, _WIZ_TIMER_AUTOFAIL);
+    if (*p_state == _TEST_RUN) {
+        uint16_t rpm = marlin_update_vars(MARLIN_VAR_MSK(MARLIN_VAR_FAN0_RPM + fan))->fan_rpm[fan];
+        if ((rpm < rpm_min) || (rpm > rpm_max))
+            p_screen->timer1 = HAL_GetTick();
+        else if ((HAL_GetTick() - p_screen->timer1) >= _SELFTEST_FAN_STABLE) {
+            *p_state = _TEST_PASSED;
+            progress = 100;
+        }
     }
-    int progress = wizard_timer(&p_screen->timer0, _SELFTEST_FAN0_TIME, &(p_data->state_fan0), _WIZ_TIMER_AUTOPASS);
     if (progress == 100) {
-        if ((Tacho_FAN0 < _SELFTEST_FAN0_MIN) || (Tacho_FAN0 > _SELFTEST_FAN0_MAX))
-            p_data->state_fan0 = _TEST_FAILED;
-        hwio_fan_set_pwm(0, 0);
+        hwio_fan_set_pwm(fan, 0);
         marlin_start_processing();
     }
+    return progress;
+}
+
+int wizard_selftest_fan0(int16_t id_body, selftest_fans_axis_screen_t *p_screen, selftest_fans_axis_data_t *p_data) {
+    if (p_data->state_fan0 == _TEST_START)
+        wizard_init_screen_selftest_fans_axis(id_body, p_screen, p_data);
+    int progress = _wizard_selftest_fan(0, _SELFTEST_FAN0_TIME, _SELFTEST_FAN0_MIN, _SELFTEST_FAN0_MAX, p_screen, &(p_data->state_fan0));
     window_set_value(p_screen->progress_fan.win.id, (float)progress / 2);
     wizard_update_test_icon(p_screen->icon_extruder_fan.win.id, p_data->state_fan0);
     return progress;
 }
 
 int wizard_selftest_fan1(int16_t id_body, selftest_fans_axis_screen_t *p_screen, selftest_fans_axis_data_t *p_data) {
-    if (p_data->state_fan1 == _TEST_START) {
+    if (p_data->state_fan1 == _TEST_START)
         wizard_init_screen_selftest_fans_axis(id_body, p_screen, p_data);
-        marlin_stop_processing();
-        hwio_fan_set_pwm(1, 255);
-        Tacho_FAN1 = 0;
-    }
-    int progress = wizard_timer(&p_screen->timer0, _SELFTEST_FAN1_TIME, &(p_data->state_fan1), _WIZ_TIMER_AUTOPASS);
-    if (progress == 100) {
-        if ((Tacho_FAN1 < _SELFTEST_FAN1_MIN) || (Tacho_FAN1 > _SELFTEST_FAN1_MAX))
-            p_data->state_fan1 = _TEST_FAILED;
-        hwio_fan_set_pwm(1, 0);
-        marlin_start_processing();
-    }
+    int progress = _wizard_selftest_fan(1, _SELFTEST_FAN1_TIME, _SELFTEST_FAN1_MIN, _SELFTEST_FAN1_MAX, p_screen, &(p_data->state_fan1));
     window_set_value(p_screen->progress_fan.win.id, 50.0F + (float)progress / 2);
     wizard_update_test_icon(p_screen->icon_print_fan.win.id, p_data->state_fan1);
     return progress;
@@ -7,13 +7,15 @@
 //calculate move time in milliseconds (max is in mm and fr is in mm/min)
 #define _SELFTEST_AXIS_TIME(max, fr) ((60 * 1000 * max) / fr)
 
-#define _SELFTEST_FAN0_TIME 3000 // 3s
-#define _SELFTEST_FAN0_MIN  100  // 100 pulses
-#define _SELFTEST_FAN0_MAX  1000 // 1000 pulses
+#define _SELFTEST_FAN_STABLE 300 // speed within limits for 300ms passes
 
-#define _SELFTEST_FAN1_TIME 3000 // 3s
-#define _SELFTEST_FAN1_MIN  100  // 100 pulses
-#define _SELFTEST_FAN1_MAX  1000 // 1000 pulses
+#define _SELFTEST_FAN0_TIME 3000  // 3s - max. (spin-up)
+#define _SELFTEST_FAN0_MIN  1000  // 1000 rpm
+#define _SELFTEST_FAN0_MAX  10000 // 10000 rpm
+
+#define _SELFTEST_FAN1_TIME 3000  // 3s - max. (spin-up)
+#define _SELFTEST_FAN1_MIN  1000  // 1000 rpm
+#define _SELFTEST_FAN1_MAX  10000 // 10000 rpm
 
 #define _SELFTEST_X_MIN  (x_axis_len - len_tol_abs)
 #define _SELFTEST_X_MAX  (x_axis_len + len_tol_abs)
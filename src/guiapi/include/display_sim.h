@@ -0,0 +1,33 @@
+//display_sim.h - in-memory framebuffer display (host simulator)
+#ifndef _DISPLAY_SIM_H
+#define _DISPLAY_SIM_H
+
+#include "display.h"
+
+#define DISPLAY_SIM_COLS 240
+#define DISPLAY_SIM_ROWS 320
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+extern const display_t display_sim;
+
+//framebuffer pointer (DISPLAY_SIM_COLS * DISPLAY_SIM_ROWS pixels, row by row)
+extern color_t *display_sim_fb(void);
+
+extern color_t display_sim_get_pixel(point_ui16_t pt);
+
+//number of pixels written since last display_sim_reset_stats (rendering benchmarks)
+extern uint32_t display_sim_pixel_count(void);
+
+extern void display_sim_reset_stats(void);
+
+//save framebuffer to png file, returns 1 on success
+extern int display_sim_save_png(const char *fn);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //_DISPLAY_SIM_H
@@ -73,6 +73,9 @@ extern int gui_msgbox(const char *text, uint16_t flags);
 
 extern void gui_reset_jogwheel(void);
 
+//encoder steps multiplied by acceleration curve (current encoder speed), for numeric values
+extern int gui_jogwheel_accel(int dif);
+
 #endif //GUI_JOGWHEEL_SUPPORT
 
 #ifdef __cplusplus
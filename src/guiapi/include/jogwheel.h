@@ -9,12 +9,18 @@
 #define JOGWHEEL_FLG_INV_ENC 0x02
 #define JOGWHEEL_FLG_INV_E12 0x04
 #define JOGWHEEL_FLG_2PULSES 0x08
-#define JOGWHEEL_FLG_FILTER2 0x10
+#define JOGWHEEL_FLG_FILTER2 0x10 // not used with exti decoding (contact bounces cancel out in quadrature table)
 //old encoder (with new encoder 2 steps per 1 count)
 //#define JOGWHEEL_DEF_FLG      (JOGWHEEL_FLG_INV_ENC | JOGWHEEL_FLG_INV_DIR)
 //new encoder (1 steps per 1 count)
 #define JOGWHEEL_DEF_FLG (JOGWHEEL_FLG_INV_ENC | JOGWHEEL_FLG_2PULSES | JOGWHEEL_FLG_FILTER2)
 
+#define JOGWHEEL_EVENT_QUEUE 32 // event queue size (power of 2)
+
+//event types
+#define JOGWHEEL_EVT_ENC 1 // encoder steps (val = signed count)
+#define JOGWHEEL_EVT_BTN 2 // button changed (val = 1 pressed, 0 released)
+
 #pragma pack(push)
 #pragma pack(1)
 
@@ -25,8 +31,16 @@ typedef struct _jogwheel_config_t {
     uint8_t flg;    // flags
 } jogwheel_config_t;
 
+typedef struct _jogwheel_event_t {
+    uint32_t tick; // HAL_GetTick() at event
+    uint8_t type;  // JOGWHEEL_EVT_xxx
+    int8_t val;    // encoder steps or button state
+} jogwheel_event_t;
+
 #pragma pack(pop)
 
+typedef void(jogwheel_event_cb_t)(void);
+
 #ifdef __cplusplus
 extern "C" {
 #endif //__cplusplus
@@ -36,10 +50,24 @@ extern int32_t jogwheel_encoder;
 extern uint16_t jogwheel_button_down;
 extern uint8_t jogwheel_changed;
 
+//called from interrupt when event was queued (e.g. to wake up gui thread)
+extern jogwheel_event_cb_t *jogwheel_event_cb;
+
 extern void jogwheel_init(void);
 
+//button sampling (1ms timer interrupt)
 extern void jogwheel_update_1ms(void);
 
+//encoder phase edge (EXTI interrupt)
+extern void jogwheel_update_exti(void);
+
+//read oldest event, returns 1 when event was read
+extern int jogwheel_event_get(jogwheel_event_t *pevt);
+
+extern int jogwheel_event_pending(void);
+
+extern void jogwheel_event_flush(void);
+
 extern void jogwheel_encoder_set(int32_t val, int32_t min, int32_t max);
 
 extern jogwheel_config_t jogwheel_config;
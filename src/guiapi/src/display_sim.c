@@ -0,0 +1,281 @@
+//display_sim.c - in-memory framebuffer display (host simulator)
+
+#include "display_sim.h"
+#include <png.h>
+#include <stdlib.h>
+#include <string.h>
+
+static color_t display_sim_buff[DISPLAY_SIM_COLS * DISPLAY_SIM_ROWS];
+static rect_ui16_t display_sim_clip = { 0, 0, DISPLAY_SIM_COLS, DISPLAY_SIM_ROWS };
+static uint32_t display_sim_pixels = 0;
+
+static inline void display_sim_put(uint16_t x, uint16_t y, color_t clr) {
+    if (point_in_rect_ui16(point_ui16(x, y), display_sim_clip)) {
+        display_sim_buff[y * DISPLAY_SIM_COLS + x] = clr & 0x00ffffff;
+        display_sim_pixels++;
+    }
+}
+
+void display_sim_init(void) {
+    display_sim_clip = rect_ui16(0, 0, DISPLAY_SIM_COLS, DISPLAY_SIM_ROWS);
+}
+
+void display_sim_done(void) {
+}
+
+void display_sim_fill_rect(rect_ui16_t rc, color_t clr) {
+    int x;
+    int y;
+    rc = rect_intersect_ui16(rc, display_sim_clip);
+    for (y = rc.y; y < (rc.y + rc.h); y++)
+        for (x = rc.x; x < (rc.x + rc.w); x++)
+            display_sim_put(x, y, clr);
+}
+
+void display_sim_clear(color_t clr) {
+    display_sim_fill_rect(rect_ui16(0, 0, DISPLAY_SIM_COLS, DISPLAY_SIM_ROWS), clr);
+}
+
+void display_sim_set_pixel(point_ui16_t pt, color_t clr) {
+    display_sim_put(pt.x, pt.y, clr);
+}
+
+void display_sim_draw_line(point_ui16_t pt, point_ui16_t pt1, color_t clr) {
+    int dx = abs(pt1.x - pt.x);
+    int dy = -abs(pt1.y - pt.y);
+    int sx = (pt.x < pt1.x) ? 1 : -1;
+    int sy = (pt.y < pt1.y) ? 1 : -1;
+    int err = dx + dy;
+    int x = pt.x;
+    int y = pt.y;
+    //same end point exclusion as st7789v_draw_line
+    while ((x != pt1.x) || (y != pt1.y)) {
+        display_sim_put(x, y, clr);
+        if (2 * err >= dy) {
+            err += dy;
+            x += sx;
+        }
+        if (2 * err <= dx) {
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+void display_sim_draw_rect(rect_ui16_t rc, color_t clr) {
+    point_ui16_t pt = { rc.x, rc.y };
+    point_ui16_t pt1 = { rc.x + rc.w - 1, rc.y };
+    point_ui16_t pt2 = { rc.x + rc.w - 1, rc.y + rc.h - 1 };
+    point_ui16_t pt3 = { rc.x, rc.y + rc.h - 1 };
+    display_sim_draw_line(pt, pt1, clr);
+    display_sim_draw_line(pt1, pt2, clr);
+    display_sim_draw_line(pt2, pt3, clr);
+    display_sim_draw_line(pt3, pt, clr);
+}
+
+void display_sim_draw_char(point_ui16_t pt, char chr, font_t *pf, color_t clr0, color_t clr1) {
+    int i;
+    int j;
+    uint8_t *pch;                 //character data pointer
+    uint8_t *pc;                  //current row data pointer
+    uint8_t crd = 0;              //current row byte data
+    uint16_t w = pf->w;           //cache width
+    uint16_t h = pf->h;           //..
+    uint8_t bpr = pf->bpr;        //bytes per row
+    uint16_t bpc = bpr * h;       //bytes per char
+    uint8_t bpp = 8 * bpr / w;    //bits per pixel
+    uint8_t ppb = 8 / bpp;        //pixels per byte
+    uint8_t pms = (1 << bpp) - 1; //pixel mask
+    color_t clr[16];
+    if ((chr < pf->asc_min) || (chr > pf->asc_max)) {
+        display_sim_fill_rect(rect_ui16(pt.x, pt.y, w, h), clr0);
+        return;
+    }
+    pch = ((uint8_t *)pf->pcs) + ((chr - pf->asc_min) * bpc);
+    for (i = 0; i <= pms; i++)
+        clr[i] = color_alpha(clr0, clr1, 255 * i / pms);
+    for (j = 0; j < h; j++) {
+        pc = pch + j * bpr;
+        for (i = 0; i < w; i++) {
+            if ((i % ppb) == 0)
+                crd = (pf->flg & FONT_FLG_SWAP) ? pch[((i / ppb) ^ 1) + j * bpr] : *(pc++);
+            if (pf->flg & FONT_FLG_LSBF) {
+                display_sim_put(pt.x + i, pt.y + j, clr[crd & pms]);
+                crd >>= bpp;
+            } else {
+                display_sim_put(pt.x + i, pt.y + j, clr[crd >> (8 - bpp)]);
+                crd <<= bpp;
+            }
+        }
+    }
+}
+
+void display_sim_draw_text(rect_ui16_t rc, const char *str, font_t *pf, color_t clr0, color_t clr1) {
+    int x = rc.x;
+    int y = rc.y;
+    for (; *str; str++) {
+        if (*str == '\n') {
+            y += pf->h;
+            x = rc.x;
+            if ((y + pf->h) > (rc.y + rc.h))
+                break;
+        } else {
+            display_sim_draw_char(point_ui16(x, y), *str, pf, clr0, clr1);
+            x += pf->w;
+            if ((x + pf->w) > (rc.x + rc.w))
+                break;
+        }
+    }
+}
+
+//same raster operations as st7789v (gray pixels only)
+#define SWAPBW_TOLERANCE 64
+static void display_sim_rop(uint8_t *ppx, uint8_t rop) {
+    uint8_t l = (ppx[0] + ppx[1] + ppx[2]) / 3;
+    uint8_t l0 = (l >= SWAPBW_TOLERANCE) ? (l - SWAPBW_TOLERANCE) : 0;
+    uint8_t l1 = (l <= (255 - SWAPBW_TOLERANCE)) ? (l + SWAPBW_TOLERANCE) : 255;
+    int gray = (l0 <= ppx[0]) && (ppx[0] <= l1) && (l0 <= ppx[1]) && (ppx[1] <= l1) && (l0 <= ppx[2]) && (ppx[2] <= l1);
+    int i;
+    for (i = 0; i < 3; i++)
+        switch (rop) {
+        case ROPFN_INVERT:
+            ppx[i] = 255 - ppx[i];
+            break;
+        case ROPFN_SWAPBW:
+            if (gray)
+                ppx[i] = 255 - ppx[i];
+            break;
+        case ROPFN_DISABLE:
+            if (gray)
+                ppx[i] /= 2;
+            break;
+        }
+}
+
+static void display_sim_draw_png_ex(point_ui16_t pt, FILE *pf, color_t clr0, uint8_t rop) {
+    png_structp pp;
+    png_infop ppi = NULL;
+    uint8_t *volatile row = NULL;
+    uint8_t sig[8];
+    uint8_t *ppx;
+    color_t clr;
+    int pixsize;
+    int i;
+    int j;
+    if ((pf == NULL) || (fread(sig, 1, 8, pf) < 8) || !png_check_sig(sig, 8))
+        return;
+    if ((pp = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL)) == NULL)
+        return;
+    if ((ppi = png_create_info_struct(pp)) == NULL)
+        goto _e_1;
+    if (setjmp(png_jmpbuf(pp)))
+        goto _e_1;
+    png_init_io(pp, pf);
+    png_set_sig_bytes(pp, 8);
+    png_read_info(pp, ppi);
+    uint16_t w = png_get_image_width(pp, ppi);
+    uint16_t h = png_get_image_height(pp, ppi);
+    int rowsize = png_get_rowbytes(pp, ppi);
+    pixsize = rowsize / w;
+    if ((pixsize != 3) && (pixsize != 4))
+        goto _e_1;
+    if ((row = (uint8_t *)malloc(rowsize)) == NULL)
+        goto _e_1;
+    for (j = 0; j < h; j++) {
+        png_read_row(pp, row, NULL);
+        for (i = 0; i < w; i++) {
+            ppx = row + i * pixsize;
+            if (pixsize == 4) {
+                clr = color_alpha(clr0, color_rgb(ppx[0], ppx[1], ppx[2]), ppx[3]);
+                memcpy(ppx, &clr, 3);
+            }
+            display_sim_rop(ppx, rop);
+            display_sim_put(pt.x + i, pt.y + j, color_rgb(ppx[0], ppx[1], ppx[2]));
+        }
+    }
+_e_1:
+    free(row);
+    png_destroy_read_struct(&pp, &ppi, 0);
+}
+
+void display_sim_draw_icon(point_ui16_t pt, uint16_t id_res, color_t clr0, uint8_t rop) {
+    FILE *pf = resource_fopen(id_res, "rb");
+    display_sim_draw_png_ex(pt, pf, clr0, rop);
+    if (pf)
+        fclose(pf);
+}
+
+void display_sim_draw_png(point_ui16_t pt, FILE *pf) {
+    display_sim_draw_png_ex(pt, pf, 0, 0);
+}
+
+color_t *display_sim_fb(void) {
+    return display_sim_buff;
+}
+
+color_t display_sim_get_pixel(point_ui16_t pt) {
+    if ((pt.x >= DISPLAY_SIM_COLS) || (pt.y >= DISPLAY_SIM_ROWS))
+        return 0;
+    return display_sim_buff[pt.y * DISPLAY_SIM_COLS + pt.x];
+}
+
+uint32_t display_sim_pixel_count(void) {
+    return display_sim_pixels;
+}
+
+void display_sim_reset_stats(void) {
+    display_sim_pixels = 0;
+}
+
+int display_sim_save_png(const char *fn) {
+    FILE *pf;
+    png_structp pp;
+    png_infop ppi = NULL;
+    uint8_t row[DISPLAY_SIM_COLS * 3];
+    int i;
+    int j;
+    int ret = 0;
+    if ((pf = fopen(fn, "wb")) == NULL)
+        return 0;
+    if ((pp = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL)) == NULL)
+        goto _e_0;
+    if ((ppi = png_create_info_struct(pp)) == NULL)
+        goto _e_1;
+    if (setjmp(png_jmpbuf(pp)))
+        goto _e_1;
+    png_init_io(pp, pf);
+    png_set_IHDR(pp, ppi, DISPLAY_SIM_COLS, DISPLAY_SIM_ROWS, 8, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(pp, ppi);
+    for (j = 0; j < DISPLAY_SIM_ROWS; j++) {
+        for (i = 0; i < DISPLAY_SIM_COLS; i++) {
+            color_t clr = display_sim_buff[j * DISPLAY_SIM_COLS + i];
+            row[i * 3 + 0] = clr & 0xff;
+            row[i * 3 + 1] = (clr >> 8) & 0xff;
+            row[i * 3 + 2] = (clr >> 16) & 0xff;
+        }
+        png_write_row(pp, row);
+    }
+    png_write_end(pp, ppi);
+    ret = 1;
+_e_1:
+    png_destroy_write_struct(&pp, &ppi);
+_e_0:
+    fclose(pf);
+    return ret;
+}
+
+const display_t display_sim = {
+    DISPLAY_SIM_COLS,
+    DISPLAY_SIM_ROWS,
+    display_sim_init,
+    display_sim_done,
+    display_sim_clear,
+    display_sim_set_pixel,
+    display_sim_draw_line,
+    display_sim_draw_rect,
+    display_sim_fill_rect,
+    display_sim_draw_char,
+    display_sim_draw_text,
+    display_sim_draw_icon,
+    display_sim_draw_png,
+};
@@ -9,8 +9,9 @@
 uint16_t gui_flags = 0;
 
 #ifdef GUI_JOGWHEEL_SUPPORT
-int gui_jogwheel_encoder = 0;
 int gui_jogwheel_button_down = 0;
+int gui_jogwheel_speed = 0; // encoder speed [counts/s]
+uint32_t gui_jogwheel_tick = 0;
 #endif //GUI_JOGWHEEL_SUPPORT
 
 #ifdef GUI_USE_RTOS
@@ -40,13 +41,24 @@ void gui_free(void *ptrx) {
     free(ptrx);
 }
 
+#if defined(GUI_JOGWHEEL_SUPPORT) && defined(GUI_USE_RTOS)
+//called from jogwheel interrupt
+static void gui_jogwheel_event_cb(void) {
+    if (gui_task_handle)
+        osSignalSet(gui_task_handle, GUI_SIG_JOGWHEEL);
+}
+#endif //GUI_JOGWHEEL_SUPPORT && GUI_USE_RTOS
+
 void gui_init(void) {
     display->init();
+    gui_task_handle = osThreadGetId();
 #ifdef GUI_JOGWHEEL_SUPPORT
     jogwheel_init();
     gui_reset_jogwheel();
-#endif //GUI_JOGWHEEL_SUPPORT
-    gui_task_handle = osThreadGetId();
+    #ifdef GUI_USE_RTOS
+    jogwheel_event_cb = gui_jogwheel_event_cb;
+    #endif //GUI_USE_RTOS
+#endif     //GUI_JOGWHEEL_SUPPORT
 }
 
 extern window_t *window_0;
@@ -71,64 +83,109 @@ void gui_invalidate(void) {
 }
 
 #define GUI_DELAY_MIN  1
-#define GUI_DELAY_MAX  10
-#define GUI_DELAY_LOOP 100
+#define GUI_DELAY_LOOP 100 // loop callback and WINDOW_EVENT_LOOP period, gui thread sleeps until next timer, loop or event
+
+#define GUI_JOGWHEEL_ACCEL_SPEED   8   // [counts/s] encoder speed where acceleration starts
+#define GUI_JOGWHEEL_ACCEL_SLOPE   4   // [counts/s] speed increase per multiplier step
+#define GUI_JOGWHEEL_ACCEL_MAX     10  // max. multiplier
+#define GUI_JOGWHEEL_SPEED_TIMEOUT 150 // [ms] speed is zero when there is no step for longer time
 
 #ifdef GUI_WINDOW_SUPPORT
 
 static uint8_t guiloop_nesting = 0;
 uint8_t gui_get_nesting(void) { return guiloop_nesting; }
 
+    #ifdef GUI_JOGWHEEL_SUPPORT
+static void gui_menu_timeout_reset(void) {
+    //=======MENU_TIMEOUT=========
+    if (menu_timeout_enabled == 1) {
+        if (gui_get_menu_timeout_id() >= 0)
+            gui_timer_reset(gui_get_menu_timeout_id());
+        else
+            gui_timer_create_timeout((uint32_t)MENU_TIMEOUT_MS, (int16_t)-1);
+    }
+}
+
+static void gui_jogwheel_dispatch(int dif) {
+    if (dif > 0)
+        screen_dispatch_event(window_capture_ptr, WINDOW_EVENT_ENC_UP, (void *)dif);
+    else if (dif < 0)
+        screen_dispatch_event(window_capture_ptr, WINDOW_EVENT_ENC_DN, (void *)-dif);
+    if (dif)
+        gui_menu_timeout_reset();
+}
+
+//update encoder speed from event timestamps (events can be processed later than they occurred)
+static void gui_jogwheel_update_speed(jogwheel_event_t *pevt) {
+    uint32_t dt = pevt->tick - gui_jogwheel_tick;
+    int dir = (pevt->val > 0) ? 1 : -1;
+    if ((dt >= GUI_JOGWHEEL_SPEED_TIMEOUT) || ((gui_jogwheel_speed ^ dir) < 0))
+        gui_jogwheel_speed = 0; //first step after pause or direction changed
+    else {
+        int speed = (1000 * pevt->val) / (int)((dt > 0) ? dt : 1);
+        gui_jogwheel_speed = (gui_jogwheel_speed + speed) / 2;
+        if (gui_jogwheel_speed == 0)
+            gui_jogwheel_speed = dir;
+    }
+    gui_jogwheel_tick = pevt->tick;
+}
+
+//process queued jogwheel events, consecutive encoder steps are dispatched at once
+static void gui_jogwheel_events(void) {
+    jogwheel_event_t evt;
+    int dif = 0;
+    while (jogwheel_event_get(&evt)) {
+        if (evt.type == JOGWHEEL_EVT_ENC) {
+            if ((dif ^ evt.val) < 0) { //direction changed
+                gui_jogwheel_dispatch(dif);
+                dif = 0;
+            }
+            gui_jogwheel_update_speed(&evt);
+            dif += evt.val;
+        } else if (evt.type == JOGWHEEL_EVT_BTN) {
+            gui_jogwheel_dispatch(dif);
+            dif = 0;
+            if (!evt.val ^ !gui_jogwheel_button_down) {
+                if (gui_jogwheel_button_down)
+                    screen_dispatch_event(window_capture_ptr, WINDOW_EVENT_BTN_UP, 0);
+                else
+                    screen_dispatch_event(window_capture_ptr, WINDOW_EVENT_BTN_DN, 0);
+                gui_jogwheel_button_down = evt.val;
+                gui_menu_timeout_reset();
+            }
+        }
+    }
+    gui_jogwheel_dispatch(dif);
+}
+    #endif //GUI_JOGWHEEL_SUPPORT
+
 void gui_loop(void) {
     ++guiloop_nesting;
     uint32_t delay;
     uint32_t tick;
     #ifdef GUI_JOGWHEEL_SUPPORT
-    if (jogwheel_changed) {
+    if (jogwheel_event_pending()) {
         if (gui_loop_cb)
             gui_loop_cb();
         jogwheel_changed = 0;
-        if ((jogwheel_encoder != gui_jogwheel_encoder)) {
-            int dif = jogwheel_encoder - gui_jogwheel_encoder;
-            if (dif > 0)
-                screen_dispatch_event(window_capture_ptr, WINDOW_EVENT_ENC_UP, (void *)dif);
-            else if (dif < 0)
-                screen_dispatch_event(window_capture_ptr, WINDOW_EVENT_ENC_DN, (void *)-dif);
-            gui_jogwheel_encoder = jogwheel_encoder;
-
-            //=======MENU_TIMEOUT=========
-            if (menu_timeout_enabled == 1) {
-                if (gui_get_menu_timeout_id() >= 0)
-                    gui_timer_reset(gui_get_menu_timeout_id());
-                else
-                    gui_timer_create_timeout((uint32_t)MENU_TIMEOUT_MS, (int16_t)-1);
-            }
-        }
-        if (!jogwheel_button_down ^ !gui_jogwheel_button_down) {
-            if (gui_jogwheel_button_down)
-                screen_dispatch_event(window_capture_ptr, WINDOW_EVENT_BTN_UP, 0);
-            else
-                screen_dispatch_event(window_capture_ptr, WINDOW_EVENT_BTN_DN, 0);
-            gui_jogwheel_button_down = jogwheel_button_down;
-
-            //=======MENU_TIMEOUT=========
-            if (menu_timeout_enabled == 1) {
-                if (gui_get_menu_timeout_id() >= 0)
-                    gui_timer_reset(gui_get_menu_timeout_id());
-                else
-                    gui_timer_create_timeout((uint32_t)MENU_TIMEOUT_MS, (int16_t)-1);
-            }
-        }
+        gui_jogwheel_events();
     }
     #endif //GUI_JOGWHEEL_SUPPORT
     delay = gui_timers_cycle();
+    tick = HAL_GetTick() - gui_loop_tick; // time since last loop event
+    if (tick >= GUI_DELAY_LOOP)
+        delay = 0;
+    else if (delay > (GUI_DELAY_LOOP - tick))
+        delay = GUI_DELAY_LOOP - tick;
     if (delay < GUI_DELAY_MIN)
         delay = GUI_DELAY_MIN;
-    if (delay > GUI_DELAY_MAX)
-        delay = GUI_DELAY_MAX;
     #ifdef GUI_USE_RTOS
-    osEvent evt = osSignalWait(GUI_SIG_REDRAW, delay);
-    if ((evt.status == osEventSignal) && (evt.value.signals & GUI_SIG_REDRAW))
+        #ifdef GUI_JOGWHEEL_SUPPORT
+    if (jogwheel_event_pending()) // notification could be consumed while waiting for display
+        delay = 0;
+        #endif //GUI_JOGWHEEL_SUPPORT
+    osEvent evt = osSignalWait(GUI_SIG_REDRAW | GUI_SIG_JOGWHEEL, delay);
+    if (((evt.status == osEventSignal) && (evt.value.signals & GUI_SIG_REDRAW)) || (gui_flags & GUI_FLG_INVALID))
     #endif //GUI_USE_RTOS
 
         gui_redraw();
@@ -181,7 +238,21 @@ int gui_msgbox(const char *text, uint16_t flags) {
 
 #ifdef GUI_JOGWHEEL_SUPPORT
 void gui_reset_jogwheel(void) {
-    gui_jogwheel_encoder = jogwheel_encoder;
+    jogwheel_event_flush();
     gui_jogwheel_button_down = jogwheel_button_down;
+    gui_jogwheel_speed = 0;
+}
+
+int gui_jogwheel_accel(int dif) {
+    int speed = (gui_jogwheel_speed < 0) ? -gui_jogwheel_speed : gui_jogwheel_speed;
+    int mul;
+    if ((HAL_GetTick() - gui_jogwheel_tick) >= GUI_JOGWHEEL_SPEED_TIMEOUT)
+        return dif;
+    if (speed <= GUI_JOGWHEEL_ACCEL_SPEED)
+        return dif;
+    mul = 1 + (speed - GUI_JOGWHEEL_ACCEL_SPEED) / GUI_JOGWHEEL_ACCEL_SLOPE;
+    if (mul > GUI_JOGWHEEL_ACCEL_MAX)
+        mul = GUI_JOGWHEEL_ACCEL_MAX;
+    return dif * mul;
 }
 #endif //GUI_JOGWHEEL_SUPPORT
@@ -4,14 +4,18 @@
 #include <string.h>
 #include "stm32f4xx_hal.h"
 #include "screen.h"
+#include "gui.h"
 
-#define GUI_MAX_TIMERS 5
+#define GUI_TIMER_POOL_STEP 8   // pool grows by this count of timers
+#define GUI_TIMER_ID_MAX    127 // ids are int8_t
 
 #define GUI_TIMER_NONE   0
 #define GUI_TIMER_1SHT   1
 #define GUI_TIMER_PERI   2
 #define GUI_MENU_TIMEOUT 3
 
+#define GUI_TIMER_NO_HEAP 0xff // timer is not waiting (not in heap)
+
 #pragma pack(push)
 #pragma pack(1)
 
@@ -27,39 +31,124 @@ typedef struct _gui_timer_t {
         };
     };
     int16_t win_id;
+    uint8_t heap_pos; // position in deadline heap
 } gui_timer_t;
 
 #pragma pack(pop)
 
-gui_timer_t gui_timers[GUI_MAX_TIMERS];
-int8_t gui_timer_count = -1;
+gui_timer_t *gui_timers = 0;  // timer pool, id = index
+uint8_t *gui_timer_heap = 0;  // ids of waiting timers, binary min-heap ordered by deadline
+uint8_t gui_timer_pool = 0;   // allocated timers
+uint8_t gui_timer_waiting = 0; // timers in heap
+int8_t gui_timer_count = 0;
 int8_t gui_menu_timeout_id = -1;
 
+static inline uint32_t gui_timer_deadline(uint8_t id) {
+    return gui_timers[id].start + gui_timers[id].delay;
+}
+
+// deadline of timer a is before deadline of timer b (tick overflow safe)
+static inline int gui_timer_before(uint8_t a, uint8_t b) {
+    return (int32_t)(gui_timer_deadline(a) - gui_timer_deadline(b)) < 0;
+}
+
+static void gui_timer_heap_set(uint8_t pos, uint8_t id) {
+    gui_timer_heap[pos] = id;
+    gui_timers[id].heap_pos = pos;
+}
+
+static void gui_timer_sift_up(uint8_t pos) {
+    uint8_t id = gui_timer_heap[pos];
+    while (pos > 0) {
+        uint8_t parent = (pos - 1) / 2;
+        if (!gui_timer_before(id, gui_timer_heap[parent]))
+            break;
+        gui_timer_heap_set(pos, gui_timer_heap[parent]);
+        pos = parent;
+    }
+    gui_timer_heap_set(pos, id);
+}
+
+static void gui_timer_sift_down(uint8_t pos) {
+    uint8_t id = gui_timer_heap[pos];
+    while (1) {
+        uint16_t child = 2 * pos + 1;
+        if (child >= gui_timer_waiting)
+            break;
+        if (((child + 1) < gui_timer_waiting) && gui_timer_before(gui_timer_heap[child + 1], gui_timer_heap[child]))
+            child++;
+        if (!gui_timer_before(gui_timer_heap[child], id))
+            break;
+        gui_timer_heap_set(pos, gui_timer_heap[child]);
+        pos = child;
+    }
+    gui_timer_heap_set(pos, id);
+}
+
+static void gui_timer_heap_insert(uint8_t id) {
+    gui_timer_heap_set(gui_timer_waiting, id);
+    gui_timer_sift_up(gui_timer_waiting++);
+}
+
+static void gui_timer_heap_remove(uint8_t id) {
+    uint8_t pos = gui_timers[id].heap_pos;
+    if (pos == GUI_TIMER_NO_HEAP)
+        return;
+    gui_timers[id].heap_pos = GUI_TIMER_NO_HEAP;
+    if (pos == --gui_timer_waiting)
+        return;
+    gui_timer_heap_set(pos, gui_timer_heap[gui_timer_waiting]);
+    if ((pos > 0) && gui_timer_before(gui_timer_heap[pos], gui_timer_heap[(pos - 1) / 2]))
+        gui_timer_sift_up(pos);
+    else
+        gui_timer_sift_down(pos);
+}
+
+// grow timer pool, returns 0 when no more timers can be allocated
+static int gui_timer_pool_grow(void) {
+    uint16_t pool = gui_timer_pool + GUI_TIMER_POOL_STEP;
+    gui_timer_t *timers;
+    uint8_t *heap;
+    if (pool > GUI_TIMER_ID_MAX)
+        pool = GUI_TIMER_ID_MAX;
+    if (pool <= gui_timer_pool)
+        return 0;
+    if ((timers = (gui_timer_t *)gui_malloc(pool * sizeof(gui_timer_t))) == 0)
+        return 0;
+    if ((heap = (uint8_t *)gui_malloc(pool)) == 0) {
+        gui_free(timers);
+        return 0;
+    }
+    memset(timers, 0, pool * sizeof(gui_timer_t));
+    if (gui_timers) {
+        memcpy(timers, gui_timers, gui_timer_pool * sizeof(gui_timer_t));
+        memcpy(heap, gui_timer_heap, gui_timer_waiting);
+        gui_free(gui_timers);
+        gui_free(gui_timer_heap);
+    }
+    gui_timers = timers;
+    gui_timer_heap = heap;
+    gui_timer_pool = pool;
+    return 1;
+}
+
 int8_t gui_timer_new(uint8_t timer, uint32_t ms, int16_t win_id) {
     window_t *window;
-    uint32_t tick = HAL_GetTick();
-    int8_t id = -1;
-    if (gui_timer_count < GUI_MAX_TIMERS) {
-        id = 0;
-        if (gui_timer_count == -1) //not initialized
-        {
-            gui_timer_count = 0;
-            memset(gui_timers, 0, GUI_MAX_TIMERS * sizeof(gui_timer_t));
-        } else //find free id
-            while ((id < GUI_MAX_TIMERS) && (gui_timers[id].f_timer != GUI_TIMER_NONE))
-                id++;
-        if (id < GUI_MAX_TIMERS) //id is valid
-        {
-            gui_timers[id].start = tick;
-            gui_timers[id].delay = ms;
-            gui_timers[id].f_timer = timer;
-            gui_timers[id].win_id = win_id;
-            gui_timer_count++; //increment count
-            if ((window = window_ptr(win_id)) != 0)
-                window->f_timer = 1; //set timer flag
-        } else
-            id = -1;
-    }
+    int8_t id = 0;
+    while ((id < gui_timer_pool) && (gui_timers[id].f_timer != GUI_TIMER_NONE)) //find free id
+        id++;
+    if ((id >= gui_timer_pool) && !gui_timer_pool_grow())
+        return -1;
+    gui_timers[id].start = HAL_GetTick();
+    gui_timers[id].delay = ms;
+    gui_timers[id].f_timer = timer;
+    gui_timers[id].win_id = win_id;
+    gui_timers[id].heap_pos = GUI_TIMER_NO_HEAP;
+    gui_timer_count++; //increment count
+    if (ms > 0)
+        gui_timer_heap_insert(id);
+    if ((window = window_ptr(win_id)) != 0)
+        window->f_timer = 1; //set timer flag
     return id;
 }
 
@@ -77,7 +166,8 @@ int8_t gui_timer_create_timeout(uint32_t ms, int16_t win_id) {
 }
 
 void gui_timer_delete(int8_t id) {
-    if ((id >= 0) && (id < GUI_MAX_TIMERS) && (gui_timers[id].f_timer != GUI_TIMER_NONE)) {
+    if ((id >= 0) && (id < gui_timer_pool) && (gui_timers[id].f_timer != GUI_TIMER_NONE)) {
+        gui_timer_heap_remove(id);
         gui_timers[id].start = 0;
         gui_timers[id].delay = 0;
         if (gui_timers[id].f_timer == GUI_MENU_TIMEOUT)
@@ -90,55 +180,55 @@ void gui_timer_delete(int8_t id) {
 
 void gui_timers_delete_by_window_id(int16_t win_id) {
     int8_t id;
-    for (id = 0; id < GUI_MAX_TIMERS; id++)
-        if (gui_timers[id].win_id == win_id)
+    for (id = 0; id < gui_timer_pool; id++)
+        if ((gui_timers[id].f_timer != GUI_TIMER_NONE) && (gui_timers[id].win_id == win_id))
             gui_timer_delete(id);
 }
 
 uint32_t gui_timers_cycle(void) {
     uint32_t tick = HAL_GetTick();
-    uint32_t delay;
-    uint32_t diff;
-    uint32_t diff_min = 0xffffffff;
-    uint8_t f_timer;
-    uint8_t count = 0;
-    int8_t id;
-    for (id = 0; (id < GUI_MAX_TIMERS); id++)
-        if ((f_timer = gui_timers[id].f_timer) != GUI_TIMER_NONE) {
-            if ((delay = gui_timers[id].delay) > 0) {
-                diff = tick - gui_timers[id].start;
-                if (delay <= diff) {
-                    switch (gui_timers[id].f_timer) {
-                    case GUI_TIMER_1SHT:
-                        screen_dispatch_event(window_ptr(gui_timers[id].win_id), WINDOW_EVENT_TIMER, (void *)(int)id);
-                        gui_timers[id].delay = 0;
-                        break;
-                    case GUI_TIMER_PERI:
-                        screen_dispatch_event(window_ptr(gui_timers[id].win_id), WINDOW_EVENT_TIMER, (void *)(int)id);
-                        gui_timers[id].start += delay;
-                        break;
-                    case GUI_MENU_TIMEOUT:
-                        gui_timers[id].delay = 0;
-                        break;
-                    }
-                } else if (diff_min < diff)
-                    diff_min = diff;
-            }
-            if (++count >= gui_timer_count)
-                break;
+    uint32_t deadline;
+    uint8_t id;
+    // only expired timers are visited, event handlers can create and delete timers
+    while (gui_timer_waiting) {
+        id = gui_timer_heap[0];
+        deadline = gui_timer_deadline(id);
+        if ((int32_t)(tick - deadline) < 0)
+            return deadline - tick;
+        switch (gui_timers[id].f_timer) {
+        case GUI_TIMER_PERI:
+            gui_timers[id].start = deadline;
+            if ((int32_t)(tick - gui_timer_deadline(id)) >= 0)
+                gui_timers[id].start = tick; //missed periods are skipped
+            gui_timer_sift_down(0);
+            screen_dispatch_event(window_ptr(gui_timers[id].win_id), WINDOW_EVENT_TIMER, (void *)(int)id);
+            break;
+        case GUI_TIMER_1SHT:
+            gui_timer_heap_remove(id);
+            gui_timers[id].delay = 0;
+            screen_dispatch_event(window_ptr(gui_timers[id].win_id), WINDOW_EVENT_TIMER, (void *)(int)id);
+            break;
+        default: // GUI_MENU_TIMEOUT
+            gui_timer_heap_remove(id);
+            gui_timers[id].delay = 0;
+            break;
         }
-    return diff_min;
+    }
+    return 0xffffffff;
 }
 
 void gui_timer_reset(int8_t id) {
 
-    if ((id >= 0) && (id < GUI_MAX_TIMERS) && (gui_timers[id].f_timer != GUI_TIMER_NONE))
+    if ((id >= 0) && (id < gui_timer_pool) && (gui_timers[id].f_timer != GUI_TIMER_NONE)) {
         gui_timers[id].start = HAL_GetTick();
+        if (gui_timers[id].heap_pos != GUI_TIMER_NO_HEAP)
+            gui_timer_sift_down(gui_timers[id].heap_pos); // deadline can only move later
+    }
 }
 
 int8_t gui_timer_expired(int8_t id) {
 
-    if ((id >= 0) && (id < GUI_MAX_TIMERS) && (gui_timers[id].f_timer != GUI_TIMER_NONE))
+    if ((id >= 0) && (id < gui_timer_pool) && (gui_timers[id].f_timer != GUI_TIMER_NONE))
         return gui_timers[id].delay == 0 ? 1 : 0;
 
     return -1;
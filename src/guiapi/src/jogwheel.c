@@ -6,17 +6,60 @@
 
 uint8_t jogwheel_signals = 0;
 uint8_t jogwheel_signals_old = 0;
-uint8_t jogwheel_signals_new = 0;
 int32_t jogwheel_encoder = 0;
 int32_t jogwheel_encoder_min = INT_MIN;
 int32_t jogwheel_encoder_max = INT_MAX;
 uint16_t jogwheel_button_down = 0;
 uint8_t jogwheel_changed = 0;
+jogwheel_event_cb_t *jogwheel_event_cb = 0;
+
+int8_t jogwheel_quarter = 0; // quarter steps since last count
+
+jogwheel_event_t jogwheel_queue[JOGWHEEL_EVENT_QUEUE];
+volatile uint8_t jogwheel_queue_head = 0; // written by interrupt
+volatile uint8_t jogwheel_queue_tail = 0; // written by gui thread
+
+// quadrature transition table, index = (old_phases << 2) | new_phases
+// +1 for 00->01->11->10->00, invalid transitions (both phases changed) are ignored
+static const int8_t jogwheel_quad_table[16] = {
+    0, 1, -1, 0, -1, 0, 0, 1, 1, 0, 0, -1, 0, -1, 1, 0
+};
+
+static void jogwheel_event_put(uint8_t type, int8_t val) {
+    uint8_t head = jogwheel_queue_head;
+    uint8_t last = (head - 1) & (JOGWHEEL_EVENT_QUEUE - 1);
+    if (((uint8_t)(head - jogwheel_queue_tail)) >= JOGWHEEL_EVENT_QUEUE) {
+        //queue full, merge encoder steps into the newest event so that no step is lost
+        if ((type == JOGWHEEL_EVT_ENC) && (jogwheel_queue[last].type == JOGWHEEL_EVT_ENC) && ((jogwheel_queue[last].val ^ val) >= 0) && (jogwheel_queue[last].val > -100) && (jogwheel_queue[last].val < 100))
+            jogwheel_queue[last].val += val;
+    } else {
+        jogwheel_event_t *pevt = jogwheel_queue + (head & (JOGWHEEL_EVENT_QUEUE - 1));
+        pevt->tick = HAL_GetTick();
+        pevt->type = type;
+        pevt->val = val;
+        jogwheel_queue_head = head + 1;
+    }
+    if (jogwheel_event_cb)
+        jogwheel_event_cb();
+}
+
+static uint8_t jogwheel_read_phases(void) {
+    uint8_t signals = 0;
+    if (gpio_get(jogwheel_config.pinEN1))
+        signals |= 1; //bit 0 - phase0
+    if (gpio_get(jogwheel_config.pinEN2))
+        signals |= 2; //bit 1 - phase1
+    if (jogwheel_config.flg & JOGWHEEL_FLG_INV_E12)
+        signals ^= 3;
+    return signals;
+}
 
 void jogwheel_init(void) {
-    gpio_init(jogwheel_config.pinEN1, GPIO_MODE_INPUT, GPIO_PULLUP, GPIO_SPEED_FREQ_LOW);
-    gpio_init(jogwheel_config.pinEN2, GPIO_MODE_INPUT, GPIO_PULLUP, GPIO_SPEED_FREQ_LOW);
+    gpio_init(jogwheel_config.pinEN1, GPIO_MODE_IT_RISING_FALLING, GPIO_PULLUP, GPIO_SPEED_FREQ_LOW);
+    gpio_init(jogwheel_config.pinEN2, GPIO_MODE_IT_RISING_FALLING, GPIO_PULLUP, GPIO_SPEED_FREQ_LOW);
     gpio_init(jogwheel_config.pinENC, GPIO_MODE_INPUT, GPIO_PULLUP, GPIO_SPEED_FREQ_LOW);
+    jogwheel_signals = (jogwheel_signals & 4) | jogwheel_read_phases();
+    jogwheel_quarter = 0;
 }
 
 void jogwheel_update_1ms(void) {
@@ -25,62 +68,82 @@ void jogwheel_update_1ms(void) {
         signals |= 4; //bit 2 - button press
     if (jogwheel_config.flg & JOGWHEEL_FLG_INV_ENC)
         signals ^= 4;
-    if (gpio_get(jogwheel_config.pinEN1))
-        signals |= 1; //bit 0 - phase0
-    if (gpio_get(jogwheel_config.pinEN2))
-        signals |= 2; //bit 1 - phase1
-    if (jogwheel_config.flg & JOGWHEEL_FLG_INV_E12)
-        signals ^= 3;
-    if (jogwheel_config.flg & JOGWHEEL_FLG_FILTER2)
-        if (jogwheel_signals_new != signals) {
-            jogwheel_signals_new = signals;
-            return;
-        }
-    uint8_t change = signals ^ jogwheel_signals;
-    if (change & 3) //encoder phase signals changed
-    {
-        uint8_t change2 = jogwheel_signals ^ jogwheel_signals_old;
-        int32_t encoder = jogwheel_encoder;
-        int32_t dir = (jogwheel_config.flg & JOGWHEEL_FLG_INV_DIR) ? -1 : 1;
-        if ((jogwheel_config.flg & JOGWHEEL_FLG_2PULSES)) {
-            if (((signals & 3) == 0) || ((signals & 3) == 3)) {
-                if (((change & 3) == 1) && ((change2 & 3) == 2))
-                    encoder += dir;
-                if (((change & 3) == 2) && ((change2 & 3) == 1))
-                    encoder -= dir;
-            }
-        } else {
-            if ((change & 1) && (signals & 1) && !(signals & 2))
-                encoder += dir;
-            if ((change & 2) && (signals & 2) && !(signals & 1))
-                encoder -= dir;
-        }
-        if (encoder < jogwheel_encoder_min)
-            encoder = jogwheel_encoder_min;
-        if (encoder > jogwheel_encoder_max)
-            encoder = jogwheel_encoder_max;
-        if (jogwheel_encoder != encoder) {
-            jogwheel_encoder = encoder;
-            change |= 8; //bit3 means encoder changed
-        }
-    }
     if (signals & 4)
         jogwheel_button_down++;
     else
         jogwheel_button_down = 0;
-    if (change & 7) //encoder phase signals or button changed
+    if ((signals ^ jogwheel_signals) & 4) //button changed
     {
         jogwheel_signals_old = jogwheel_signals; //save old signal state
-        jogwheel_signals = signals;              //update signal state
+        jogwheel_signals ^= 4;                   //update signal state
+        jogwheel_changed |= 1;                   //synchronization is not necessary because we are inside interrupt
+        jogwheel_event_put(JOGWHEEL_EVT_BTN, (signals & 4) ? 1 : 0);
     }
-    if (change & 12) //encoder changed or button changed
-    {
-        jogwheel_signals_old = jogwheel_signals; //save old signal state
-        jogwheel_signals = signals;              //update signal state
-        jogwheel_changed |= (change >> 2);       //synchronization is not necessary because we are inside interrupt
+}
+
+void jogwheel_update_exti(void) {
+    uint8_t signals = jogwheel_read_phases();
+    uint8_t old = jogwheel_signals & 3;
+    int8_t steps = (jogwheel_config.flg & JOGWHEEL_FLG_2PULSES) ? 2 : 4; //quarter steps per count
+    int8_t detent = (jogwheel_config.flg & JOGWHEEL_FLG_2PULSES) ? ((signals == 0) || (signals == 3)) : (signals == 0);
+    int32_t dir = (jogwheel_config.flg & JOGWHEEL_FLG_INV_DIR) ? -1 : 1;
+    int32_t count = 0;
+    if (signals == old)
+        return;
+    if (jogwheel_config.flg & JOGWHEEL_FLG_2PULSES)
+        dir = -dir; //2pulses encoder counts in opposite phase order
+    jogwheel_quarter += jogwheel_quad_table[(old << 2) | signals];
+    if (detent) {
+        //resynchronize on detent position, half step is enough (missed or bouncing edge)
+        if (jogwheel_quarter >= (steps / 2))
+            count = 1;
+        else if (jogwheel_quarter <= -(steps / 2))
+            count = -1;
+        jogwheel_quarter = 0;
+    } else if (jogwheel_quarter >= steps) {
+        count = 1;
+        jogwheel_quarter -= steps;
+    } else if (jogwheel_quarter <= -steps) {
+        count = -1;
+        jogwheel_quarter += steps;
+    }
+    jogwheel_signals_old = jogwheel_signals;
+    jogwheel_signals = (jogwheel_signals & 4) | signals;
+    if (count) {
+        int32_t encoder = jogwheel_encoder + count * dir;
+        if (encoder < jogwheel_encoder_min)
+            encoder = jogwheel_encoder_min;
+        if (encoder > jogwheel_encoder_max)
+            encoder = jogwheel_encoder_max;
+        jogwheel_encoder = encoder;
+        jogwheel_changed |= 2; //synchronization is not necessary because we are inside interrupt
+        jogwheel_event_put(JOGWHEEL_EVT_ENC, count * dir);
     }
 }
 
+int jogwheel_event_get(jogwheel_event_t *pevt) {
+    int ret = 0;
+    int irq = __get_PRIMASK() & 1;
+    __disable_irq(); //newest event can be modified by interrupt when queue is full
+    uint8_t tail = jogwheel_queue_tail;
+    if (tail != jogwheel_queue_head) {
+        *pevt = jogwheel_queue[tail & (JOGWHEEL_EVENT_QUEUE - 1)];
+        jogwheel_queue_tail = tail + 1;
+        ret = 1;
+    }
+    if (!irq)
+        __enable_irq();
+    return ret;
+}
+
+int jogwheel_event_pending(void) {
+    return jogwheel_queue_tail != jogwheel_queue_head;
+}
+
+void jogwheel_event_flush(void) {
+    jogwheel_queue_tail = jogwheel_queue_head;
+}
+
 void jogwheel_encoder_set(int32_t val, int32_t min, int32_t max) {
     if (min > max)
         return;
@@ -89,6 +152,7 @@ void jogwheel_encoder_set(int32_t val, int32_t min, int32_t max) {
     if (val > max)
         val = max;
     jogwheel_encoder = val;
+    jogwheel_quarter = 0;
     jogwheel_encoder_min = min;
     jogwheel_encoder_max = max;
 }
@@ -172,7 +172,9 @@ void st7789v_spi_wr_bytes(uint8_t *pb, uint16_t size) {
 #endif //ST7789V_USE_RTOS
         HAL_SPI_Transmit_DMA(st7789v_config.phspi, pb, size);
 #ifdef ST7789V_USE_RTOS
-        osSignalWait(ST7789V_SIG_SPI_TX, osWaitForever);
+        //thread can be woken up by other signal (e.g. jogwheel event), wait for transfer complete
+        while (!(osSignalWait(ST7789V_SIG_SPI_TX, osWaitForever).value.signals & ST7789V_SIG_SPI_TX))
+            ;
 #else  //ST7789V_USE_RTOS
 //TODO:
 #endif //ST7789V_USE_RTOS
@@ -654,6 +656,7 @@ void st7789v_draw_icon(point_ui16_t pt, uint16_t id_res, color_t clr0, uint8_t r
 #ifdef ST7789V_PNG_SUPPORT
 
     #include <png.h>
+    #include "ccmram.h"
 
 void *png_mem_ptr0 = 0;
 uint32_t png_mem_total = 0;
@@ -667,9 +670,11 @@ png_voidp _pngmalloc(png_structp pp, png_alloc_size_t size) {
     //	return pvPortMalloc(size);
     if (png_mem_ptr0 == 0)
         //png_mem_ptr0 = pvPortMalloc(0xc000); //48k
-        png_mem_ptr0 = (void *)0x10000000; //ccram
+        png_mem_ptr0 = &_sccmheap; //ccram (behind planner and gcode queue)
     int i;
     void *p = ((uint8_t *)png_mem_ptr0) + png_mem_total;
+    if (((uint8_t *)p + size) > &_eccmheap)
+        return 0;
     //	if (p == 0)
     //		while (1);
     //	else
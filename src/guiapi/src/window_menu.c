@@ -281,10 +281,10 @@ void window_menu_item_select(window_menu_t *window, int dif) {
 void window_menu_inc(window_menu_t *window, int dif) {
     switch (window->mode) {
     case WI_SPIN:
-        window_menu_item_spin(window, dif);
+        window_menu_item_spin(window, gui_jogwheel_accel(dif));
         break;
     case WI_SPIN_FL:
-        window_menu_item_spin_fl(window, dif);
+        window_menu_item_spin_fl(window, gui_jogwheel_accel(dif));
         break;
     case WI_SELECT:
         window_menu_item_select(window, dif);
@@ -27,10 +27,10 @@ void window_spin_event(window_spin_t *window, uint8_t event, void *param) {
         window_set_capture(window->window.win.id_parent);
         break;
     case WINDOW_EVENT_ENC_DN:
-        window_spin_dec(window, (int)param);
+        window_spin_dec(window, gui_jogwheel_accel((int)param));
         break;
     case WINDOW_EVENT_ENC_UP:
-        window_spin_inc(window, (int)param);
+        window_spin_inc(window, gui_jogwheel_accel((int)param));
         break;
     case WINDOW_EVENT_CAPT_0:
     case WINDOW_EVENT_CAPT_1:
@@ -53,6 +53,10 @@
 #include "app.h"
 #include "dbg.h"
 #include "diag.h"
+#include "dump.h"
+#include "print_journal.h"
+#include "print_estimate.h"
+#include "fan_tacho.h"
 #include "timer_defaults.h"
 #include "thread_measurement.h"
 
@@ -74,6 +78,7 @@
 
 /* Private variables ---------------------------------------------------------*/
 ADC_HandleTypeDef hadc1;
+DMA_HandleTypeDef hdma_adc1;
 
 I2C_HandleTypeDef hi2c1;
 
@@ -148,9 +153,6 @@ uint8_t uart6rx_data[32];
 uartslave_t uart6slave;
 char uart6slave_line[32];
 
-volatile uint32_t Tacho_FAN0;
-volatile uint32_t Tacho_FAN1;
-
 /* USER CODE END 0 */
 
 /**
@@ -222,6 +224,9 @@ int main(void) {
     HAL_PWM_Initialized = 1;
     HAL_SPI_Initialized = 1;
 
+    journal_init(); // before dump_init, chip id can not be read while dump slot is erased
+    dump_init();
+
     uartrxbuff_init(&uart1rxbuff, &huart1, &hdma_usart1_rx, sizeof(uart1rx_data), uart1rx_data);
     uartrxbuff_open(&uart1rxbuff);
 
@@ -269,6 +274,12 @@ int main(void) {
     osThreadDef(measurementTask, StartMeasurementTask, osPriorityNormal, 0, 512);
     osThreadCreate(osThread(measurementTask), NULL);
 
+#ifdef PRINT_ESTIMATE
+    /* definition and creation of estimateTask */
+    osThreadDef(estimateTask, StartEstimateTask, osPriorityNormal, 0, 512);
+    osThreadCreate(osThread(estimateTask), NULL);
+#endif //PRINT_ESTIMATE
+
     /* USER CODE END RTOS_THREADS */
 
     /* USER CODE BEGIN RTOS_QUEUES */
@@ -351,23 +362,51 @@ static void MX_ADC1_Init(void) {
     hadc1.Instance = ADC1;
     hadc1.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV4;
     hadc1.Init.Resolution = ADC_RESOLUTION_12B;
-    hadc1.Init.ScanConvMode = DISABLE;
-    hadc1.Init.ContinuousConvMode = DISABLE;
+    hadc1.Init.ScanConvMode = ENABLE;
+    hadc1.Init.ContinuousConvMode = ENABLE;
     hadc1.Init.DiscontinuousConvMode = DISABLE;
     hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
     hadc1.Init.ExternalTrigConv = ADC_SOFTWARE_START;
     hadc1.Init.DataAlign = ADC_DATAALIGN_RIGHT;
-    hadc1.Init.NbrOfConversion = 1;
-    hadc1.Init.DMAContinuousRequests = DISABLE;
-    hadc1.Init.EOCSelection = ADC_EOC_SINGLE_CONV;
+    hadc1.Init.NbrOfConversion = 5;
+    hadc1.Init.DMAContinuousRequests = ENABLE;
+    hadc1.Init.EOCSelection = ADC_EOC_SEQ_CONV;
     if (HAL_ADC_Init(&hadc1) != HAL_OK) {
         Error_Handler();
     }
     /**Configure for the selected ADC regular channel its corresponding rank in the sequencer and its sample time.
   */
-    sConfig.Channel = ADC_CHANNEL_4;
+    sConfig.Channel = ADC_CHANNEL_3;
     sConfig.Rank = 1;
-    sConfig.SamplingTime = ADC_SAMPLETIME_3CYCLES;
+    sConfig.SamplingTime = ADC_SAMPLETIME_480CYCLES;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK) {
+        Error_Handler();
+    }
+    /**Configure for the selected ADC regular channel its corresponding rank in the sequencer and its sample time.
+  */
+    sConfig.Channel = ADC_CHANNEL_4;
+    sConfig.Rank = 2;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK) {
+        Error_Handler();
+    }
+    /**Configure for the selected ADC regular channel its corresponding rank in the sequencer and its sample time.
+  */
+    sConfig.Channel = ADC_CHANNEL_5;
+    sConfig.Rank = 3;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK) {
+        Error_Handler();
+    }
+    /**Configure for the selected ADC regular channel its corresponding rank in the sequencer and its sample time.
+  */
+    sConfig.Channel = ADC_CHANNEL_6;
+    sConfig.Rank = 4;
+    if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK) {
+        Error_Handler();
+    }
+    /**Configure for the selected ADC regular channel its corresponding rank in the sequencer and its sample time.
+  */
+    sConfig.Channel = ADC_CHANNEL_10;
+    sConfig.Rank = 5;
     if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK) {
         Error_Handler();
     }
@@ -933,10 +972,10 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
     switch (GPIO_Pin) {
     case GPIO_PIN_10:
-        Tacho_FAN1++;
+        fan_tacho_edge(1);
         break;
     case GPIO_PIN_14:
-        Tacho_FAN0++;
+        fan_tacho_edge(0);
         break;
     }
 }
@@ -0,0 +1,293 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "../../lib/Marlin/Marlin/src/inc/MarlinConfig.h"
+
+#if ENABLED(ARC_SUPPORT)
+
+    #include "../../lib/Marlin/Marlin/src/gcode/gcode.h"
+    #include "../../lib/Marlin/Marlin/src/module/motion.h"
+    #include "../../lib/Marlin/Marlin/src/module/planner.h"
+    #include "../../lib/Marlin/Marlin/src/module/temperature.h"
+
+    #if N_ARC_CORRECTION < 1
+        #undef N_ARC_CORRECTION
+        #define N_ARC_CORRECTION 1
+    #endif
+
+    #ifndef ARC_SEGMENT_TOLERANCE
+        #define ARC_SEGMENT_TOLERANCE 0.005f
+    #endif
+    #ifndef MIN_ARC_SEGMENT_MM
+        #define MIN_ARC_SEGMENT_MM 0.1f
+    #endif
+    #ifndef MAX_ARC_SEGMENT_MM
+        #define MAX_ARC_SEGMENT_MM 2.0f
+    #endif
+    #ifndef ARC_SEGMENT_MIN_TIME
+        #define ARC_SEGMENT_MIN_TIME 0.002f
+    #endif
+
+/**
+ * Segment length for arc with given radius and feedrate.
+ *
+ * Accuracy limit: chord of length L deviates from arc by e = r - sqrt(r^2 - L^2/4),
+ * so for tolerance e the longest chord is L = 2 * sqrt(e * (2r - e)).
+ * Throughput limit: segment should last at least ARC_SEGMENT_MIN_TIME, the limit
+ * is relaxed linearly as the planner fills up (full planner does not starve).
+ */
+static float arc_segment_length(const float radius, const feedRate_t fr_mm_s) {
+    const float tol = _MIN(float(ARC_SEGMENT_TOLERANCE), radius);
+    float seg_mm = 2 * SQRT(tol * (2 * radius - tol));
+    const float fill = float(planner.movesplanned()) / (BLOCK_BUFFER_SIZE - 1);
+    if (fill < 1)
+        NOLESS(seg_mm, fr_mm_s * float(ARC_SEGMENT_MIN_TIME) * (1 - fill));
+    return constrain(seg_mm, float(MIN_ARC_SEGMENT_MM), float(MAX_ARC_SEGMENT_MM));
+}
+
+/**
+ * Plan an arc in 2 dimensions
+ *
+ * The arc is approximated by generating many small linear segments.
+ * Segment length is chosen by arc_segment_length(), each segment position is
+ * rotated from previous one by precomputed sin/cos matrix, every N_ARC_CORRECTION
+ * segments the position is computed exactly from the initial radius vector.
+ */
+void plan_arc(
+    const xyze_pos_t &cart,   // Destination position
+    const ab_float_t &offset, // Center of rotation relative to current_position
+    const uint8_t clockwise   // Clockwise?
+) {
+    #if ENABLED(CNC_WORKSPACE_PLANES)
+    AxisEnum p_axis, q_axis, l_axis;
+    switch (gcode.workspace_plane) {
+    default:
+    case GcodeSuite::PLANE_XY:
+        p_axis = X_AXIS;
+        q_axis = Y_AXIS;
+        l_axis = Z_AXIS;
+        break;
+    case GcodeSuite::PLANE_YZ:
+        p_axis = Y_AXIS;
+        q_axis = Z_AXIS;
+        l_axis = X_AXIS;
+        break;
+    case GcodeSuite::PLANE_ZX:
+        p_axis = Z_AXIS;
+        q_axis = X_AXIS;
+        l_axis = Y_AXIS;
+        break;
+    }
+    #else
+    constexpr AxisEnum p_axis = X_AXIS, q_axis = Y_AXIS, l_axis = Z_AXIS;
+    #endif
+
+    // Radius vector from center to current location
+    ab_float_t rvec = -offset;
+
+    const float radius = HYPOT(rvec.a, rvec.b),
+                center_P = current_position[p_axis] - rvec.a,
+                center_Q = current_position[q_axis] - rvec.b,
+                rt_X = cart[p_axis] - center_P,
+                rt_Y = cart[q_axis] - center_Q,
+                linear_travel = cart[l_axis] - current_position[l_axis],
+                extruder_travel = cart.e - current_position.e;
+
+    // CCW angle of rotation between position and target from the circle center. Only one atan2() trig computation required.
+    float angular_travel = ATAN2(rvec.a * rt_Y - rvec.b * rt_X, rvec.a * rt_X + rvec.b * rt_Y);
+    if (angular_travel < 0)
+        angular_travel += RADIANS(360);
+    if (clockwise)
+        angular_travel -= RADIANS(360);
+
+    // Make a circle if the angular rotation is 0 and the target is current position
+    if (angular_travel == 0 && current_position[p_axis] == cart[p_axis] && current_position[q_axis] == cart[q_axis])
+        angular_travel = RADIANS(360);
+
+    const float flat_mm = radius * angular_travel,
+                mm_of_travel = linear_travel ? HYPOT(flat_mm, linear_travel) : ABS(flat_mm);
+    if (mm_of_travel < 0.001f)
+        return;
+
+    const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
+
+    uint16_t segments = CEIL(mm_of_travel / arc_segment_length(radius, scaled_fr_mm_s));
+    NOLESS(segments, 1U);
+
+    const float segment_mm = mm_of_travel / segments,
+                theta_per_segment = angular_travel / segments,
+                linear_per_segment = linear_travel / segments,
+                extruder_per_segment = extruder_travel / segments,
+                sin_T = sinf(theta_per_segment),
+                cos_T = cosf(theta_per_segment);
+
+    xyze_pos_t raw;
+
+    // Initialize the linear axis
+    raw[l_axis] = current_position[l_axis];
+
+    // Initialize the extruder axis
+    raw.e = current_position.e;
+
+    millis_t next_idle_ms = millis() + 200UL;
+
+    #if N_ARC_CORRECTION > 1
+    int8_t arc_recalc_count = N_ARC_CORRECTION;
+    #endif
+
+    for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
+
+        thermalManager.manage_heater();
+        if (ELAPSED(millis(), next_idle_ms)) {
+            next_idle_ms = millis() + 200UL;
+            idle();
+        }
+
+    #if N_ARC_CORRECTION > 1
+        if (--arc_recalc_count) {
+            // Apply vector rotation matrix to previous rvec
+            const float r_new_Y = rvec.a * sin_T + rvec.b * cos_T;
+            rvec.a = rvec.a * cos_T - rvec.b * sin_T;
+            rvec.b = r_new_Y;
+        } else
+    #endif
+        {
+    #if N_ARC_CORRECTION > 1
+            arc_recalc_count = N_ARC_CORRECTION;
+    #endif
+            // Exact location from initial radius vector (removes accumulated rounding error)
+            const float cos_Ti = cosf(i * theta_per_segment), sin_Ti = sinf(i * theta_per_segment);
+            rvec.a = -offset[0] * cos_Ti + offset[1] * sin_Ti;
+            rvec.b = -offset[0] * sin_Ti - offset[1] * cos_Ti;
+        }
+
+        // Update raw location
+        raw[p_axis] = center_P + rvec.a;
+        raw[q_axis] = center_Q + rvec.b;
+        raw[l_axis] += linear_per_segment;
+        raw.e += extruder_per_segment;
+
+        apply_motion_limits(raw);
+
+    #if HAS_LEVELING && !PLANNER_LEVELING
+        planner.apply_leveling(raw);
+    #endif
+
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, segment_mm))
+            break;
+    }
+
+    // Ensure last segment arrives at target location.
+    raw = cart;
+
+    apply_motion_limits(raw);
+
+    #if HAS_LEVELING && !PLANNER_LEVELING
+    planner.apply_leveling(raw);
+    #endif
+
+    planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, segment_mm);
+
+    current_position = raw;
+}
+
+/**
+ * G2: Clockwise Arc
+ * G3: Counterclockwise Arc
+ *
+ * This command has two forms: IJ-form and R-form.
+ *
+ *  - I specifies an X offset. J specifies a Y offset.
+ *    At least one of the IJ parameters is required.
+ *    X and Y can be omitted to do a complete circle.
+ *    The given XY is not error-checked. The arc ends
+ *     based on the angle of the destination.
+ *    Mixing I or J with R will throw an error.
+ *
+ *  - R specifies the radius. X or Y is required.
+ *    Omitting both X and Y will throw an error.
+ *    X or Y must differ from the current XY.
+ *    Mixing R with I or J will throw an error.
+ *
+ *  - P specifies the number of full circles to do
+ *    before the specified arc move.
+ *
+ *  Examples:
+ *
+ *    G2 I10           ; CW circle centered at X+10
+ *    G3 X20 Y12 R14   ; CCW circle with r=14 ending at X20 Y12
+ */
+void GcodeSuite::G2_G3(const bool clockwise) {
+    if (MOTION_CONDITIONS) {
+
+    #if ENABLED(SF_ARC_FIX)
+        const bool relative_mode_backup = relative_mode;
+        relative_mode = true;
+    #endif
+
+        get_destination_from_command();
+
+    #if ENABLED(SF_ARC_FIX)
+        relative_mode = relative_mode_backup;
+    #endif
+
+        ab_float_t arc_offset = { 0, 0 };
+        if (parser.seenval('R')) {
+            const float r = parser.value_linear_units();
+            if (r) {
+                const xy_pos_t p1 = current_position, p2 = destination;
+                if (p1 != p2) {
+                    const xy_pos_t d2 = (p2 - p1) * 0.5f;         // XY vector to midpoint of move from current
+                    const float e = clockwise ^ (r < 0) ? -1 : 1, // clockwise -1/1, counterclockwise 1/-1
+                        len = d2.magnitude(),                     // Distance to mid-point of move from current
+                        h2 = (r - len) * (r + len),               // factored to reduce rounding error
+                        h = (h2 >= 0) ? SQRT(h2) : 0.0f;          // Distance to the arc pivot-point from midpoint
+                    const xy_pos_t s = { -d2.y, d2.x };           // Perpendicular bisector. (Divide by len for unit vector.)
+                    arc_offset = d2 + s / len * e * h;            // The calculated offset (mid-point if |r| <= len)
+                }
+            }
+        } else {
+            if (parser.seenval('I'))
+                arc_offset.a = parser.value_linear_units();
+            if (parser.seenval('J'))
+                arc_offset.b = parser.value_linear_units();
+        }
+
+        if (arc_offset) {
+
+    #if ENABLED(ARC_P_CIRCLES)
+            // P indicates number of circles to do
+            int8_t circles_to_do = parser.byteval('P');
+            if (!WITHIN(circles_to_do, 0, 100))
+                SERIAL_ERROR_MSG(MSG_ERR_ARC_ARGS);
+            while (circles_to_do--)
+                plan_arc(current_position, arc_offset, clockwise);
+    #endif
+
+            // Send the arc to the planner
+            plan_arc(destination, arc_offset, clockwise);
+            reset_stepper_timeout();
+        } else
+            SERIAL_ERROR_MSG(MSG_ERR_ARC_ARGS);
+    }
+}
+
+#endif // ARC_SUPPORT
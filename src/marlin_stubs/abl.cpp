@@ -0,0 +1,215 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2019 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Bilinear ABL grid (override of Marlin's feature/bedlevel/abl/abl.cpp, excluded in lib/AddMarlin.cmake)
+ *
+ * refresh_bed_level() and bilinear_z_offset() are the points where Marlin uses the grid,
+ * with ABL_BICUBIC they call the bicubic interpolation (abl_bicubic.cpp) when the grid is complete.
+ */
+#include "../../lib/Marlin/Marlin/src/inc/MarlinConfig.h"
+
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+
+    #include "../../lib/Marlin/Marlin/src/feature/bedlevel/bedlevel.h"
+    #include "../../lib/Marlin/Marlin/src/module/motion.h"
+    #include "abl_bicubic.h"
+
+    #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
+    #include "../../lib/Marlin/Marlin/src/core/debug_out.h"
+
+    #if ENABLED(EXTENSIBLE_UI)
+        #include "../../lib/Marlin/Marlin/src/lcd/extui/ui_api.h"
+    #endif
+
+    #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+        #error "ABL_BILINEAR_SUBDIVISION is not supported by this override, use ABL_BICUBIC."
+    #endif
+    #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+        #error "Bilinear ABL override requires SEGMENT_LEVELED_MOVES."
+    #endif
+
+xy_pos_t bilinear_grid_spacing, bilinear_start;
+xy_float_t bilinear_grid_factor;
+bed_mesh_t z_values;
+
+/**
+ * Extrapolate a single point from its neighbors
+ */
+static void extrapolate_one_point(const uint8_t x, const uint8_t y, const int8_t xdir, const int8_t ydir) {
+    if (!isnan(z_values[x][y]))
+        return;
+    if (DEBUGGING(LEVELING)) {
+        DEBUG_ECHOPGM("Extrapolate [");
+        if (x < 10)
+            DEBUG_CHAR(' ');
+        DEBUG_ECHO(int(x));
+        DEBUG_CHAR(xdir ? (xdir > 0 ? '+' : '-') : ' ');
+        DEBUG_CHAR(' ');
+        if (y < 10)
+            DEBUG_CHAR(' ');
+        DEBUG_ECHO(int(y));
+        DEBUG_CHAR(ydir ? (ydir > 0 ? '+' : '-') : ' ');
+        DEBUG_ECHOLNPGM("]");
+    }
+
+    // Get X neighbors, Y neighbors, and XY neighbors
+    const uint8_t x1 = x + xdir, y1 = y + ydir, x2 = x1 + xdir, y2 = y1 + ydir;
+    float a1 = z_values[x1][y], a2 = z_values[x2][y],
+          b1 = z_values[x][y1], b2 = z_values[x][y2],
+          c1 = z_values[x1][y1], c2 = z_values[x2][y2];
+
+    // Treat far unprobed points as zero, near as equal to far
+    if (isnan(a2))
+        a2 = 0.0;
+    if (isnan(a1))
+        a1 = a2;
+    if (isnan(b2))
+        b2 = 0.0;
+    if (isnan(b1))
+        b1 = b2;
+    if (isnan(c2))
+        c2 = 0.0;
+    if (isnan(c1))
+        c1 = c2;
+
+    const float a = 2 * a1 - a2, b = 2 * b1 - b2, c = 2 * c1 - c2;
+
+    // Take the average instead of the median
+    z_values[x][y] = (a + b + c) / 3.0;
+    #if ENABLED(EXTENSIBLE_UI)
+    ExtUI::onMeshUpdate(x, y, z_values[x][y]);
+    #endif
+}
+
+/**
+ * Fill in the unprobed points (corners of circular print surface)
+ * using linear extrapolation, away from the center.
+ */
+void extrapolate_unprobed_bed_level() {
+    constexpr uint8_t ctrx1 = (GRID_MAX_POINTS_X - 1) / 2, // left-of-center
+        ctrx2 = (GRID_MAX_POINTS_X) / 2,                    // right-of-center
+        xlen = ctrx1;
+    constexpr uint8_t ctry1 = (GRID_MAX_POINTS_Y - 1) / 2, // top-of-center
+        ctry2 = (GRID_MAX_POINTS_Y) / 2,                    // bottom-of-center
+        ylen = ctry1;
+
+    for (uint8_t xo = 0; xo <= xlen; xo++)
+        for (uint8_t yo = 0; yo <= ylen; yo++) {
+            const uint8_t x1 = ctrx1 - xo, x2 = ctrx2 + xo;
+            const uint8_t y1 = ctry1 - yo, y2 = ctry2 + yo;
+            extrapolate_one_point(x1, y1, +1, +1); //  left-below + +
+            extrapolate_one_point(x2, y1, -1, +1); // right-below - +
+            extrapolate_one_point(x1, y2, +1, -1); //  left-above + -
+            extrapolate_one_point(x2, y2, -1, -1); // right-above - -
+        }
+}
+
+void print_bilinear_leveling_grid() {
+    SERIAL_ECHOLNPGM("Bilinear Leveling Grid:");
+    print_2d_array(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, 3,
+        [](const uint8_t ix, const uint8_t iy) { return z_values[ix][iy]; });
+}
+
+// Refresh after other values have been updated
+void refresh_bed_level() {
+    bilinear_grid_factor = bilinear_grid_spacing.reciprocal();
+    #if ENABLED(ABL_BICUBIC)
+    abl_bicubic_refresh();
+    #endif
+}
+
+    #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+        #define FAR_EDGE_OR_BOX 2 // Keep using the last grid box
+    #else
+        #define FAR_EDGE_OR_BOX 1 // Just use the grid far edge
+    #endif
+
+// Get the Z adjustment for non-linear bed leveling
+float bilinear_z_offset(const xy_pos_t &raw) {
+    #if ENABLED(ABL_BICUBIC)
+    if (abl_bicubic_valid())
+        return abl_bicubic_z_offset(raw);
+    #endif
+
+    static float z1, d2, z3, d4, L, D;
+
+    static xy_pos_t prev { -999.999, -999.999 }, ratio;
+
+    // Whole units for the grid line indices. Constrained within bounds.
+    static xy_int8_t thisg, nextg, lastg { -99, -99 };
+
+    // XY relative to the probed area
+    xy_pos_t rel = raw - bilinear_start.asFloat();
+
+    if (prev.x != rel.x) {
+        prev.x = rel.x;
+        ratio.x = rel.x * bilinear_grid_factor.x;
+        const float gx = constrain(FLOOR(ratio.x), 0, GRID_MAX_POINTS_X - (FAR_EDGE_OR_BOX));
+        ratio.x -= gx; // Subtract whole to get the ratio within the grid box
+
+    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+        // Beyond the grid maintain height at grid edges
+        NOLESS(ratio.x, 0); // Never < 0.0. (> 1.0 is ok when nextg.x==thisg.x.)
+    #endif
+
+        thisg.x = gx;
+        nextg.x = _MIN(thisg.x + 1, GRID_MAX_POINTS_X - 1);
+    }
+
+    if (prev.y != rel.y || lastg.x != thisg.x) {
+
+        if (prev.y != rel.y) {
+            prev.y = rel.y;
+            ratio.y = rel.y * bilinear_grid_factor.y;
+            const float gy = constrain(FLOOR(ratio.y), 0, GRID_MAX_POINTS_Y - (FAR_EDGE_OR_BOX));
+            ratio.y -= gy;
+
+    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+            // Beyond the grid maintain height at grid edges
+            NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+    #endif
+
+            thisg.y = gy;
+            nextg.y = _MIN(thisg.y + 1, GRID_MAX_POINTS_Y - 1);
+        }
+
+        if (lastg != thisg) {
+            lastg = thisg;
+            // Z at the box corners
+            z1 = z_values[thisg.x][thisg.y];      // left-front
+            d2 = z_values[thisg.x][nextg.y] - z1; // left-back (delta)
+            z3 = z_values[nextg.x][thisg.y];      // right-front
+            d4 = z_values[nextg.x][nextg.y] - z3; // right-back (delta)
+        }
+
+        // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
+        L = z1 + d2 * ratio.y;             // Linear interp. LF -> LB
+        const float R = z3 + d4 * ratio.y; // Linear interp. RF -> RB
+
+        D = R - L;
+    }
+
+    return L + ratio.x * D; // the offset almost always changes
+}
+
+#endif // AUTO_BED_LEVELING_BILINEAR
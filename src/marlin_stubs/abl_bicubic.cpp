@@ -0,0 +1,128 @@
+/**
+ * Bicubic interpolation of bilinear ABL grid
+ *
+ * Called from the bilinear ABL override (src/marlin_stubs/abl.cpp): refresh_bed_level()
+ * calls abl_bicubic_refresh() after every grid refresh (G29, settings load), which computes
+ * the bicubic patch coefficients for each grid cell, so the Z offset of every planner
+ * segment costs 15 multiply-adds (Horner scheme).
+ * Derivatives are estimated by central differences (Catmull-Rom), so the surface
+ * passes exactly through the probed points and is C1 continuous across cells.
+ */
+#include "../../lib/Marlin/Marlin/src/inc/MarlinConfig.h"
+
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+
+    #include "../../lib/Marlin/Marlin/src/feature/bedlevel/bedlevel.h"
+    #include "abl_bicubic.h"
+    #include "ccmram.h"
+
+    #if ENABLED(ABL_BICUBIC)
+
+        #define ABL_CELLS_X (GRID_MAX_POINTS_X - 1)
+        #define ABL_CELLS_Y (GRID_MAX_POINTS_Y - 1)
+
+// patch coefficients, p(t, u) = sum(a[i * 4 + j] * t^i * u^j), t and u in range 0..1 inside cell
+static float abl_coef[ABL_CELLS_X][ABL_CELLS_Y][16] CCMRAM_BSS;
+static xy_float_t abl_factor; // 1 / grid spacing
+static bool abl_coef_valid = false;
+
+// derivative in grid units by central (edge: one-sided) difference
+static float abl_dx(uint8_t x, uint8_t y) {
+    const uint8_t x0 = x ? x - 1 : 0, x1 = (x < GRID_MAX_POINTS_X - 1) ? x + 1 : x;
+    return (z_values[x1][y] - z_values[x0][y]) / (x1 - x0);
+}
+
+static float abl_dy(uint8_t x, uint8_t y) {
+    const uint8_t y0 = y ? y - 1 : 0, y1 = (y < GRID_MAX_POINTS_Y - 1) ? y + 1 : y;
+    return (z_values[x][y1] - z_values[x][y0]) / (y1 - y0);
+}
+
+static float abl_dxy(uint8_t x, uint8_t y) {
+    const uint8_t x0 = x ? x - 1 : 0, x1 = (x < GRID_MAX_POINTS_X - 1) ? x + 1 : x;
+    const uint8_t y0 = y ? y - 1 : 0, y1 = (y < GRID_MAX_POINTS_Y - 1) ? y + 1 : y;
+    return (z_values[x1][y1] - z_values[x1][y0] - z_values[x0][y1] + z_values[x0][y0]) / ((x1 - x0) * (y1 - y0));
+}
+
+// A = M * F * M^T, M is hermite basis matrix
+static void abl_calc_cell(uint8_t x, uint8_t y, float *a) {
+    static const float M[4][4] = { { 1, 0, 0, 0 }, { 0, 0, 1, 0 }, { -3, 3, -2, -1 }, { 2, -2, 1, 1 } };
+    const float F[4][4] = {
+        { z_values[x][y], z_values[x][y + 1], abl_dy(x, y), abl_dy(x, y + 1) },
+        { z_values[x + 1][y], z_values[x + 1][y + 1], abl_dy(x + 1, y), abl_dy(x + 1, y + 1) },
+        { abl_dx(x, y), abl_dx(x, y + 1), abl_dxy(x, y), abl_dxy(x, y + 1) },
+        { abl_dx(x + 1, y), abl_dx(x + 1, y + 1), abl_dxy(x + 1, y), abl_dxy(x + 1, y + 1) }
+    };
+    float MF[4][4];
+    for (uint8_t i = 0; i < 4; i++)
+        for (uint8_t j = 0; j < 4; j++) {
+            MF[i][j] = 0;
+            for (uint8_t k = 0; k < 4; k++)
+                MF[i][j] += M[i][k] * F[k][j];
+        }
+    for (uint8_t i = 0; i < 4; i++)
+        for (uint8_t j = 0; j < 4; j++) {
+            float s = 0;
+            for (uint8_t k = 0; k < 4; k++)
+                s += MF[i][k] * M[j][k];
+            a[i * 4 + j] = s;
+        }
+}
+
+static void abl_calc_coef(void) {
+    abl_coef_valid = false;
+    for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+        for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+            if (isnan(z_values[x][y]))
+                return; // incomplete grid - use bilinear
+    abl_factor.set(1.0f / bilinear_grid_spacing.x, 1.0f / bilinear_grid_spacing.y);
+    for (uint8_t x = 0; x < ABL_CELLS_X; x++)
+        for (uint8_t y = 0; y < ABL_CELLS_Y; y++)
+            abl_calc_cell(x, y, abl_coef[x][y]);
+    abl_coef_valid = true;
+}
+
+// evaluate patch value and (optionally) partial derivatives
+static float abl_eval(const float *a, const float t, const float u, float *dt, float *du) {
+    float c[4];
+    for (uint8_t i = 0; i < 4; i++)
+        c[i] = ((a[i * 4 + 3] * u + a[i * 4 + 2]) * u + a[i * 4 + 1]) * u + a[i * 4 + 0];
+    if (dt) {
+        *dt = (3 * c[3] * t + 2 * c[2]) * t + c[1];
+        float d[4];
+        for (uint8_t i = 0; i < 4; i++)
+            d[i] = (3 * a[i * 4 + 3] * u + 2 * a[i * 4 + 2]) * u + a[i * 4 + 1];
+        *du = ((d[3] * t + d[2]) * t + d[1]) * t + d[0];
+    }
+    return ((c[3] * t + c[2]) * t + c[1]) * t + c[0];
+}
+
+bool abl_bicubic_valid() {
+    return abl_coef_valid;
+}
+
+float abl_bicubic_z_offset(const xy_pos_t &raw) {
+    const float gx = (raw.x - bilinear_start.x) * abl_factor.x;
+    const float gy = (raw.y - bilinear_start.y) * abl_factor.y;
+    const float cx = constrain(gx, 0, ABL_CELLS_X);
+    const float cy = constrain(gy, 0, ABL_CELLS_Y);
+    const uint8_t x = _MIN(uint8_t(cx), ABL_CELLS_X - 1);
+    const uint8_t y = _MIN(uint8_t(cy), ABL_CELLS_Y - 1);
+    if ((gx == cx) && (gy == cy))
+        return abl_eval(abl_coef[x][y], cx - x, cy - y, 0, 0);
+        #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+    // beyond the grid continue the tilt of the nearest edge
+    float dt, du;
+    const float z = abl_eval(abl_coef[x][y], cx - x, cy - y, &dt, &du);
+    return z + (gx - cx) * dt + (gy - cy) * du;
+        #else
+    return abl_eval(abl_coef[x][y], cx - x, cy - y, 0, 0);
+        #endif
+}
+
+void abl_bicubic_refresh() {
+    abl_calc_coef();
+}
+
+    #endif // ABL_BICUBIC
+
+#endif // AUTO_BED_LEVELING_BILINEAR
@@ -0,0 +1,17 @@
+// abl_bicubic.h - bicubic interpolation of bilinear ABL grid (see abl_bicubic.cpp)
+#pragma once
+
+#include "../../lib/Marlin/Marlin/src/inc/MarlinConfig.h"
+
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR) && ENABLED(ABL_BICUBIC)
+
+// recompute patch coefficients from z_values (call after every grid change)
+extern void abl_bicubic_refresh();
+
+// coefficients are valid (grid complete), otherwise bilinear interpolation is used
+extern bool abl_bicubic_valid();
+
+// Z offset at raw XY position, only valid when abl_bicubic_valid()
+extern float abl_bicubic_z_offset(const xy_pos_t &raw);
+
+#endif // AUTO_BED_LEVELING_BILINEAR && ABL_BICUBIC
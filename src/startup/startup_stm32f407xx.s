@@ -105,6 +105,17 @@ LoopFillZerobss:
   ldr  r3, = _ebss
   cmp  r2, r3
   bcc  FillZerobss
+  ldr  r2, =_sccmbss
+  b  LoopFillZeroCcmbss	/* Zero fill ccmram bss segment */
+
+FillZeroCcmbss:
+  movs  r3, #0
+  str  r3, [r2], #4
+
+LoopFillZeroCcmbss:
+  ldr  r3, = _eccmbss
+  cmp  r2, r3
+  bcc  FillZeroCcmbss
 
 /* Call the clock system intitialization function.*/
   bl  SystemInit
@@ -115,6 +115,17 @@ LoopFillZeroBootData:
   ldr  r3, = _eboot_fw_data_exchange
   cmp  r2, r3
   bcc  FillZeroBootData
+  ldr  r2, =_sccmbss
+  b  LoopFillZeroCcmbss	/* Zero fill ccmram bss segment */
+
+FillZeroCcmbss:
+  movs  r3, #0
+  str  r3, [r2], #4
+
+LoopFillZeroCcmbss:
+  ldr  r3, = _eccmbss
+  cmp  r2, r3
+  bcc  FillZeroCcmbss
 
 /* Call the clock system intitialization function.*/
   bl  SystemInit
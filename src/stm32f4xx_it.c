@@ -41,6 +41,11 @@
 /* USER CODE BEGIN Includes */
 #include "bsod.h"
 #include "dump.h"
+#include "sysprof.h"
+#if HAS_GUI
+    #include "jogwheel.h"
+    #include "gpio.h"
+#endif //HAS_GUI
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -206,7 +211,14 @@ void DMA1_Stream5_IRQHandler(void) {
   */
 void EXTI15_10_IRQHandler(void) {
     /* USER CODE BEGIN EXTI15_10_IRQn 0 */
-
+#if HAS_GUI
+    // jogwheel encoder phases, both edges (one decoding step for simultaneous edges)
+    const uint32_t jogwheel_pins = (1 << (JOGWHEEL_PIN_EN1 & 0x0f)) | (1 << (JOGWHEEL_PIN_EN2 & 0x0f));
+    if (__HAL_GPIO_EXTI_GET_IT(jogwheel_pins)) {
+        __HAL_GPIO_EXTI_CLEAR_IT(jogwheel_pins);
+        jogwheel_update_exti();
+    }
+#endif //HAS_GUI
     /* USER CODE END EXTI15_10_IRQn 0 */
     HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_10);
     HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_14);
@@ -220,11 +232,11 @@ void EXTI15_10_IRQHandler(void) {
   */
 void TIM8_TRG_COM_TIM14_IRQHandler(void) {
     /* USER CODE BEGIN TIM8_TRG_COM_TIM14_IRQn 0 */
-
+    uint32_t begin = sysprof_isr_begin();
     /* USER CODE END TIM8_TRG_COM_TIM14_IRQn 0 */
     HAL_TIM_IRQHandler(&htim14);
     /* USER CODE BEGIN TIM8_TRG_COM_TIM14_IRQn 1 */
-
+    sysprof_isr_end(begin);
     /* USER CODE END TIM8_TRG_COM_TIM14_IRQn 1 */
 }
 
@@ -52,6 +52,11 @@
 /* Includes ------------------------------------------------------------------*/
 #include "ff_gen_drv.h"
 #include "usbh_diskio.h"
+#include "config.h"
+#ifdef USBH_CACHE
+    #include "sector_cache.h"
+    #include "ccmram.h"
+#endif //USBH_CACHE
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -88,6 +93,30 @@ const Diskio_drvTypeDef USBH_Driver = {
 
 /* USER CODE BEGIN beforeFunctionSection */
 /* can be used to modify / undefine following code or add new code */
+static DRESULT usbh_disk_read(BYTE lun, BYTE *buff, DWORD sector, UINT count);
+#if _USE_WRITE == 1
+static DRESULT usbh_disk_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count);
+#endif /* _USE_WRITE == 1 */
+
+#ifdef USBH_CACHE
+// FatFS calls are serialized by volume mutex (_FS_REENTRANT), so the cache is not locked
+static sector_cache_t usbh_cache;
+static sector_cache_line_t usbh_cache_line[USBH_CACHE_LINES];
+static uint8_t usbh_cache_data[USBH_CACHE_LINES * USBH_CACHE_LINE_SECTORS * SECTOR_CACHE_SECTOR_SIZE] CCMRAM_BSS; // usb otg fs does not use dma
+static BYTE usbh_cache_lun;
+
+static int usbh_cache_read(uint8_t *buff, uint32_t sector, uint32_t count) {
+    return usbh_disk_read(usbh_cache_lun, buff, sector, count);
+}
+
+static int usbh_cache_write(uint8_t *buff, uint32_t sector, uint32_t count) {
+    #if _USE_WRITE == 1
+    return usbh_disk_write(usbh_cache_lun, buff, sector, count);
+    #else
+    return RES_WRPRT;
+    #endif /* _USE_WRITE == 1 */
+}
+#endif //USBH_CACHE
 /* USER CODE END beforeFunctionSection */
 
 /* Private functions ---------------------------------------------------------*/
@@ -99,6 +128,17 @@ const Diskio_drvTypeDef USBH_Driver = {
   */
 DSTATUS USBH_initialize(BYTE lun) {
     /* CAUTION : USB Host library has to be initialized in the application */
+#ifdef USBH_CACHE
+    MSC_LUNTypeDef info;
+    uint32_t sector_count = 0;
+
+    // (re)mounted media, drop cached sectors of previous one
+    if ((USBH_MSC_GetLUNInfo(&hUSB_Host, lun, &info) == USBH_OK) && (info.capacity.block_size == SECTOR_CACHE_SECTOR_SIZE))
+        sector_count = info.capacity.block_nbr;
+    usbh_cache_lun = lun;
+    sector_cache_init(&usbh_cache, usbh_cache_line, usbh_cache_data, USBH_CACHE_LINES, USBH_CACHE_LINE_SECTORS, usbh_cache_read, usbh_cache_write);
+    sector_cache_reset(&usbh_cache, sector_count);
+#endif //USBH_CACHE
 
     return RES_OK;
 }
@@ -133,6 +173,16 @@ DSTATUS USBH_status(BYTE lun) {
   * @retval DRESULT: Operation result
   */
 DRESULT USBH_read(BYTE lun, BYTE *buff, DWORD sector, UINT count) {
+#ifdef USBH_CACHE
+    usbh_cache_lun = lun;
+    return (DRESULT)sector_cache_read(&usbh_cache, buff, sector, count);
+#else
+    return usbh_disk_read(lun, buff, sector, count);
+#endif //USBH_CACHE
+}
+
+// read sectors from usb
+static DRESULT usbh_disk_read(BYTE lun, BYTE *buff, DWORD sector, UINT count) {
     DRESULT res = RES_ERROR;
     MSC_LUNTypeDef info;
 
@@ -172,6 +222,16 @@ DRESULT USBH_read(BYTE lun, BYTE *buff, DWORD sector, UINT count) {
   */
 #if _USE_WRITE == 1
 DRESULT USBH_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count) {
+    #ifdef USBH_CACHE
+    usbh_cache_lun = lun;
+    return (DRESULT)sector_cache_write(&usbh_cache, buff, sector, count);
+    #else
+    return usbh_disk_write(lun, buff, sector, count);
+    #endif //USBH_CACHE
+}
+
+// write sectors to usb
+static DRESULT usbh_disk_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count) {
     DRESULT res = RES_ERROR;
     MSC_LUNTypeDef info;
 
@@ -222,7 +282,12 @@ DRESULT USBH_ioctl(BYTE lun, BYTE cmd, void *buff) {
     switch (cmd) {
     /* Make sure that no pending write process */
     case CTRL_SYNC:
+    #ifdef USBH_CACHE
+        usbh_cache_lun = lun;
+        res = (DRESULT)sector_cache_flush(&usbh_cache);
+    #else
         res = RES_OK;
+    #endif //USBH_CACHE
         break;
 
     /* Get number of sectors on the disk (DWORD) */
@@ -33,6 +33,7 @@
 #include "lwip/apps/httpd_opts.h"
 #include "lwip/def.h"
 #include "lwip/apps/fs.h"
+#include "fs_asset.h"
 #include <string.h>
 
 #include HTTPD_FSDATA_FILE
@@ -88,6 +89,45 @@ err_t fs_open(struct fs_file *file, const char *name) {
     return ERR_VAL;
 }
 
+/*-----------------------------------------------------------------------------------*/
+const struct fsdata_asset *fs_asset_find(const char *name) {
+#ifdef FS_NUMASSETS
+    int i;
+    for (i = 0; i < FS_NUMASSETS; i++) {
+        if (!strcmp(name, fs_assets[i].name)) {
+            return &fs_assets[i];
+        }
+    }
+#else  /* FS_NUMASSETS */
+    LWIP_UNUSED_ARG(name);
+#endif /* FS_NUMASSETS */
+    return NULL;
+}
+
+/*-----------------------------------------------------------------------------------*/
+void fs_asset_open(struct fs_file *file, const struct fsdata_asset *asset, u8_t gzip, u8_t not_modified) {
+    const struct fsdata_file *f = (gzip && asset->gzip) ? asset->gzip : asset->plain;
+    memset(file, 0, sizeof(struct fs_file));
+    file->flags = f->flags;
+    if (not_modified) {
+        /* headers only */
+        file->data = (gzip && asset->gzip) ? asset->not_modified_gzip : asset->not_modified;
+        file->len = strlen(file->data);
+    } else {
+        file->data = (const char *)f->data;
+        file->len = f->len;
+#if HTTPD_PRECALCULATED_CHECKSUM
+        file->chksum_count = f->chksum_count;
+        file->chksum = f->chksum;
+#endif /* HTTPD_PRECALCULATED_CHECKSUM */
+    }
+    file->index = file->len;
+    file->pextension = NULL;
+#if LWIP_HTTPD_FILE_STATE
+    file->state = fs_state_init(file, asset->name);
+#endif /* #if LWIP_HTTPD_FILE_STATE */
+}
+
 /*-----------------------------------------------------------------------------------*/
 void fs_close(struct fs_file *file) {
 #if LWIP_HTTPD_CUSTOM_FILES
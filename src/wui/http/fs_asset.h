@@ -0,0 +1,27 @@
+/*
+ * fs_asset.h
+ * \brief   precompressed web resources with entity tags (generated by utils/wui_fsdata.py)
+ */
+#ifndef LWIP_FS_ASSET_H
+#define LWIP_FS_ASSET_H
+
+#include "lwip/apps/fs.h"
+
+#define FS_ASSET_ETAG_LEN 16 // hex digits of content hash
+
+struct fsdata_asset {
+    const char *name;                /* URI */
+    const char *etag;                /* content hash (without quotes) */
+    const struct fsdata_file *plain; /* identity encoded file */
+    const struct fsdata_file *gzip;  /* gzip encoded file, NULL when compression does not pay off */
+    const char *not_modified;        /* complete 304 response for plain */
+    const char *not_modified_gzip;   /* complete 304 response for gzip */
+};
+
+/** find resource with entity tag, returns NULL when there is none */
+const struct fsdata_asset *fs_asset_find(const char *name);
+
+/** open resource variant (gzip encoded or 304 response without payload) */
+void fs_asset_open(struct fs_file *file, const struct fsdata_asset *asset, u8_t gzip, u8_t not_modified);
+
+#endif /* LWIP_FS_ASSET_H */
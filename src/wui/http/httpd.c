@@ -114,6 +114,7 @@
 
 /*******   Customization ***************************************/
 #include "wui_api.h"
+#include "fs_asset.h"
 #define WUI_API_ROOT_STR_LEN 5
 /***************************************************************/
 
@@ -123,6 +124,9 @@
     #define MIN_REQ_LEN 7
 
     #define CRLF "\r\n"
+
+    #define HTTP_HDR_ACCEPT_ENCODING "Accept-Encoding:"
+    #define HTTP_HDR_IF_NONE_MATCH   "If-None-Match:"
     #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
         #define HTTP11_CONNECTIONKEEPALIVE  "Connection: keep-alive"
         #define HTTP11_CONNECTIONKEEPALIVE2 "Connection: Keep-Alive"
@@ -137,8 +141,9 @@
 /* This defines checks whether tcp_write has to copy data or not */
 
     #ifndef HTTP_IS_DATA_VOLATILE
-        /** tcp_write does not have to copy data when sent from rom-file-system directly */
-        #define HTTP_IS_DATA_VOLATILE(hs) (HTTP_IS_DYNAMIC_FILE(hs) ? TCP_WRITE_FLAG_COPY : 0)
+        /** tcp_write does not have to copy data when sent from rom-file-system directly,
+         * api responses are in buffer of the connection (api_buf), copied because it is reused by next request */
+        #define HTTP_IS_DATA_VOLATILE(hs) ((HTTP_IS_DYNAMIC_FILE(hs) || (((hs)->handle != NULL) && ((hs)->handle->flags & WUI_API_FS_FLAGS_VOLATILE))) ? TCP_WRITE_FLAG_COPY : 0)
     #endif
     /** Default: dynamic headers are sent from ROM (non-dynamic headers are handled like file data) */
     #ifndef HTTP_IS_HDR_VOLATILE
@@ -262,12 +267,19 @@ struct http_state {
     #endif       /* LWIP_HTTPD_DYNAMIC_FILE_READ */
     u32_t left;  /* Number of unsent bytes in buf. */
     u8_t retries;
+    u8_t accept_gzip;          /* request has "Accept-Encoding: gzip" */
+    const char *if_none_match; /* If-None-Match value in request buffer (valid while parsing only) */
+    u16_t if_none_match_len;
     #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
     u8_t keepalive;
-    #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+    struct pbuf *pipelined; /* requests received while sending the response */
+    const char *hdr_conn;    /* unsent part of "Connection:" line for file with included header */
+    const char *hdr_conn_at; /* position of the line in file (empty line ending the header) */
+    #endif                   /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
     #if LWIP_HTTPD_SSI
     struct http_ssi_state *ssi;
     #endif /* LWIP_HTTPD_SSI */
+    char api_buf[WUI_API_BUFFER_SIZE]; /* /api/ response body (wui_api.c), unsent tail is sent from here */
     #if LWIP_HTTPD_CGI
     char *params[LWIP_HTTPD_MAX_CGI_PARAMETERS];     /* Params extracted from the request URI */
     char *param_vals[LWIP_HTTPD_MAX_CGI_PARAMETERS]; /* Values for each extracted param */
@@ -316,6 +328,10 @@ static err_t http_find_file(struct http_state *hs, const char *uri, int is_09);
 static err_t http_init_file(struct http_state *hs, struct fs_file *file, int is_09, const char *uri, u8_t tag_check, char *params);
 static err_t http_poll(void *arg, struct altcp_pcb *pcb);
 static u8_t http_check_eof(struct altcp_pcb *pcb, struct http_state *hs);
+static void http_handle_request(struct altcp_pcb *pcb, struct http_state *hs, struct pbuf *p);
+    #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+static void http_pipeline(struct altcp_pcb *pcb, struct http_state *hs);
+    #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
     #if LWIP_HTTPD_FS_ASYNC_READ
 static void http_continue(void *connection);
     #endif /* LWIP_HTTPD_FS_ASYNC_READ */
@@ -501,6 +517,12 @@ http_state_eof(struct http_state *hs) {
         hs->req = NULL;
     }
     #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if (hs->pipelined) {
+        pbuf_free(hs->pipelined);
+        hs->pipelined = NULL;
+    }
+    #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
 }
 
 /** Free a struct http_state.
@@ -646,6 +668,8 @@ http_eof(struct altcp_pcb *pcb, struct http_state *hs) {
     /* HTTP/1.1 persistent connection? (Not supported for SSI) */
     #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
     if (hs->keepalive) {
+        struct pbuf *pipelined = hs->pipelined;
+        hs->pipelined = NULL;
         http_remove_connection(hs);
 
         http_state_eof(hs);
@@ -653,9 +677,13 @@ http_eof(struct altcp_pcb *pcb, struct http_state *hs) {
         /* restore state: */
         hs->pcb = pcb;
         hs->keepalive = 1;
+        hs->pipelined = pipelined;
+        /* most recently used connection is killed last */
         http_add_connection(hs);
         /* ensure nagle doesn't interfere with sending all data as fast as possible: */
         altcp_nagle_disable(pcb);
+        /* answer the next pipelined request right away (hs must not be used after this call) */
+        http_pipeline(pcb, hs);
     } else
     #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
     {
@@ -867,6 +895,10 @@ get_http_headers(struct http_state *hs, const char *uri) {
         hs->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = g_psHTTPHeaderStrings[HTTP_HDR_BAD_REQUEST];
     } else if (strstr(uri, "501")) {
         hs->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = g_psHTTPHeaderStrings[HTTP_HDR_NOT_IMPL];
+    } else if (strstr(uri, "409")) {
+        hs->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = g_psHTTPHeaderStrings[HTTP_HDR_CONFLICT];
+    } else if (strstr(uri, "500")) {
+        hs->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = g_psHTTPHeaderStrings[HTTP_HDR_INTERNAL_ERROR];
     } else {
         hs->hdrs[HDR_STRINGS_IDX_HTTP_STATUS] = g_psHTTPHeaderStrings[HTTP_HDR_OK];
     }
@@ -960,7 +992,8 @@ get_http_content_length(struct http_state *hs) {
     }
         #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
     if (add_content_len) {
-        hs->hdrs[HDR_STRINGS_IDX_CONTENT_LEN_KEEPALIVE] = g_psHTTPHeaderStrings[HTTP_HDR_KEEPALIVE_LEN];
+        /* connection is closed after the response when keep-alive was not requested */
+        hs->hdrs[HDR_STRINGS_IDX_CONTENT_LEN_KEEPALIVE] = g_psHTTPHeaderStrings[hs->keepalive ? HTTP_HDR_KEEPALIVE_LEN : HTTP_HDR_CONTENT_LENGTH];
     } else {
         hs->hdrs[HDR_STRINGS_IDX_CONTENT_LEN_KEEPALIVE] = g_psHTTPHeaderStrings[HTTP_HDR_CONN_CLOSE];
         hs->keepalive = 0;
@@ -1177,6 +1210,36 @@ http_send_data_nonssi(struct altcp_pcb *pcb, struct http_state *hs) {
     u16_t len;
     u8_t data_to_send = 0;
 
+    #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if (hs->hdr_conn != NULL) {
+        /* included header up to its empty line, then the "Connection:" line of this request */
+        if (hs->file != hs->hdr_conn_at) {
+            len = (u16_t)(hs->hdr_conn_at - hs->file);
+            err = http_write(pcb, hs->file, &len, HTTP_IS_DATA_VOLATILE(hs) | TCP_WRITE_FLAG_MORE);
+            if (err != ERR_OK) {
+                return data_to_send;
+            }
+            data_to_send = 1;
+            hs->file += len;
+            hs->left -= len;
+            if (hs->file != hs->hdr_conn_at) {
+                return data_to_send;
+            }
+        }
+        len = (u16_t)strlen(hs->hdr_conn);
+        err = http_write(pcb, hs->hdr_conn, &len, TCP_WRITE_FLAG_MORE);
+        if (err != ERR_OK) {
+            return data_to_send;
+        }
+        data_to_send = 1;
+        hs->hdr_conn += len;
+        if (*hs->hdr_conn != '\0') {
+            return data_to_send;
+        }
+        hs->hdr_conn = NULL;
+    }
+    #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
     /* We are not processing an SHTML file so no tag checking is necessary.
    * Just send the data as we received it from the file. */
     len = (u16_t)LWIP_MIN(hs->left, 0xffff);
@@ -1536,16 +1599,16 @@ http_send(struct altcp_pcb *pcb, struct http_state *hs) {
 
     LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_send: pcb=%p hs=%p left=%d\n", (void *)pcb, (void *)hs, hs != NULL ? (int)hs->left : 0));
 
-    #if LWIP_HTTPD_SUPPORT_POST && LWIP_HTTPD_POST_MANUAL_WND
-    if (hs->unrecved_bytes != 0) {
+    /* If we were passed a NULL state structure pointer, ignore the call. */
+    if (hs == NULL) {
         return 0;
     }
-    #endif /* LWIP_HTTPD_SUPPORT_POST && LWIP_HTTPD_POST_MANUAL_WND */
 
-    /* If we were passed a NULL state structure pointer, ignore the call. */
-    if (hs == NULL) {
+    #if LWIP_HTTPD_SUPPORT_POST && LWIP_HTTPD_POST_MANUAL_WND
+    if (hs->unrecved_bytes != 0) {
         return 0;
     }
+    #endif /* LWIP_HTTPD_SUPPORT_POST && LWIP_HTTPD_POST_MANUAL_WND */
 
     #if LWIP_HTTPD_FS_ASYNC_READ
     /* Check if we are allowed to read from this file.
@@ -1910,6 +1973,46 @@ http_continue(void *connection) {
  *         ERR_INPROGRESS if request was OK so far but not fully received
  *         another err_t otherwise
  */
+/** Find request header value (leading spaces skipped, up to CRLF).
+ * @return pointer to the value in data or NULL when header is not present
+ */
+static const char *
+http_get_header(const char *data, u16_t data_len, const char *name, u16_t *value_len) {
+    const char *value = lwip_strnstr(data, name, data_len);
+    const char *crlf;
+    if (value == NULL) {
+        return NULL;
+    }
+    value += strlen(name);
+    while ((value < (data + data_len)) && (*value == ' ')) {
+        value++;
+    }
+    crlf = lwip_strnstr(value, CRLF, (size_t)((data + data_len) - value));
+    if (crlf == NULL) {
+        return NULL;
+    }
+    *value_len = (u16_t)(crlf - value);
+    return value;
+}
+
+/** Open file, resources with entity tag are negotiated: gzip variant when
+ * the client accepts it and 304 (headers only) when its cached tag matches.
+ */
+static err_t
+http_fs_open(struct http_state *hs, const char *name, int is_09) {
+    const struct fsdata_asset *asset = fs_asset_find(name);
+    u8_t not_modified = 0;
+    if ((asset == NULL) || is_09) {
+        return fs_open(&hs->file_handle, name);
+    }
+    if (hs->if_none_match != NULL) {
+        /* any listed tag ("hash" or "hash-gz") or "*" */
+        not_modified = (lwip_strnstr(hs->if_none_match, asset->etag, hs->if_none_match_len) != NULL) || (lwip_strnstr(hs->if_none_match, "*", hs->if_none_match_len) != NULL);
+    }
+    fs_asset_open(&hs->file_handle, asset, hs->accept_gzip, not_modified);
+    return ERR_OK;
+}
+
 static err_t
 http_parse_request(struct pbuf *inp, struct http_state *hs, struct altcp_pcb *pcb) {
     char *data;
@@ -2028,6 +2131,12 @@ http_parse_request(struct pbuf *inp, struct http_state *hs, struct altcp_pcb *pc
                         hs->keepalive = 0;
                     }
     #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+                    if (!is_09) {
+                        u16_t accept_len;
+                        const char *accept = http_get_header(data, data_len, HTTP_HDR_ACCEPT_ENCODING, &accept_len);
+                        hs->accept_gzip = (accept != NULL) && (lwip_strnstr(accept, "gzip", accept_len) != NULL);
+                        hs->if_none_match = http_get_header(data, data_len, HTTP_HDR_IF_NONE_MATCH, &hs->if_none_match_len);
+                    }
                     /* null-terminate the METHOD (pbuf is freed anyway wen returning) */
                     *sp1 = 0;
                     uri[uri_len] = 0;
@@ -2369,6 +2478,21 @@ http_init_file(struct http_state *hs, struct fs_file *file, int is_09, const cha
             }
         }
     }
+    /* included header has no "Connection:" line, it depends on the request (added by http_send_data_nonssi) */
+    if ((hs->handle != NULL) && (hs->handle->flags & FS_FILE_FLAGS_HEADER_INCLUDED) && (hs->file != NULL)
+        #if LWIP_HTTPD_SUPPORT_V09
+        && !is_09
+        #endif /* LWIP_HTTPD_SUPPORT_V09 */
+        #if LWIP_HTTPD_SSI
+        && (hs->ssi == NULL)
+        #endif /* LWIP_HTTPD_SSI */
+    ) {
+        const char *hdr_end = lwip_strnstr(hs->file, CRLF CRLF, hs->left);
+        if (hdr_end != NULL) {
+            hs->hdr_conn = g_psHTTPHeaderStrings[hs->keepalive ? HTTP_HDR_CONN_KEEPALIVE : HTTP_HDR_CONN_CLOSE];
+            hs->hdr_conn_at = hdr_end + 2;
+        }
+    }
     #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
     return ERR_OK;
 }
@@ -2389,6 +2513,118 @@ http_err(void *arg, err_t err) {
     }
 }
 
+    #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+/** Append data received while a response is being sent to the pipelined
+ * requests of a persistent connection.
+ * The pbuf is freed on error (too much data pipelined).
+ */
+static err_t
+http_pipeline_enqueue(struct http_state *hs, struct pbuf *p) {
+    if (((u32_t)p->tot_len + (hs->pipelined ? hs->pipelined->tot_len : 0)) > LWIP_HTTPD_PIPELINE_MAX_LEN) {
+        LWIP_DEBUGF(HTTPD_DEBUG, ("http_pipeline_enqueue: too many pipelined requests\n"));
+        pbuf_free(p);
+        return ERR_MEM;
+    }
+    if (hs->pipelined == NULL) {
+        hs->pipelined = p;
+    } else {
+        pbuf_cat(hs->pipelined, p);
+    }
+    return ERR_OK;
+}
+
+/** Move data following the complete header of a GET request (next pipelined
+ * request received in the same segment) to the pipelined requests, so that
+ * it is not discarded together with the parsed request.
+ */
+static err_t
+http_split_request(struct http_state *hs, struct pbuf *p) {
+    struct pbuf *next;
+    u16_t end;
+        #if LWIP_HTTPD_SUPPORT_REQUESTLIST
+    if (hs->req != NULL) {
+        /* continuation of a request, it ends in this pbuf normally */
+        return ERR_OK;
+    }
+        #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    if ((p->tot_len <= 4) || pbuf_memcmp(p, 0, "GET ", 4)) {
+        /* POST body is passed to the application */
+        return ERR_OK;
+    }
+    end = pbuf_memfind(p, CRLF CRLF, 4, 0);
+    if ((end == 0xFFFF) || ((end + 4) >= p->tot_len)) {
+        return ERR_OK;
+    }
+    end += 4;
+    next = pbuf_alloc(PBUF_RAW, (u16_t)(p->tot_len - end), PBUF_RAM);
+    if (next == NULL) {
+        return ERR_MEM;
+    }
+    pbuf_copy_partial(p, next->payload, next->len, end);
+    pbuf_realloc(p, end);
+    return http_pipeline_enqueue(hs, next);
+}
+
+/** Parse the next pipelined request after the response to the previous one
+ * was sent. Responses sent completely from within this call (and ending in
+ * http_eof again) are not nested, their successors are parsed by http_sent.
+ */
+static void
+http_pipeline(struct altcp_pcb *pcb, struct http_state *hs) {
+    static u8_t http_pipeline_busy;
+    struct pbuf *p = hs->pipelined;
+
+    if (http_pipeline_busy || (p == NULL) || (hs->handle != NULL)) {
+        return;
+    }
+    hs->pipelined = NULL;
+    http_pipeline_busy = 1;
+    http_handle_request(pcb, hs, p);
+    http_pipeline_busy = 0;
+}
+    #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+
+/** Parse a request (or its part) and start sending the response.
+ * The pbuf is always freed, hs can be freed too (connection closed).
+ */
+static void
+http_handle_request(struct altcp_pcb *pcb, struct http_state *hs, struct pbuf *p) {
+    err_t parsed;
+
+    #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if (http_split_request(hs, p) != ERR_OK) {
+        /* pipelined requests would be lost, the client has to repeat them */
+        pbuf_free(p);
+        http_close_conn(pcb, hs);
+        return;
+    }
+    #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+    parsed = http_parse_request(p, hs, pcb);
+    LWIP_ASSERT("http_parse_request: unexpected return value", parsed == ERR_OK || parsed == ERR_INPROGRESS || parsed == ERR_ARG || parsed == ERR_USE);
+    #if LWIP_HTTPD_SUPPORT_REQUESTLIST
+    if (parsed != ERR_INPROGRESS) {
+        /* request fully parsed or error */
+        if (hs->req != NULL) {
+            pbuf_free(hs->req);
+            hs->req = NULL;
+        }
+    }
+    #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
+    pbuf_free(p);
+    if (parsed == ERR_OK) {
+    #if LWIP_HTTPD_SUPPORT_POST
+        if (hs->post_content_len_left == 0)
+    #endif /* LWIP_HTTPD_SUPPORT_POST */
+        {
+            LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_handle_request: data %p len %" S32_F "\n", (const void *)hs->file, hs->left));
+            http_send(pcb, hs);
+        }
+    } else if (parsed == ERR_ARG) {
+        /* @todo: close on ERR_USE? */
+        http_close_conn(pcb, hs);
+    }
+}
+
 /**
  * Data has been sent and acknowledged by the remote host.
  * This means that more data can be sent.
@@ -2407,6 +2643,13 @@ http_sent(void *arg, struct altcp_pcb *pcb, u16_t len) {
 
     hs->retries = 0;
 
+    #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+    if ((hs->handle == NULL) && (hs->pipelined != NULL)) {
+        /* pipelined request left by http_eof */
+        http_pipeline(pcb, hs);
+        return ERR_OK;
+    }
+    #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
     http_send(pcb, hs);
 
     return ERR_OK;
@@ -2456,6 +2699,11 @@ http_poll(void *arg, struct altcp_pcb *pcb) {
                 altcp_output(pcb);
             }
         }
+    #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+        else {
+            http_pipeline(pcb, hs);
+        }
+    #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
     }
 
     return ERR_OK;
@@ -2510,32 +2758,25 @@ http_recv(void *arg, struct altcp_pcb *pcb, struct pbuf *p, err_t err) {
     } else
     #endif /* LWIP_HTTPD_SUPPORT_POST */
     {
+    #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+        if ((hs->handle == NULL) && (hs->pipelined == NULL)) {
+    #else  /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
         if (hs->handle == NULL) {
-            err_t parsed = http_parse_request(p, hs, pcb);
-            LWIP_ASSERT("http_parse_request: unexpected return value", parsed == ERR_OK || parsed == ERR_INPROGRESS || parsed == ERR_ARG || parsed == ERR_USE);
-    #if LWIP_HTTPD_SUPPORT_REQUESTLIST
-            if (parsed != ERR_INPROGRESS) {
-                /* request fully parsed or error */
-                if (hs->req != NULL) {
-                    pbuf_free(hs->req);
-                    hs->req = NULL;
-                }
-            }
-    #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
-            pbuf_free(p);
-            if (parsed == ERR_OK) {
-    #if LWIP_HTTPD_SUPPORT_POST
-                if (hs->post_content_len_left == 0)
-    #endif /* LWIP_HTTPD_SUPPORT_POST */
-                {
-                    LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("http_recv: data %p len %" S32_F "\n", (const void *)hs->file, hs->left));
-                    http_send(pcb, hs);
+    #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
+            http_handle_request(pcb, hs, p);
+        } else {
+    #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
+            if (hs->keepalive) {
+                LWIP_DEBUGF(HTTPD_DEBUG, ("http_recv: pipelined request\n"));
+                /* keep order, parsed when the current response is sent (http_eof) */
+                if (http_pipeline_enqueue(hs, p) != ERR_OK) {
+                    http_close_conn(pcb, hs);
+                } else {
+                    http_pipeline(pcb, hs);
                 }
-            } else if (parsed == ERR_ARG) {
-                /* @todo: close on ERR_USE? */
-                http_close_conn(pcb, hs);
+                return ERR_OK;
             }
-        } else {
+    #endif /* LWIP_HTTPD_SUPPORT_11_KEEPALIVE */
             LWIP_DEBUGF(HTTPD_DEBUG, ("http_recv: already sending data\n"));
             /* already sending but still receiving data, we might want to RST here? */
             pbuf_free(p);
@@ -2715,7 +2956,7 @@ static err_t http_find_file(struct http_state *hs, const char *uri, int is_09) {
             file_name = httpd_default_filenames[loop].name;
 
             LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Looking for %s...\n", file_name));
-            err = fs_open(&hs->file_handle, file_name);
+            err = http_fs_open(hs, file_name, is_09);
             if (err == ERR_OK) {
                 uri = file_name;
                 file = &hs->file_handle;
@@ -2729,7 +2970,7 @@ static err_t http_find_file(struct http_state *hs, const char *uri, int is_09) {
     /* check with the wui api */
     if (file == NULL) {
         if (0 == strncmp(uri, "/api/", WUI_API_ROOT_STR_LEN)) {
-            file = wui_api_main(uri, hs);
+            file = wui_api_main(uri, &hs->file_handle, hs->api_buf);
             strcat(uri, ".json"); // http server adds header info (data type) based on the file extension
         }
     }
@@ -2746,7 +2987,7 @@ static err_t http_find_file(struct http_state *hs, const char *uri, int is_09) {
 
         LWIP_DEBUGF(HTTPD_DEBUG | LWIP_DBG_TRACE, ("Opening %s\n", uri));
 
-        err = fs_open(&hs->file_handle, uri);
+        err = http_fs_open(hs, uri, is_09);
         if (err == ERR_OK) {
             file = &hs->file_handle;
         } else {
@@ -248,6 +248,13 @@
     #define LWIP_HTTPD_SUPPORT_11_KEEPALIVE 0
 #endif
 
+/** Maximum number of bytes of pipelined requests (received while a response
+ * is being sent) kept per persistent connection. The connection is closed
+ * when the client sends more. */
+#if !defined LWIP_HTTPD_PIPELINE_MAX_LEN || defined __DOXYGEN__
+    #define LWIP_HTTPD_PIPELINE_MAX_LEN 2048
+#endif
+
 /** Set this to 1 to support HTTP request coming in in multiple packets/pbufs */
 #if !defined LWIP_HTTPD_SUPPORT_REQUESTLIST || defined __DOXYGEN__
     #define LWIP_HTTPD_SUPPORT_REQUESTLIST 1
@@ -18,6 +18,8 @@ static const char *const g_psHTTPHeaderStrings[] = {
     "HTTP/1.0 404 File not found\r\n",
     "HTTP/1.0 400 Bad Request\r\n",
     "HTTP/1.0 501 Not Implemented\r\n",
+    "HTTP/1.0 409 Conflict\r\n",
+    "HTTP/1.0 500 Internal Server Error\r\n",
     "HTTP/1.1 200 OK\r\n",
     "HTTP/1.1 404 File not found\r\n",
     "HTTP/1.1 400 Bad Request\r\n",
@@ -39,18 +41,20 @@ static const char *const g_psHTTPHeaderStrings[] = {
     #define HTTP_HDR_NOT_FOUND      1  /* 404 File not found */
     #define HTTP_HDR_BAD_REQUEST    2  /* 400 Bad request */
     #define HTTP_HDR_NOT_IMPL       3  /* 501 Not Implemented */
-    #define HTTP_HDR_OK_11          4  /* 200 OK */
-    #define HTTP_HDR_NOT_FOUND_11   5  /* 404 File not found */
-    #define HTTP_HDR_BAD_REQUEST_11 6  /* 400 Bad request */
-    #define HTTP_HDR_NOT_IMPL_11    7  /* 501 Not Implemented */
-    #define HTTP_HDR_CONTENT_LENGTH 8  /* Content-Length: (HTTP 1.0)*/
-    #define HTTP_HDR_CONN_CLOSE     9  /* Connection: Close (HTTP 1.1) */
-    #define HTTP_HDR_CONN_KEEPALIVE 10 /* Connection: keep-alive (HTTP 1.1) */
-    #define HTTP_HDR_KEEPALIVE_LEN  11 /* Connection: keep-alive + Content-Length: (HTTP 1.1)*/
-    #define HTTP_HDR_SERVER         12 /* Server: HTTPD_SERVER_AGENT */
-    #define DEFAULT_404_HTML        13 /* default 404 body */
+    #define HTTP_HDR_CONFLICT       4  /* 409 Conflict */
+    #define HTTP_HDR_INTERNAL_ERROR 5  /* 500 Internal Server Error */
+    #define HTTP_HDR_OK_11          6  /* 200 OK */
+    #define HTTP_HDR_NOT_FOUND_11   7  /* 404 File not found */
+    #define HTTP_HDR_BAD_REQUEST_11 8  /* 400 Bad request */
+    #define HTTP_HDR_NOT_IMPL_11    9  /* 501 Not Implemented */
+    #define HTTP_HDR_CONTENT_LENGTH 10 /* Content-Length: (HTTP 1.0)*/
+    #define HTTP_HDR_CONN_CLOSE     11 /* Connection: Close (HTTP 1.1) */
+    #define HTTP_HDR_CONN_KEEPALIVE 12 /* Connection: keep-alive (HTTP 1.1) */
+    #define HTTP_HDR_KEEPALIVE_LEN  13 /* Connection: keep-alive + Content-Length: (HTTP 1.1)*/
+    #define HTTP_HDR_SERVER         14 /* Server: HTTPD_SERVER_AGENT */
+    #define DEFAULT_404_HTML        15 /* default 404 body */
     #if LWIP_HTTPD_SUPPORT_11_KEEPALIVE
-        #define DEFAULT_404_HTML_PERSISTENT 14 /* default 404 body, but including Connection: keep-alive */
+        #define DEFAULT_404_HTML_PERSISTENT 16 /* default 404 body, but including Connection: keep-alive */
     #endif
 
     #define HTTP_CONTENT_TYPE(contenttype)                    "Content-Type: " contenttype "\r\n\r\n"
@@ -41,8 +41,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 404 File not found
-" (29 bytes) */
+    /* "HTTP/1.1 404 File not found\r\n" (29 bytes) */
     0x48,
     0x54,
     0x54,
@@ -50,7 +49,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x34,
     0x30,
@@ -72,8 +71,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x64,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -137,8 +135,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 260
-" (18+ bytes) */
+    /* "Content-Length: 250\r\n" (21 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -156,13 +153,11 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x3a,
     0x20,
     0x32,
-    0x36,
+    0x35,
     0x30,
     0x0d,
     0x0a,
-    /* "Content-Type: text/html
-
-" (27 bytes) */
+    /* "Content-Type: text/html\r\n\r\n" (27 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -190,7 +185,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (260 bytes) */
+    /* raw file data (250 bytes) */
     0x3c,
     0x68,
     0x74,
@@ -203,7 +198,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x61,
     0x64,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x6d,
@@ -311,7 +305,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x61,
     0x64,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x62,
@@ -348,7 +341,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x6b,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -358,7 +350,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x62,
     0x72,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -368,7 +359,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x62,
     0x72,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -382,7 +372,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x65,
     0x72,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -404,7 +393,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x68,
     0x31,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -422,7 +410,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x68,
     0x32,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -433,7 +420,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x65,
     0x72,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -449,7 +435,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__404_html[] FSDATA_ALIGN_POST =
     0x6d,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
 };
 
@@ -480,8 +465,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -489,7 +473,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -499,8 +483,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -564,8 +547,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 5724
-" (18+ bytes) */
+    /* "Content-Length: 5686\r\n" (22 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -583,14 +565,89 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x3a,
     0x20,
     0x35,
+    0x36,
+    0x38,
+    0x36,
+    0x0d,
+    0x0a,
+    /* "ETag: \"f13d5c73495d4ac4\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x66,
+    0x31,
+    0x33,
+    0x64,
+    0x35,
+    0x63,
     0x37,
-    0x32,
+    0x33,
+    0x34,
+    0x39,
+    0x35,
+    0x64,
     0x34,
+    0x61,
+    0x63,
+    0x34,
+    0x22,
     0x0d,
     0x0a,
-    /* "Content-Type: image/svg+xml
-
-" (31 bytes) */
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -622,7 +679,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (5724 bytes) */
+    /* raw file data (5686 bytes) */
     0x3c,
     0x3f,
     0x78,
@@ -661,7 +718,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x3f,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x21,
@@ -761,7 +817,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x64,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x21,
@@ -795,7 +850,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x2d,
     0x2d,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x73,
@@ -1057,7 +1111,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x64,
     0x64,
     0x22,
-    0x0d,
     0x0a,
     0x76,
     0x69,
@@ -1089,7 +1142,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x34,
     0x34,
     0x22,
-    0x0d,
     0x0a,
     0x20,
     0x78,
@@ -1135,7 +1187,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x6b,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x3c,
@@ -1144,7 +1195,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x66,
     0x73,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1171,7 +1221,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x73,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1185,7 +1234,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x54,
     0x41,
     0x5b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1211,7 +1259,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x46,
     0x45,
     0x7d,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1237,7 +1284,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x33,
     0x31,
     0x7d,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1281,7 +1327,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x72,
     0x6f,
     0x7d,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1325,7 +1370,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x72,
     0x6f,
     0x7d,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1333,7 +1377,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x5d,
     0x5d,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1345,7 +1388,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x6c,
     0x65,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x3c,
@@ -1355,7 +1397,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x66,
     0x73,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x3c,
@@ -1380,7 +1421,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x31,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1425,7 +1465,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1493,7 +1532,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -1778,7 +1816,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -2249,7 +2286,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -2511,7 +2547,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -3040,7 +3075,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -3246,7 +3280,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -3326,7 +3359,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -3708,7 +3740,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -4080,7 +4111,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -4310,7 +4340,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -4542,7 +4571,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -4774,7 +4802,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -5163,7 +5190,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -5331,7 +5357,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -5399,7 +5424,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -5673,7 +5697,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -5887,7 +5910,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -6330,14 +6352,12 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x3c,
     0x2f,
     0x67,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -6345,7 +6365,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg[] FSDATA_ALI
     0x76,
     0x67,
     0x3e,
-    0x0d,
     0x0a,
 };
 
@@ -6372,8 +6391,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__favicon_ico[] FSDATA_ALIGN_POS
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -6381,7 +6399,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__favicon_ico[] FSDATA_ALIGN_POS
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -6391,8 +6409,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__favicon_ico[] FSDATA_ALIGN_POS
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -6456,8 +6473,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__favicon_ico[] FSDATA_ALIGN_POS
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 1150
-" (18+ bytes) */
+    /* "Content-Length: 1150\r\n" (22 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -6480,9 +6496,84 @@ static const unsigned char FSDATA_ALIGN_PRE data__favicon_ico[] FSDATA_ALIGN_POS
     0x30,
     0x0d,
     0x0a,
-    /* "Content-Type: image/x-icon
-
-" (30 bytes) */
+    /* "ETag: \"b11ac9211b1b4c83\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x62,
+    0x31,
+    0x31,
+    0x61,
+    0x63,
+    0x39,
+    0x32,
+    0x31,
+    0x31,
+    0x62,
+    0x31,
+    0x62,
+    0x34,
+    0x63,
+    0x38,
+    0x33,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/x-icon\r\n\r\n" (30 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -7685,8 +7776,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -7694,7 +7784,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -7704,8 +7794,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -7769,8 +7858,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 2896
-" (18+ bytes) */
+    /* "Content-Length: 2722\r\n" (22 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -7788,14 +7876,89 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x3a,
     0x20,
     0x32,
-    0x38,
+    0x37,
+    0x32,
+    0x32,
+    0x0d,
+    0x0a,
+    /* "ETag: \"65f1feb59a68ba6e\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x36,
+    0x35,
+    0x66,
+    0x31,
+    0x66,
+    0x65,
+    0x62,
+    0x35,
     0x39,
+    0x61,
+    0x36,
+    0x38,
+    0x62,
+    0x61,
     0x36,
+    0x65,
+    0x22,
     0x0d,
     0x0a,
-    /* "Content-Type: text/css
-
-" (26 bytes) */
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: text/css\r\n\r\n" (26 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -7822,14 +7985,13 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (2896 bytes) */
+    /* raw file data (2722 bytes) */
     0x62,
     0x6f,
     0x64,
     0x79,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -7850,7 +8012,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x63,
     0x6b,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x63,
@@ -7866,7 +8027,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x74,
     0x65,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -7917,7 +8077,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x69,
     0x66,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -7930,7 +8089,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x20,
     0x30,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -7949,10 +8107,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x73,
     0x6d,
@@ -7961,7 +8117,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6c,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -7980,10 +8135,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x68,
@@ -7994,7 +8147,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x72,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8015,7 +8167,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8033,7 +8184,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x74,
     0x6f,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8052,7 +8202,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x65,
     0x6d,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -8087,16 +8236,13 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x61,
     0x79,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x68,
     0x31,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x64,
@@ -8115,10 +8261,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6e,
     0x65,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x68,
     0x31,
@@ -8131,7 +8275,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6e,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -8150,7 +8293,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -8173,7 +8315,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x65,
     0x72,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x63,
@@ -8189,7 +8330,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x63,
     0x6b,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -8210,7 +8350,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x74,
     0x65,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x70,
@@ -8236,10 +8375,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x68,
     0x31,
@@ -8251,7 +8388,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x67,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -8272,7 +8408,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8294,7 +8429,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x77,
@@ -8310,17 +8444,14 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x6e,
     0x61,
     0x76,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -8336,7 +8467,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x68,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x76,
@@ -8359,10 +8489,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6f,
     0x70,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x6e,
     0x61,
@@ -8376,7 +8504,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6e,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x64,
@@ -8401,7 +8528,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x63,
     0x6b,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -8422,7 +8548,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6c,
     0x64,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -8441,7 +8566,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x70,
@@ -8466,7 +8590,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x20,
     0x30,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8491,7 +8614,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -8531,10 +8653,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6e,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x6e,
     0x61,
@@ -8564,7 +8684,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x29,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x63,
@@ -8583,10 +8702,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x65,
     0x72,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x6e,
     0x61,
@@ -8622,7 +8739,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x72,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -8655,10 +8771,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6d,
     0x65,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x6e,
     0x61,
@@ -8680,7 +8794,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x5d,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -8716,10 +8829,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x31,
     0x62,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x6e,
     0x61,
@@ -8743,7 +8854,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x5d,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x63,
@@ -8758,10 +8868,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x61,
     0x79,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x63,
@@ -8775,7 +8883,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x72,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8796,7 +8903,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8814,7 +8920,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x74,
     0x6f,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8833,10 +8938,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x65,
     0x6d,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -8847,7 +8950,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x73,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8867,7 +8969,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x77,
@@ -8883,7 +8984,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x64,
@@ -8908,7 +9008,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x63,
     0x6b,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -8923,10 +9022,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x66,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -8943,7 +9040,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x76,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8968,7 +9064,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -8991,10 +9086,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -9023,7 +9116,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x65,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -9044,7 +9136,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6c,
     0x64,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6f,
@@ -9064,7 +9155,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x65,
     0x6e,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x77,
@@ -9087,7 +9177,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x61,
     0x70,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x74,
@@ -9114,10 +9203,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x69,
     0x73,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -9146,7 +9233,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x73,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x68,
@@ -9161,7 +9247,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -9184,7 +9269,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x33,
     0x31,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -9206,10 +9290,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x70,
@@ -9228,7 +9310,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x76,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x68,
@@ -9244,7 +9325,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x30,
     0x25,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x77,
@@ -9256,7 +9336,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x20,
     0x30,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -9279,12 +9358,9 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x31,
     0x62,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -9313,7 +9389,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x73,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x74,
@@ -9335,10 +9410,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x65,
     0x72,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -9361,7 +9434,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x67,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x77,
@@ -9376,7 +9448,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x68,
@@ -9392,10 +9463,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -9420,7 +9489,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6c,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x6c,
@@ -9441,7 +9509,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x77,
@@ -9456,7 +9523,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x68,
@@ -9472,7 +9538,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -9493,7 +9558,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x63,
     0x6b,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x74,
@@ -9506,7 +9570,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6c,
@@ -9519,10 +9582,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -9546,7 +9607,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6e,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x64,
@@ -9564,7 +9624,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x63,
     0x6b,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -9583,7 +9642,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -9604,7 +9662,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6c,
     0x64,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x70,
@@ -9626,7 +9683,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x76,
     0x65,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x74,
@@ -9639,7 +9695,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6c,
@@ -9653,10 +9708,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -9692,7 +9745,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x29,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x64,
@@ -9710,7 +9762,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x63,
     0x6b,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -9729,7 +9780,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x70,
@@ -9751,7 +9801,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x76,
     0x65,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x74,
@@ -9764,7 +9813,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6c,
@@ -9778,7 +9826,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x68,
@@ -9794,7 +9841,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -9818,7 +9864,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x77,
@@ -9834,10 +9879,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -9877,7 +9920,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x5d,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x64,
@@ -9895,7 +9937,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x63,
     0x6b,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x63,
@@ -9913,10 +9954,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x31,
     0x62,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x73,
@@ -9956,7 +9995,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x5d,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x64,
@@ -9974,7 +10012,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x63,
     0x6b,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x63,
@@ -9994,7 +10031,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x75,
     0x65,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x70,
@@ -10016,7 +10052,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x76,
     0x65,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x74,
@@ -10030,7 +10065,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -10054,12 +10088,9 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x2e,
     0x63,
@@ -10071,7 +10102,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x74,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x64,
@@ -10096,7 +10126,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x63,
     0x6b,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -10116,7 +10145,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x77,
@@ -10131,7 +10159,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x30,
     0x25,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -10154,10 +10181,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x63,
@@ -10182,7 +10207,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x5d,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x64,
@@ -10199,16 +10223,13 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6e,
     0x65,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x68,
     0x32,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x63,
@@ -10226,7 +10247,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x31,
     0x62,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -10245,7 +10265,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -10278,7 +10297,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x61,
     0x79,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -10295,10 +10313,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x20,
     0x30,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x68,
     0x32,
@@ -10312,7 +10328,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6c,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x63,
@@ -10327,10 +10342,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x61,
     0x79,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x63,
@@ -10354,7 +10367,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x65,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -10373,7 +10385,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -10394,10 +10405,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6c,
     0x64,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x63,
@@ -10421,7 +10430,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x73,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x68,
@@ -10437,7 +10445,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x78,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x62,
@@ -10460,7 +10467,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x33,
     0x31,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x6d,
@@ -10485,10 +10491,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x20,
     0x30,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x63,
@@ -10512,7 +10516,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x73,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x74,
@@ -10534,7 +10537,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x65,
     0x72,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -10553,7 +10555,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -10574,10 +10575,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6c,
     0x64,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x72,
@@ -10591,7 +10590,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x6c,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x63,
@@ -10606,7 +10604,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x61,
     0x79,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x70,
@@ -10627,7 +10624,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x63,
@@ -10642,10 +10638,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x74,
     0x68,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
     0x2e,
     0x72,
@@ -10664,7 +10658,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x2c,
-    0x0d,
     0x0a,
     0x2e,
     0x72,
@@ -10685,7 +10678,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x76,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x09,
     0x77,
@@ -10699,7 +10691,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x33,
     0x25,
     0x3b,
-    0x0d,
     0x0a,
     0x09,
     0x66,
@@ -10714,10 +10705,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_css[] FSDATA_ALIGN_POST
     0x66,
     0x74,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
 };
 
@@ -10740,8 +10729,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -10749,7 +10737,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -10759,8 +10747,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -10824,8 +10811,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 2740
-" (18+ bytes) */
+    /* "Content-Length: 2658\r\n" (22 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -10843,14 +10829,89 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x3a,
     0x20,
     0x32,
+    0x36,
+    0x35,
+    0x38,
+    0x0d,
+    0x0a,
+    /* "ETag: \"55dd5b995735a2aa\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x35,
+    0x35,
+    0x64,
+    0x64,
+    0x35,
+    0x62,
+    0x39,
+    0x39,
+    0x35,
     0x37,
-    0x34,
-    0x30,
+    0x33,
+    0x35,
+    0x61,
+    0x32,
+    0x61,
+    0x61,
+    0x22,
     0x0d,
     0x0a,
-    /* "Content-Type: text/html
-
-" (27 bytes) */
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: text/html\r\n\r\n" (27 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -10878,14 +10939,13 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (2740 bytes) */
+    /* raw file data (2658 bytes) */
     0x3c,
     0x68,
     0x74,
     0x6d,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x68,
@@ -10893,7 +10953,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x64,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -10966,7 +11025,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x38,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11042,7 +11100,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x30,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11106,7 +11163,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x20,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11180,7 +11236,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x20,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -11189,7 +11244,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x64,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x62,
@@ -11197,7 +11251,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x64,
     0x79,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11223,7 +11276,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x72,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11271,7 +11323,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x68,
     0x31,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11286,7 +11337,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11351,7 +11401,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x6e,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11367,7 +11416,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11409,7 +11457,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11421,9 +11468,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11450,7 +11495,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x72,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11511,7 +11555,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11552,7 +11595,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x68,
     0x32,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11598,7 +11640,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x2f,
     0x70,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11663,9 +11704,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x72,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11681,9 +11720,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11714,9 +11751,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x22,
     0x20,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11747,7 +11782,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11793,7 +11827,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11850,7 +11883,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11896,7 +11928,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11916,9 +11947,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11951,7 +11980,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -11998,7 +12026,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x67,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12049,7 +12076,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12090,7 +12116,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x6e,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12113,7 +12138,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12210,7 +12234,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x6c,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12309,7 +12332,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x6c,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12333,7 +12355,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12353,9 +12374,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12385,7 +12404,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x64,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12433,7 +12451,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x67,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12473,7 +12490,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12514,7 +12530,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x6e,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12537,7 +12552,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12634,7 +12648,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x6c,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12733,7 +12746,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x6c,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12757,7 +12769,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12777,9 +12788,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12819,7 +12828,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x64,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12868,7 +12876,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x67,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12915,7 +12922,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12950,7 +12956,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x6e,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -12970,9 +12975,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13011,7 +13014,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x77,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13059,7 +13061,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x67,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13103,7 +13104,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13138,7 +13138,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x6e,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13158,9 +13157,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13193,7 +13190,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x73,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13240,7 +13236,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x67,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13281,7 +13276,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13320,7 +13314,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x6e,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13340,9 +13333,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13385,7 +13376,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x6c,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13434,7 +13424,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x67,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13475,7 +13464,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x65,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13509,7 +13497,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x61,
     0x6e,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13529,7 +13516,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13545,9 +13531,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13559,9 +13543,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x69,
     0x76,
     0x3e,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -13599,7 +13581,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x70,
     0x74,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -13608,7 +13589,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x64,
     0x79,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -13617,7 +13597,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_html[] FSDATA_ALIGN_POST
     0x6d,
     0x6c,
     0x3e,
-    0x0d,
     0x0a,
 };
 
@@ -13640,8 +13619,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -13649,7 +13627,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -13659,8 +13637,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -13724,8 +13701,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 4078
-" (18+ bytes) */
+    /* "Content-Length: 3964\r\n" (22 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -13742,15 +13718,90 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x68,
     0x3a,
     0x20,
+    0x33,
+    0x39,
+    0x36,
     0x34,
-    0x30,
-    0x37,
+    0x0d,
+    0x0a,
+    /* "ETag: \"b384c5099a5ae9b4\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x62,
+    0x33,
     0x38,
+    0x34,
+    0x63,
+    0x35,
+    0x30,
+    0x39,
+    0x39,
+    0x61,
+    0x35,
+    0x61,
+    0x65,
+    0x39,
+    0x62,
+    0x34,
+    0x22,
     0x0d,
     0x0a,
-    /* "Content-Type: application/javascript
-
-" (40 bytes) */
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: application/javascript\r\n\r\n" (40 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -13791,7 +13842,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (4078 bytes) */
+    /* raw file data (3964 bytes) */
     0x76,
     0x61,
     0x72,
@@ -13860,7 +13911,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x76,
     0x61,
@@ -13924,7 +13974,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x76,
     0x61,
@@ -14001,7 +14050,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x76,
     0x61,
@@ -14076,7 +14124,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x76,
     0x61,
@@ -14159,7 +14206,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x76,
     0x61,
@@ -14216,7 +14262,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x76,
     0x61,
@@ -14276,7 +14321,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x76,
     0x61,
@@ -14332,11 +14376,8 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x66,
     0x75,
@@ -14364,7 +14405,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x74,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14439,7 +14479,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14514,9 +14553,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14561,7 +14598,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14616,7 +14652,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x5d,
     0x22,
     0x29,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14656,7 +14691,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14699,12 +14733,9 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x22,
     0x29,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x66,
     0x75,
@@ -14738,7 +14769,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x72,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14768,7 +14798,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x29,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14785,16 +14814,13 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x72,
     0x6e,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
     0x20,
     0x20,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14840,7 +14866,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x74,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14888,7 +14913,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x5d,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -14941,7 +14965,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x74,
     0x20,
     0x3d,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15021,7 +15044,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x43,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15076,7 +15098,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x5d,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15098,7 +15119,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x32,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15182,7 +15202,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15196,7 +15215,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15279,14 +15297,12 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6e,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
     0x20,
     0x20,
     0x7d,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15334,7 +15350,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x39,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15418,7 +15433,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15432,7 +15446,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15515,16 +15528,13 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6e,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
     0x20,
     0x20,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15567,7 +15577,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x5d,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15617,7 +15626,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x74,
     0x20,
     0x3d,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15691,7 +15699,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x43,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15736,7 +15743,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x5d,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15758,7 +15764,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x32,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15839,7 +15844,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15853,7 +15857,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15933,16 +15936,13 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6e,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
     0x20,
     0x20,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -15991,7 +15991,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x29,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16072,7 +16071,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16086,7 +16084,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16166,16 +16163,13 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6e,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
     0x20,
     0x20,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16243,7 +16237,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x5d,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16296,7 +16289,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x74,
     0x20,
     0x3d,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16323,9 +16315,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x25,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16387,7 +16377,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x5d,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16459,9 +16448,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x25,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16535,7 +16522,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x5d,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16610,13 +16596,10 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x61,
     0x6c,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
     0x3b,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x66,
     0x75,
@@ -16646,7 +16629,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x72,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16676,7 +16658,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x29,
     0x20,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16693,16 +16674,13 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x72,
     0x6e,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
     0x20,
     0x20,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16748,7 +16726,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x74,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16809,7 +16786,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x20,
     0x30,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16846,7 +16822,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6d,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16889,7 +16864,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x25,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16898,7 +16872,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x7d,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16935,7 +16908,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6d,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16976,7 +16948,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x25,
     0x22,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -16985,9 +16956,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x7d,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17020,7 +16989,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x5d,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17066,7 +17034,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17108,7 +17075,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6d,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17147,7 +17113,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6d,
     0x65,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17160,19 +17125,15 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x7d,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
     0x20,
     0x20,
     0x7d,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x66,
     0x75,
@@ -17207,7 +17168,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6b,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17244,7 +17204,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x28,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17277,7 +17236,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17340,7 +17298,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17416,7 +17373,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x22,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17458,7 +17414,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x28,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17493,7 +17448,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x34,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17514,7 +17468,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x72,
     0x6e,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17525,7 +17478,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x20,
     0x20,
     0x7d,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17549,7 +17501,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x72,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17557,7 +17508,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x20,
     0x7d,
     0x3b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17574,12 +17524,9 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x28,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x66,
     0x75,
@@ -17606,7 +17553,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x28,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17655,7 +17601,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x65,
     0x72,
     0x29,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17697,12 +17642,9 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x62,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x73,
     0x65,
@@ -17736,9 +17678,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x30,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
-    0x0d,
     0x0a,
     0x64,
     0x6f,
@@ -17816,7 +17756,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6d,
     0x29,
     0x7b,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -17863,12 +17802,10 @@ static const unsigned char FSDATA_ALIGN_PRE data__index_js[] FSDATA_ALIGN_POST =
     0x6b,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
     0x7d,
     0x29,
     0x3b,
-    0x0d,
     0x0a,
 };
 
@@ -17903,8 +17840,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg[] FSDATA_A
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -17912,7 +17848,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg[] FSDATA_A
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -17922,8 +17858,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg[] FSDATA_A
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -17987,8 +17922,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg[] FSDATA_A
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 1024
-" (18+ bytes) */
+    /* "Content-Length: 1019\r\n" (22 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -18007,13 +17941,88 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg[] FSDATA_A
     0x20,
     0x31,
     0x30,
-    0x32,
+    0x31,
+    0x39,
+    0x0d,
+    0x0a,
+    /* "ETag: \"bf4304377e0c28dc\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x62,
+    0x66,
     0x34,
+    0x33,
+    0x30,
+    0x34,
+    0x33,
+    0x37,
+    0x37,
+    0x65,
+    0x30,
+    0x63,
+    0x32,
+    0x38,
+    0x64,
+    0x63,
+    0x22,
     0x0d,
     0x0a,
-    /* "Content-Type: image/svg+xml
-
-" (31 bytes) */
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -18045,12 +18054,11 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg[] FSDATA_A
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (1024 bytes) */
+    /* raw file data (1019 bytes) */
     0x3c,
     0x73,
     0x76,
     0x67,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -18241,7 +18249,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg[] FSDATA_A
     0x64,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -18761,7 +18768,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg[] FSDATA_A
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -19060,7 +19066,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg[] FSDATA_A
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -19068,7 +19073,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg[] FSDATA_A
     0x76,
     0x67,
     0x3e,
-    0x0d,
     0x0a,
 };
 
@@ -19099,8 +19103,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg[] FSDATA_AL
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -19108,7 +19111,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg[] FSDATA_AL
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -19118,8 +19121,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg[] FSDATA_AL
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -19183,8 +19185,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg[] FSDATA_AL
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 765
-" (18+ bytes) */
+    /* "Content-Length: 760\r\n" (21 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -19203,12 +19204,87 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg[] FSDATA_AL
     0x20,
     0x37,
     0x36,
-    0x35,
+    0x30,
     0x0d,
     0x0a,
-    /* "Content-Type: image/svg+xml
-
-" (31 bytes) */
+    /* "ETag: \"2331944d34c268f2\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x32,
+    0x33,
+    0x33,
+    0x31,
+    0x39,
+    0x34,
+    0x34,
+    0x64,
+    0x33,
+    0x34,
+    0x63,
+    0x32,
+    0x36,
+    0x38,
+    0x66,
+    0x32,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -19240,12 +19316,11 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg[] FSDATA_AL
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (765 bytes) */
+    /* raw file data (760 bytes) */
     0x3c,
     0x73,
     0x76,
     0x67,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -19433,7 +19508,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg[] FSDATA_AL
     0x64,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -19924,7 +19998,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg[] FSDATA_AL
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -19996,7 +20069,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg[] FSDATA_AL
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -20004,7 +20076,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg[] FSDATA_AL
     0x76,
     0x67,
     0x3e,
-    0x0d,
     0x0a,
 };
 
@@ -20035,8 +20106,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg[] FSDATA_ALI
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -20044,7 +20114,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg[] FSDATA_ALI
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -20054,8 +20124,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg[] FSDATA_ALI
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -20119,8 +20188,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg[] FSDATA_ALI
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 524
-" (18+ bytes) */
+    /* "Content-Length: 519\r\n" (21 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -20138,13 +20206,88 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg[] FSDATA_ALI
     0x3a,
     0x20,
     0x35,
+    0x31,
+    0x39,
+    0x0d,
+    0x0a,
+    /* "ETag: \"8763b121352f782c\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x38,
+    0x37,
+    0x36,
+    0x33,
+    0x62,
+    0x31,
+    0x32,
+    0x31,
+    0x33,
+    0x35,
     0x32,
-    0x34,
+    0x66,
+    0x37,
+    0x38,
+    0x32,
+    0x63,
+    0x22,
     0x0d,
     0x0a,
-    /* "Content-Type: image/svg+xml
-
-" (31 bytes) */
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -20176,12 +20319,11 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg[] FSDATA_ALI
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (524 bytes) */
+    /* raw file data (519 bytes) */
     0x3c,
     0x73,
     0x76,
     0x67,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -20367,7 +20509,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg[] FSDATA_ALI
     0x6f,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -20590,7 +20731,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -20691,7 +20831,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -20699,7 +20838,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg[] FSDATA_ALI
     0x76,
     0x67,
     0x3e,
-    0x0d,
     0x0a,
 };
 
@@ -20730,8 +20868,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg[] FSDATA_AL
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -20739,7 +20876,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg[] FSDATA_AL
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -20749,8 +20886,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg[] FSDATA_AL
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -20814,8 +20950,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg[] FSDATA_AL
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 475
-" (18+ bytes) */
+    /* "Content-Length: 470\r\n" (21 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -20834,12 +20969,87 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg[] FSDATA_AL
     0x20,
     0x34,
     0x37,
+    0x30,
+    0x0d,
+    0x0a,
+    /* "ETag: \"3421ef843737549f\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x33,
+    0x34,
+    0x32,
+    0x31,
+    0x65,
+    0x66,
+    0x38,
+    0x34,
+    0x33,
+    0x37,
+    0x33,
+    0x37,
     0x35,
+    0x34,
+    0x39,
+    0x66,
+    0x22,
     0x0d,
     0x0a,
-    /* "Content-Type: image/svg+xml
-
-" (31 bytes) */
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -20871,12 +21081,11 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg[] FSDATA_AL
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (475 bytes) */
+    /* raw file data (470 bytes) */
     0x3c,
     0x73,
     0x76,
     0x67,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -21061,7 +21270,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg[] FSDATA_AL
     0x64,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -21131,7 +21339,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg[] FSDATA_AL
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -21337,7 +21544,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg[] FSDATA_AL
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -21345,7 +21551,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg[] FSDATA_AL
     0x76,
     0x67,
     0x3e,
-    0x0d,
     0x0a,
 };
 
@@ -21380,8 +21585,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg[] FSDATA_A
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -21389,7 +21593,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg[] FSDATA_A
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -21399,8 +21603,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg[] FSDATA_A
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -21464,8 +21667,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg[] FSDATA_A
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 1489
-" (18+ bytes) */
+    /* "Content-Length: 1484\r\n" (22 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -21485,12 +21687,87 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg[] FSDATA_A
     0x31,
     0x34,
     0x38,
+    0x34,
+    0x0d,
+    0x0a,
+    /* "ETag: \"e5c3462962924e8a\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x65,
+    0x35,
+    0x63,
+    0x33,
+    0x34,
+    0x36,
+    0x32,
     0x39,
+    0x36,
+    0x32,
+    0x39,
+    0x32,
+    0x34,
+    0x65,
+    0x38,
+    0x61,
+    0x22,
     0x0d,
     0x0a,
-    /* "Content-Type: image/svg+xml
-
-" (31 bytes) */
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -21522,12 +21799,11 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg[] FSDATA_A
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (1489 bytes) */
+    /* raw file data (1484 bytes) */
     0x3c,
     0x73,
     0x76,
     0x67,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -21717,7 +21993,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg[] FSDATA_A
     0x64,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -22204,7 +22479,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg[] FSDATA_A
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -23002,7 +23276,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg[] FSDATA_A
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -23010,7 +23283,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg[] FSDATA_A
     0x76,
     0x67,
     0x3e,
-    0x0d,
     0x0a,
 };
 
@@ -23041,8 +23313,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg[] FSDATA_ALI
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -23050,7 +23321,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg[] FSDATA_ALI
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -23060,8 +23331,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg[] FSDATA_ALI
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -23125,8 +23395,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg[] FSDATA_ALI
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 449
-" (18+ bytes) */
+    /* "Content-Length: 444\r\n" (21 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -23145,12 +23414,87 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg[] FSDATA_ALI
     0x20,
     0x34,
     0x34,
-    0x39,
+    0x34,
     0x0d,
     0x0a,
-    /* "Content-Type: image/svg+xml
-
-" (31 bytes) */
+    /* "ETag: \"3868038abd6de822\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x33,
+    0x38,
+    0x36,
+    0x38,
+    0x30,
+    0x33,
+    0x38,
+    0x61,
+    0x62,
+    0x64,
+    0x36,
+    0x64,
+    0x65,
+    0x38,
+    0x32,
+    0x32,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -23182,12 +23526,11 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg[] FSDATA_ALI
     0x0a,
     0x0d,
     0x0a,
-    /* raw file data (449 bytes) */
+    /* raw file data (444 bytes) */
     0x3c,
     0x73,
     0x76,
     0x67,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -23377,7 +23720,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg[] FSDATA_ALI
     0x64,
     0x22,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -23481,7 +23823,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x20,
     0x20,
@@ -23622,7 +23963,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg[] FSDATA_ALI
     0x22,
     0x2f,
     0x3e,
-    0x0d,
     0x0a,
     0x3c,
     0x2f,
@@ -23630,7 +23970,6 @@ static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg[] FSDATA_ALI
     0x76,
     0x67,
     0x3e,
-    0x0d,
     0x0a,
 };
 
@@ -23665,8 +24004,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_gif[] FSDAT
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -23674,7 +24012,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_gif[] FSDAT
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -23684,8 +24022,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_gif[] FSDAT
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -23749,8 +24086,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_gif[] FSDAT
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 13162
-" (18+ bytes) */
+    /* "Content-Length: 13162\r\n" (23 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -23774,9 +24110,60 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_gif[] FSDAT
     0x32,
     0x0d,
     0x0a,
-    /* "Content-Type: image/gif
-
-" (27 bytes) */
+    /* "ETag: \"02b14f7614ef4d5e\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x30,
+    0x32,
+    0x62,
+    0x31,
+    0x34,
+    0x66,
+    0x37,
+    0x36,
+    0x31,
+    0x34,
+    0x65,
+    0x66,
+    0x34,
+    0x64,
+    0x35,
+    0x65,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/gif\r\n\r\n" (27 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -37000,8 +37387,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_png[] FSDAT
     0x00,
 
     /* HTTP header */
-    /* "HTTP/1.0 200 OK
-" (17 bytes) */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
     0x48,
     0x54,
     0x54,
@@ -37009,7 +37395,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_png[] FSDAT
     0x2f,
     0x31,
     0x2e,
-    0x30,
+    0x31,
     0x20,
     0x32,
     0x30,
@@ -37019,8 +37405,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_png[] FSDAT
     0x4b,
     0x0d,
     0x0a,
-    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
     0x53,
     0x65,
     0x72,
@@ -37084,8 +37469,7 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_png[] FSDAT
     0x29,
     0x0d,
     0x0a,
-    /* "Content-Length: 4507
-" (18+ bytes) */
+    /* "Content-Length: 4507\r\n" (22 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -37108,9 +37492,60 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_png[] FSDAT
     0x37,
     0x0d,
     0x0a,
-    /* "Content-Type: image/png
-
-" (27 bytes) */
+    /* "ETag: \"ec88499d97ea5e95\"\r\n" (26 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x65,
+    0x63,
+    0x38,
+    0x38,
+    0x34,
+    0x39,
+    0x39,
+    0x64,
+    0x39,
+    0x37,
+    0x65,
+    0x61,
+    0x35,
+    0x65,
+    0x39,
+    0x35,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/png\r\n\r\n" (27 bytes) */
     0x43,
     0x6f,
     0x6e,
@@ -41648,117 +42083,11222 @@ static const unsigned char FSDATA_ALIGN_PRE data__under_construction_png[] FSDAT
     0x82,
 };
 
-const struct fsdata_file file__404_html[] = { {
-    file_NULL,
-    data__404_html,
-    data__404_html + 12,
-    sizeof(data__404_html) - 12,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__connect_black_svg[] = { {
-    file__404_html,
-    data__connect_black_svg,
-    data__connect_black_svg + 20,
-    sizeof(data__connect_black_svg) - 20,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__favicon_ico[] = { {
-    file__connect_black_svg,
-    data__favicon_ico,
-    data__favicon_ico + 16,
-    sizeof(data__favicon_ico) - 16,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__index_css[] = { {
-    file__favicon_ico,
-    data__index_css,
-    data__index_css + 12,
-    sizeof(data__index_css) - 12,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__index_html[] = { {
-    file__index_css,
-    data__index_html,
-    data__index_html + 12,
-    sizeof(data__index_html) - 12,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__index_js[] = { {
-    file__index_html,
-    data__index_js,
-    data__index_js + 12,
-    sizeof(data__index_js) - 12,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__status_filament_svg[] = { {
-    file__index_js,
-    data__status_filament_svg,
-    data__status_filament_svg + 24,
-    sizeof(data__status_filament_svg) - 24,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__status_heatbed_svg[] = { {
-    file__status_filament_svg,
-    data__status_heatbed_svg,
-    data__status_heatbed_svg + 20,
-    sizeof(data__status_heatbed_svg) - 20,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__status_nozzle_svg[] = { {
-    file__status_heatbed_svg,
-    data__status_nozzle_svg,
-    data__status_nozzle_svg + 20,
-    sizeof(data__status_nozzle_svg) - 20,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__status_prnflow_svg[] = { {
-    file__status_nozzle_svg,
-    data__status_prnflow_svg,
-    data__status_prnflow_svg + 20,
-    sizeof(data__status_prnflow_svg) - 20,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__status_prnspeed_svg[] = { {
-    file__status_prnflow_svg,
-    data__status_prnspeed_svg,
-    data__status_prnspeed_svg + 24,
-    sizeof(data__status_prnspeed_svg) - 24,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__status_z_axis_svg[] = { {
-    file__status_prnspeed_svg,
-    data__status_z_axis_svg,
-    data__status_z_axis_svg + 20,
-    sizeof(data__status_z_axis_svg) - 20,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
-
-const struct fsdata_file file__under_construction_gif[] = { {
-    file__status_z_axis_svg,
-    data__under_construction_gif,
-    data__under_construction_gif + 24,
-    sizeof(data__under_construction_gif) - 24,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__connect_black_svg_gz = 14;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__connect_black_svg_gz[] FSDATA_ALIGN_POST = {
+    /* /connect_black.svg (19 chars) */
+    0x2f,
+    0x63,
+    0x6f,
+    0x6e,
+    0x6e,
+    0x65,
+    0x63,
+    0x74,
+    0x5f,
+    0x62,
+    0x6c,
+    0x61,
+    0x63,
+    0x6b,
+    0x2e,
+    0x73,
+    0x76,
+    0x67,
+    0x00,
+    0x00,
 
-const struct fsdata_file file__under_construction_png[] = { {
-    file__under_construction_gif,
-    data__under_construction_png,
-    data__under_construction_png + 24,
-    sizeof(data__under_construction_png) - 24,
-    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
-} };
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 2245\r\n" (22 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x32,
+    0x32,
+    0x34,
+    0x35,
+    0x0d,
+    0x0a,
+    /* "ETag: \"f13d5c73495d4ac4-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x66,
+    0x31,
+    0x33,
+    0x64,
+    0x35,
+    0x63,
+    0x37,
+    0x33,
+    0x34,
+    0x39,
+    0x35,
+    0x64,
+    0x34,
+    0x61,
+    0x63,
+    0x34,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x69,
+    0x6d,
+    0x61,
+    0x67,
+    0x65,
+    0x2f,
+    0x73,
+    0x76,
+    0x67,
+    0x2b,
+    0x78,
+    0x6d,
+    0x6c,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (2245 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0xed,
+    0x58,
+    0x5b,
+    0x6f,
+    0xe3,
+    0xc6,
+    0x15,
+    0x7e,
+    0xf7,
+    0xaf,
+    0x98,
+    0xb0,
+    0xaf,
+    0xe4,
+    0x68,
+    0xee,
+    0x17,
+    0xaf,
+    0xbd,
+    0x81,
+    0xd7,
+    0xde,
+    0x04,
+    0x01,
+    0x92,
+    0x66,
+    0xd3,
+    0x6e,
+    0x1a,
+    0x04,
+    0x41,
+    0xb0,
+    0x10,
+    0x24,
+    0xc6,
+    0x16,
+    0x4a,
+    0x4b,
+    0x82,
+    0xa4,
+    0xf8,
+    0x56,
+    0xf4,
+    0xbf,
+    0xf7,
+    0x3b,
+    0x33,
+    0x43,
+    0x52,
+    0x96,
+    0xe5,
+    0x6d,
+    0xf2,
+    0xd0,
+    0xb7,
+    0xc2,
+    0x80,
+    0xa5,
+    0x6f,
+    0x78,
+    0x38,
+    0xe7,
+    0x7e,
+    0xd3,
+    0xd9,
+    0x97,
+    0x0f,
+    0xb7,
+    0x1d,
+    0xbb,
+    0x6b,
+    0x37,
+    0xdb,
+    0xc5,
+    0x6a,
+    0x79,
+    0x5e,
+    0x49,
+    0x2e,
+    0x2a,
+    0xd6,
+    0x2e,
+    0x67,
+    0xab,
+    0xf9,
+    0x62,
+    0x79,
+    0x7d,
+    0x5e,
+    0xfd,
+    0xf8,
+    0xf1,
+    0xab,
+    0x26,
+    0x54,
+    0x5f,
+    0xbe,
+    0x3d,
+    0x39,
+    0xfb,
+    0xe2,
+    0xea,
+    0xfb,
+    0xcb,
+    0x8f,
+    0x3f,
+    0x7f,
+    0x78,
+    0xcf,
+    0xb6,
+    0x77,
+    0xd7,
+    0xec,
+    0xc3,
+    0x8f,
+    0xef,
+    0xbe,
+    0xfd,
+    0xe6,
+    0x92,
+    0x55,
+    0xcd,
+    0x64,
+    0xf2,
+    0x93,
+    0xbe,
+    0x9c,
+    0x4c,
+    0xae,
+    0x3e,
+    0x5e,
+    0xb1,
+    0xbf,
+    0xff,
+    0xe3,
+    0x6b,
+    0x26,
+    0xb9,
+    0x9c,
+    0x4c,
+    0xde,
+    0xff,
+    0xb5,
+    0x62,
+    0xd5,
+    0xcd,
+    0x6e,
+    0xb7,
+    0x3e,
+    0x9d,
+    0x4c,
+    0xee,
+    0xef,
+    0xef,
+    0xf9,
+    0xbd,
+    0xe6,
+    0xab,
+    0xcd,
+    0xf5,
+    0xe4,
+    0xeb,
+    0xcd,
+    0x74,
+    0x7d,
+    0xb3,
+    0x98,
+    0x6d,
+    0x27,
+    0x20,
+    0x9c,
+    0x10,
+    0x21,
+    0x5e,
+    0x9a,
+    0xe0,
+    0x32,
+    0x29,
+    0xf9,
+    0x7c,
+    0x37,
+    0xaf,
+    0x88,
+    0x45,
+    0xd3,
+    0xb0,
+    0xcb,
+    0x4d,
+    0x3b,
+    0xdd,
+    0xad,
+    0x36,
+    0xa7,
+    0xec,
+    0x72,
+    0xb5,
+    0x69,
+    0xbb,
+    0xab,
+    0xbf,
+    0x5d,
+    0xfc,
+    0xc4,
+    0x94,
+    0x90,
+    0x9e,
+    0x35,
+    0x0d,
+    0x08,
+    0x88,
+    0x35,
+    0xa4,
+    0x5d,
+    0x6e,
+    0xcf,
+    0x8f,
+    0xdc,
+    0xaf,
+    0x84,
+    0x10,
+    0x74,
+    0x5f,
+    0x45,
+    0x24,
+    0xa7,
+    0xdb,
+    0xf5,
+    0x74,
+    0xd6,
+    0x9e,
+    0x57,
+    0xeb,
+    0x4d,
+    0xbb,
+    0x6d,
+    0x37,
+    0x77,
+    0x6d,
+    0xc5,
+    0xee,
+    0x17,
+    0xf3,
+    0xdd,
+    0x0d,
+    0xf4,
+    0x13,
+    0x96,
+    0x07,
+    0xad,
+    0x6f,
+    0x6f,
+    0x2b,
+    0x76,
+    0xd3,
+    0x2e,
+    0xae,
+    0x6f,
+    0x76,
+    0x38,
+    0x0a,
+    0x5c,
+    0x1b,
+    0x63,
+    0xe8,
+    0x68,
+    0xcf,
+    0x0c,
+    0xb2,
+    0x62,
+    0xdb,
+    0xdd,
+    0x63,
+    0x87,
+    0x3b,
+    0xb6,
+    0x37,
+    0xd3,
+    0x75,
+    0xdb,
+    0x6c,
+    0xda,
+    0xe5,
+    0xbc,
+    0xdd,
+    0xc0,
+    0x28,
+    0xa7,
+    0xd7,
+    0xed,
+    0xea,
+    0xb6,
+    0xdd,
+    0x6d,
+    0x16,
+    0xb3,
+    0x0f,
+    0x9b,
+    0x76,
+    0xb6,
+    0x20,
+    0xfa,
+    0x37,
+    0x6c,
+    0xd7,
+    0x3e,
+    0xec,
+    0xfe,
+    0x0b,
+    0xc9,
+    0xe2,
+    0x76,
+    0x7a,
+    0xbd,
+    0x7f,
+    0xcd,
+    0x6a,
+    0xbd,
+    0x5b,
+    0xdc,
+    0x2e,
+    0x9e,
+    0xda,
+    0x1f,
+    0x7e,
+    0x9f,
+    0x76,
+    0x8b,
+    0xdd,
+    0xe3,
+    0x1b,
+    0xf6,
+    0xdb,
+    0xa2,
+    0xeb,
+    0x9a,
+    0xcd,
+    0xef,
+    0x5d,
+    0x7b,
+    0xda,
+    0xde,
+    0xb5,
+    0xcb,
+    0xd5,
+    0x7c,
+    0xfe,
+    0x86,
+    0xcd,
+    0xba,
+    0xc5,
+    0xfa,
+    0xd9,
+    0x51,
+    0x75,
+    0x72,
+    0xb7,
+    0x68,
+    0xef,
+    0xdf,
+    0xad,
+    0x1e,
+    0xce,
+    0x2b,
+    0xc1,
+    0x04,
+    0x83,
+    0x36,
+    0x41,
+    0x73,
+    0xad,
+    0x98,
+    0x0c,
+    0xda,
+    0x70,
+    0x63,
+    0xaa,
+    0x93,
+    0x6c,
+    0x9f,
+    0xd3,
+    0x87,
+    0x6e,
+    0xb1,
+    0xfc,
+    0xe7,
+    0x31,
+    0x2b,
+    0xc9,
+    0x18,
+    0xe3,
+    0x24,
+    0x3d,
+    0x85,
+    0xc5,
+    0xd9,
+    0xd9,
+    0xbc,
+    0xfd,
+    0x6d,
+    0x8b,
+    0x4f,
+    0x76,
+    0x96,
+    0x74,
+    0x65,
+    0xbb,
+    0xc7,
+    0x35,
+    0x14,
+    0x26,
+    0x65,
+    0x26,
+    0xb3,
+    0xed,
+    0x96,
+    0x28,
+    0xf0,
+    0xe8,
+    0x8b,
+    0x5f,
+    0x2e,
+    0xaf,
+    0x2e,
+    0x3e,
+    0x5e,
+    0xfc,
+    0x42,
+    0x80,
+    0x71,
+    0x48,
+    0x29,
+    0xd8,
+    0xbf,
+    0x48,
+    0xd6,
+    0xd3,
+    0xbf,
+    0x7c,
+    0xf5,
+    0x9e,
+    0xfe,
+    0xfe,
+    0x3d,
+    0x3c,
+    0x50,
+    0xc3,
+    0x83,
+    0x0b,
+    0x17,
+    0xb4,
+    0x1c,
+    0x1f,
+    0xe8,
+    0xe7,
+    0x6f,
+    0xbc,
+    0x19,
+    0x55,
+    0x5d,
+    0xae,
+    0x96,
+    0x4f,
+    0xed,
+    0x66,
+    0x35,
+    0x92,
+    0xca,
+    0x9e,
+    0x54,
+    0xbd,
+    0x53,
+    0x17,
+    0x2a,
+    0xbe,
+    0x42,
+    0xfa,
+    0xeb,
+    0xaf,
+    0x49,
+    0xea,
+    0x49,
+    0x12,
+    0x9b,
+    0x14,
+    0x99,
+    0x14,
+    0x4d,
+    0xce,
+    0xae,
+    0xd9,
+    0x62,
+    0x7e,
+    0x5e,
+    0x7d,
+    0x3b,
+    0x7d,
+    0x6c,
+    0x37,
+    0x9f,
+    0x1e,
+    0x84,
+    0x50,
+    0xe2,
+    0x93,
+    0x4c,
+    0x7a,
+    0x9c,
+    0xc1,
+    0x21,
+    0xd3,
+    0xf9,
+    0x74,
+    0x37,
+    0x4d,
+    0xcf,
+    0x53,
+    0x74,
+    0xe1,
+    0xdf,
+    0xfa,
+    0x9b,
+    0xab,
+    0x4f,
+    0x22,
+    0x81,
+    0x26,
+    0xbd,
+    0x52,
+    0x4d,
+    0x12,
+    0x2d,
+    0xbc,
+    0xb6,
+    0x83,
+    0xf1,
+    0xa7,
+    0x5b,
+    0x44,
+    0x1a,
+    0x29,
+    0x5c,
+    0xb1,
+    0xc7,
+    0xf3,
+    0xca,
+    0x6a,
+    0xcb,
+    0xa3,
+    0x1a,
+    0x22,
+    0xc9,
+    0x28,
+    0xeb,
+    0xb9,
+    0x34,
+    0x7b,
+    0x71,
+    0xa4,
+    0x62,
+    0xe0,
+    0x56,
+    0x95,
+    0x2b,
+    0xd6,
+    0xd3,
+    0xdd,
+    0xcd,
+    0xde,
+    0x15,
+    0x08,
+    0x27,
+    0xb0,
+    0xfd,
+    0xce,
+    0x28,
+    0xcf,
+    0x5d,
+    0x64,
+    0xd1,
+    0x58,
+    0x2e,
+    0x42,
+    0x27,
+    0x8d,
+    0xe2,
+    0x36,
+    0x30,
+    0x31,
+    0x73,
+    0x80,
+    0xaa,
+    0x86,
+    0x3f,
+    0xa5,
+    0xe1,
+    0xc2,
+    0xd7,
+    0x2a,
+    0x72,
+    0x67,
+    0x7b,
+    0x20,
+    0x85,
+    0xe7,
+    0x4a,
+    0x31,
+    0x51,
+    0x7b,
+    0x03,
+    0x76,
+    0xac,
+    0x31,
+    0x8e,
+    0x7b,
+    0x87,
+    0x53,
+    0x09,
+    0x5e,
+    0xac,
+    0x19,
+    0x88,
+    0x08,
+    0x76,
+    0x4d,
+    0x7f,
+    0x23,
+    0xfe,
+    0x1a,
+    0x25,
+    0x02,
+    0xf7,
+    0xe6,
+    0xe9,
+    0xb6,
+    0x51,
+    0x52,
+    0x71,
+    0xa4,
+    0x90,
+    0x33,
+    0x08,
+    0x91,
+    0xd0,
+    0x15,
+    0x94,
+    0x49,
+    0xbc,
+    0xc4,
+    0x11,
+    0x93,
+    0xb8,
+    0x1a,
+    0x97,
+    0x89,
+    0x99,
+    0xf4,
+    0x91,
+    0x8b,
+    0x08,
+    0x41,
+    0x54,
+    0x34,
+    0x5c,
+    0xd7,
+    0x8d,
+    0xc7,
+    0x0d,
+    0xb2,
+    0x07,
+    0x2a,
+    0x08,
+    0xee,
+    0x24,
+    0x04,
+    0x69,
+    0x64,
+    0x54,
+    0xdc,
+    0x23,
+    0x27,
+    0x13,
+    0xb7,
+    0x88,
+    0x27,
+    0x4e,
+    0x71,
+    0xed,
+    0x70,
+    0x5d,
+    0x21,
+    0x4c,
+    0xb0,
+    0x6b,
+    0x74,
+    0x70,
+    0xa4,
+    0x2c,
+    0x71,
+    0x0a,
+    0x10,
+    0xd3,
+    0xd8,
+    0xa7,
+    0x7d,
+    0xdb,
+    0x90,
+    0x1b,
+    0x60,
+    0x95,
+    0x17,
+    0x26,
+    0x92,
+    0xd2,
+    0x6b,
+    0x2e,
+    0xf5,
+    0x60,
+    0x23,
+    0x17,
+    0x78,
+    0x20,
+    0xd9,
+    0x6c,
+    0x44,
+    0xa0,
+    0x93,
+    0x8d,
+    0x92,
+    0x3d,
+    0x6a,
+    0x18,
+    0x52,
+    0xfb,
+    0x1e,
+    0x04,
+    0x8f,
+    0xa4,
+    0x86,
+    0x64,
+    0x60,
+    0xec,
+    0x61,
+    0x22,
+    0xe4,
+    0x02,
+    0x0e,
+    0xa3,
+    0xa5,
+    0x17,
+    0x1b,
+    0x38,
+    0x05,
+    0x2a,
+    0x25,
+    0x00,
+    0xfb,
+    0x78,
+    0xcf,
+    0xa3,
+    0xcd,
+    0xca,
+    0x23,
+    0x67,
+    0x60,
+    0xe6,
+    0xcf,
+    0xdb,
+    0x27,
+    0x3a,
+    0x32,
+    0xa7,
+    0x74,
+    0x82,
+    0x07,
+    0x43,
+    0xf6,
+    0x11,
+    0x82,
+    0xeb,
+    0x90,
+    0x1c,
+    0xa5,
+    0x10,
+    0x0b,
+    0x75,
+    0xc0,
+    0x1b,
+    0x12,
+    0x20,
+    0x70,
+    0xa7,
+    0x6b,
+    0xe9,
+    0x40,
+    0x6c,
+    0x98,
+    0xe6,
+    0x06,
+    0xd2,
+    0x69,
+    0x1e,
+    0x1d,
+    0xb3,
+    0xbc,
+    0xf7,
+    0x0c,
+    0xa3,
+    0x03,
+    0x5b,
+    0x4b,
+    0x2d,
+    0xb8,
+    0x30,
+    0x9d,
+    0x12,
+    0x91,
+    0x07,
+    0x18,
+    0x66,
+    0x06,
+    0x9b,
+    0xe2,
+    0x61,
+    0xdd,
+    0x68,
+    0xc9,
+    0x23,
+    0xc9,
+    0x0d,
+    0x36,
+    0xb0,
+    0xae,
+    0x09,
+    0x5c,
+    0xc5,
+    0x5e,
+    0x8b,
+    0x22,
+    0x26,
+    0x6b,
+    0x70,
+    0x99,
+    0x84,
+    0x47,
+    0x3c,
+    0xb7,
+    0xb0,
+    0xbc,
+    0xd6,
+    0xb0,
+    0x0d,
+    0x9e,
+    0xc1,
+    0x54,
+    0x3a,
+    0x50,
+    0x14,
+    0x40,
+    0x02,
+    0x43,
+    0x8e,
+    0x81,
+    0xcd,
+    0x5c,
+    0x47,
+    0x92,
+    0x73,
+    0x15,
+    0x66,
+    0xb0,
+    0xbf,
+    0xaf,
+    0x33,
+    0x2d,
+    0x93,
+    0x30,
+    0x18,
+    0xe2,
+    0x06,
+    0xa4,
+    0x8e,
+    0x6b,
+    0x3b,
+    0x40,
+    0x25,
+    0x10,
+    0x55,
+    0x21,
+    0x39,
+    0xd5,
+    0x81,
+    0x9f,
+    0x2b,
+    0x4e,
+    0xc5,
+    0xdd,
+    0x0a,
+    0x51,
+    0xa8,
+    0x70,
+    0xb7,
+    0x0a,
+    0x16,
+    0xf6,
+    0xe8,
+    0x71,
+    0xd7,
+    0x18,
+    0x69,
+    0xb9,
+    0x92,
+    0x9f,
+    0xf3,
+    0xaa,
+    0x3a,
+    0xe2,
+    0x55,
+    0x65,
+    0xac,
+    0xe2,
+    0x86,
+    0x79,
+    0x8f,
+    0xcb,
+    0x64,
+    0x97,
+    0x4d,
+    0xee,
+    0xd2,
+    0x25,
+    0x26,
+    0x0a,
+    0x6e,
+    0x67,
+    0x02,
+    0x86,
+    0x32,
+    0xd9,
+    0x08,
+    0xc8,
+    0x10,
+    0x58,
+    0xca,
+    0xc2,
+    0x32,
+    0x76,
+    0x08,
+    0xb1,
+    0x01,
+    0x26,
+    0xa2,
+    0x5a,
+    0x8c,
+    0x62,
+    0x5a,
+    0x4d,
+    0x41,
+    0x39,
+    0xc0,
+    0x4c,
+    0x48,
+    0x16,
+    0x48,
+    0xf7,
+    0xb2,
+    0x66,
+    0xcf,
+    0x9d,
+    0x26,
+    0x39,
+    0x1f,
+    0xac,
+    0x94,
+    0x76,
+    0x5c,
+    0xa2,
+    0x68,
+    0x22,
+    0x41,
+    0xb4,
+    0xab,
+    0x75,
+    0xbe,
+    0x42,
+    0x5b,
+    0xc3,
+    0xbd,
+    0xed,
+    0x91,
+    0x42,
+    0x9a,
+    0x69,
+    0xca,
+    0x84,
+    0x72,
+    0x0c,
+    0xbb,
+    0x79,
+    0x6e,
+    0xe2,
+    0x00,
+    0x33,
+    0x59,
+    0xe2,
+    0x93,
+    0x6e,
+    0x7d,
+    0x61,
+    0x04,
+    0x7d,
+    0xcc,
+    0x08,
+    0x16,
+    0xcd,
+    0x4e,
+    0xc2,
+    0xf8,
+    0x1a,
+    0x36,
+    0x0c,
+    0x24,
+    0x48,
+    0x4a,
+    0x51,
+    0xc4,
+    0x17,
+    0x74,
+    0x0e,
+    0x48,
+    0x7b,
+    0xf8,
+    0xdf,
+    0xb3,
+    0x7c,
+    0x75,
+    0x8f,
+    0x52,
+    0x4a,
+    0x86,
+    0x3d,
+    0x41,
+    0x10,
+    0x65,
+    0xb0,
+    0x5c,
+    0x8f,
+    0x94,
+    0x57,
+    0xdc,
+    0xa9,
+    0xe4,
+    0x3f,
+    0xe3,
+    0xe9,
+    0xee,
+    0xa6,
+    0x44,
+    0x23,
+    0x3c,
+    0x8b,
+    0xa0,
+    0x82,
+    0xfe,
+    0x49,
+    0x57,
+    0x40,
+    0x84,
+    0x53,
+    0x0c,
+    0xe3,
+    0xe3,
+    0x1c,
+    0x15,
+    0xc3,
+    0x63,
+    0xa3,
+    0x29,
+    0x2a,
+    0x06,
+    0x98,
+    0xf2,
+    0x8a,
+    0x32,
+    0xaa,
+    0xd8,
+    0x17,
+    0xa5,
+    0x4e,
+    0xe0,
+    0x25,
+    0x17,
+    0x53,
+    0x3a,
+    0x08,
+    0xf0,
+    0x74,
+    0x3d,
+    0x72,
+    0x9a,
+    0x87,
+    0x94,
+    0x12,
+    0x60,
+    0xe0,
+    0x6a,
+    0x05,
+    0xff,
+    0x92,
+    0x7e,
+    0x08,
+    0xaa,
+    0x1a,
+    0x99,
+    0x27,
+    0xbb,
+    0xde,
+    0xd3,
+    0x33,
+    0x12,
+    0x31,
+    0xc0,
+    0x49,
+    0xe4,
+    0x2c,
+    0xd4,
+    0x3b,
+    0x33,
+    0x96,
+    0x0d,
+    0xad,
+    0x1c,
+    0x98,
+    0x8d,
+    0x58,
+    0x22,
+    0x54,
+    0x82,
+    0x25,
+    0x27,
+    0xeb,
+    0x94,
+    0x18,
+    0x35,
+    0x31,
+    0x8a,
+    0x03,
+    0x52,
+    0x50,
+    0xd4,
+    0x92,
+    0x6c,
+    0xd2,
+    0x0a,
+    0x4a,
+    0x06,
+    0x89,
+    0xdc,
+    0x92,
+    0xb1,
+    0xce,
+    0xfa,
+    0x2a,
+    0x1d,
+    0x70,
+    0x75,
+    0x51,
+    0x36,
+    0xfb,
+    0xac,
+    0xce,
+    0xaa,
+    0x2a,
+    0x7c,
+    0x04,
+    0x53,
+    0xa3,
+    0xaa,
+    0x38,
+    0xdd,
+    0x83,
+    0x6c,
+    0x0c,
+    0x2a,
+    0x1c,
+    0x82,
+    0x1b,
+    0x70,
+    0x4e,
+    0xb6,
+    0xad,
+    0x91,
+    0x70,
+    0x8a,
+    0xaa,
+    0x5b,
+    0x4a,
+    0xd6,
+    0x1e,
+    0x45,
+    0xc9,
+    0x95,
+    0xcd,
+    0x81,
+    0x17,
+    0xb9,
+    0x21,
+    0x03,
+    0xc2,
+    0x3d,
+    0x24,
+    0x2b,
+    0x12,
+    0x1b,
+    0x25,
+    0x50,
+    0x42,
+    0x07,
+    0xb7,
+    0x17,
+    0xd8,
+    0x2f,
+    0xe2,
+    0xc1,
+    0x1c,
+    0x89,
+    0x07,
+    0x8d,
+    0x6e,
+    0x4c,
+    0x25,
+    0x03,
+    0x41,
+    0x8b,
+    0x4f,
+    0x07,
+    0x5b,
+    0x79,
+    0x72,
+    0xb9,
+    0x60,
+    0x56,
+    0x72,
+    0xad,
+    0x89,
+    0x95,
+    0xe3,
+    0x02,
+    0xb1,
+    0x88,
+    0x32,
+    0x23,
+    0x34,
+    0x1d,
+    0x0b,
+    0x28,
+    0xca,
+    0xfa,
+    0x53,
+    0x05,
+    0x22,
+    0x2a,
+    0x52,
+    0x1a,
+    0x39,
+    0x41,
+    0x35,
+    0x21,
+    0x67,
+    0x23,
+    0x45,
+    0xbc,
+    0xcd,
+    0x3d,
+    0xa0,
+    0x7f,
+    0x52,
+    0xd2,
+    0xf4,
+    0xd6,
+    0x48,
+    0x91,
+    0x2b,
+    0x49,
+    0x40,
+    0x8e,
+    0xc4,
+    0x8e,
+    0x4a,
+    0x04,
+    0xa8,
+    0x10,
+    0x66,
+    0x92,
+    0x78,
+    0x50,
+    0x96,
+    0x53,
+    0x51,
+    0x44,
+    0x5c,
+    0x51,
+    0xcd,
+    0x8e,
+    0x94,
+    0xae,
+    0x25,
+    0xf9,
+    0x9f,
+    0x5e,
+    0x6d,
+    0x8b,
+    0x98,
+    0x43,
+    0x8c,
+    0x81,
+    0x5b,
+    0x7c,
+    0x38,
+    0xd6,
+    0x22,
+    0x1d,
+    0xc6,
+    0x13,
+    0xd4,
+    0xc1,
+    0x3f,
+    0xd7,
+    0x22,
+    0xad,
+    0x81,
+    0x9a,
+    0x86,
+    0xb2,
+    0x13,
+    0x51,
+    0x12,
+    0xe3,
+    0x8c,
+    0x0a,
+    0x1f,
+    0x55,
+    0x36,
+    0xc4,
+    0x08,
+    0xcb,
+    0x05,
+    0x8e,
+    0xd2,
+    0x0f,
+    0xf1,
+    0x19,
+    0x29,
+    0x24,
+    0xd0,
+    0xc0,
+    0x82,
+    0x1b,
+    0x71,
+    0x8e,
+    0x0d,
+    0x72,
+    0x93,
+    0x11,
+    0x8e,
+    0xf2,
+    0x46,
+    0x42,
+    0x57,
+    0x74,
+    0xcf,
+    0x1e,
+    0x1a,
+    0x85,
+    0x0e,
+    0x85,
+    0x4a,
+    0x3e,
+    0x94,
+    0x80,
+    0x54,
+    0x2e,
+    0xf2,
+    0xb1,
+    0x66,
+    0xfb,
+    0x44,
+    0x88,
+    0x11,
+    0x20,
+    0xe3,
+    0x52,
+    0xe6,
+    0xa1,
+    0xf5,
+    0x48,
+    0xf2,
+    0xb1,
+    0x02,
+    0x73,
+    0x36,
+    0xf0,
+    0x4c,
+    0x71,
+    0x35,
+    0xba,
+    0x7c,
+    0xd6,
+    0x90,
+    0x0c,
+    0x35,
+    0x7a,
+    0xa0,
+    0x43,
+    0x60,
+    0xe4,
+    0xb4,
+    0x28,
+    0x21,
+    0x5a,
+    0x8a,
+    0xeb,
+    0x08,
+    0xc1,
+    0x3d,
+    0x25,
+    0x0d,
+    0xec,
+    0x8d,
+    0xbb,
+    0x53,
+    0x79,
+    0x89,
+    0xb9,
+    0xa5,
+    0x16,
+    0xac,
+    0x8c,
+    0x4c,
+    0x6d,
+    0xaf,
+    0x70,
+    0x45,
+    0x2f,
+    0x81,
+    0x3f,
+    0x7c,
+    0x39,
+    0xd7,
+    0xec,
+    0x19,
+    0x99,
+    0xce,
+    0x3e,
+    0xa4,
+    0x1c,
+    0x44,
+    0xe0,
+    0xa0,
+    0x4b,
+    0xe4,
+    0x64,
+    0xee,
+    0x79,
+    0x22,
+    0x25,
+    0xfb,
+    0xb6,
+    0x76,
+    0x2c,
+    0x30,
+    0x8f,
+    0xf5,
+    0x60,
+    0xeb,
+    0xa9,
+    0x30,
+    0x45,
+    0xea,
+    0x6c,
+    0x48,
+    0x49,
+    0x33,
+    0xfb,
+    0x83,
+    0x62,
+    0x24,
+    0xb5,
+    0xa8,
+    0x68,
+    0xa6,
+    0x73,
+    0xb0,
+    0xce,
+    0x4a,
+    0x15,
+    0x54,
+    0x88,
+    0x90,
+    0xb7,
+    0xd9,
+    0x8e,
+    0x4d,
+    0xbe,
+    0xab,
+    0x68,
+    0xda,
+    0xec,
+    0x53,
+    0xa9,
+    0x3f,
+    0x6e,
+    0xa2,
+    0xbe,
+    0x7f,
+    0xe7,
+    0x12,
+    0xd3,
+    0xbb,
+    0x15,
+    0x7e,
+    0x1b,
+    0x7c,
+    0x8a,
+    0xfe,
+    0x2b,
+    0x07,
+    0x9f,
+    0x5a,
+    0x4b,
+    0x0d,
+    0x57,
+    0xe4,
+    0xe3,
+    0xd4,
+    0x5d,
+    0x03,
+    0x75,
+    0xb3,
+    0x1e,
+    0x16,
+    0x32,
+    0x51,
+    0x97,
+    0x4a,
+    0x98,
+    0x72,
+    0xb0,
+    0x1c,
+    0xd3,
+    0xec,
+    0xb5,
+    0x4f,
+    0x46,
+    0xe9,
+    0x41,
+    0xd7,
+    0xc9,
+    0x1c,
+    0x6e,
+    0x89,
+    0xcd,
+    0x18,
+    0x6e,
+    0x23,
+    0x57,
+    0x33,
+    0x98,
+    0x7c,
+    0xd5,
+    0x3d,
+    0x5e,
+    0xaf,
+    0x96,
+    0x47,
+    0x7b,
+    0xe4,
+    0x7a,
+    0xb5,
+    0x58,
+    0xee,
+    0x80,
+    0x9c,
+    0xf6,
+    0x8e,
+    0x8a,
+    0x6b,
+    0x29,
+    0x09,
+    0xcc,
+    0x59,
+    0x60,
+    0x15,
+    0x5e,
+    0x62,
+    0x11,
+    0x24,
+    0x8d,
+    0x18,
+    0xc0,
+    0x88,
+    0x60,
+    0x37,
+    0xe2,
+    0xe0,
+    0x30,
+    0xd2,
+    0xd9,
+    0x81,
+    0xde,
+    0x0b,
+    0x9f,
+    0xe6,
+    0xa6,
+    0x43,
+    0x9c,
+    0x1b,
+    0x31,
+    0xc8,
+    0x01,
+    0xfd,
+    0x01,
+    0xc2,
+    0x6c,
+    0xe0,
+    0xa9,
+    0xc2,
+    0x00,
+    0x7a,
+    0x1a,
+    0x66,
+    0x06,
+    0x6c,
+    0x11,
+    0xdb,
+    0xc8,
+    0xae,
+    0x9e,
+    0xba,
+    0x88,
+    0x5a,
+    0xe0,
+    0x11,
+    0x25,
+    0xf5,
+    0x2b,
+    0x4a,
+    0x7a,
+    0x89,
+    0xb2,
+    0x12,
+    0xfd,
+    0x28,
+    0x94,
+    0x06,
+    0xce,
+    0x5d,
+    0xfe,
+    0x39,
+    0x2e,
+    0x4a,
+    0x01,
+    0x53,
+    0x61,
+    0x1c,
+    0xb1,
+    0xf3,
+    0x22,
+    0x0d,
+    0xc1,
+    0x3d,
+    0x7d,
+    0x08,
+    0x79,
+    0x02,
+    0x3b,
+    0xc0,
+    0x45,
+    0x32,
+    0xef,
+    0x70,
+    0x2c,
+    0xe4,
+    0x21,
+    0xec,
+    0xd5,
+    0x02,
+    0xc6,
+    0x9c,
+    0xa4,
+    0x47,
+    0x6c,
+    0x44,
+    0x6a,
+    0x0e,
+    0x3d,
+    0x79,
+    0x11,
+    0xf6,
+    0x75,
+    0x35,
+    0xcd,
+    0x6b,
+    0x6a,
+    0xc6,
+    0xe8,
+    0x93,
+    0x6f,
+    0x8a,
+    0x58,
+    0xc1,
+    0xa1,
+    0xda,
+    0x08,
+    0xf5,
+    0x12,
+    0x1b,
+    0x54,
+    0x2f,
+    0x24,
+    0x44,
+    0xa0,
+    0xb9,
+    0x90,
+    0x04,
+    0x39,
+    0xc4,
+    0x98,
+    0x1b,
+    0x50,
+    0x56,
+    0x41,
+    0x8f,
+    0xac,
+    0x24,
+    0xb3,
+    0x1d,
+    0x62,
+    0x01,
+    0xf3,
+    0x38,
+    0x37,
+    0xd2,
+    0x1f,
+    0xe0,
+    0x3c,
+    0x49,
+    0x83,
+    0xdc,
+    0x50,
+    0x8f,
+    0x3a,
+    0x84,
+    0xbd,
+    0x9a,
+    0x45,
+    0xd8,
+    0x03,
+    0x35,
+    0xfb,
+    0x2a,
+    0x61,
+    0x8f,
+    0x54,
+    0x89,
+    0x68,
+    0x68,
+    0xaa,
+    0xb6,
+    0xff,
+    0xaf,
+    0xd4,
+    0xff,
+    0xe3,
+    0x4a,
+    0xbd,
+    0x17,
+    0x6a,
+    0xee,
+    0x95,
+    0x50,
+    0xc3,
+    0x48,
+    0x86,
+    0x51,
+    0xc6,
+    0x84,
+    0xde,
+    0x7d,
+    0xd1,
+    0xaa,
+    0xb4,
+    0xa9,
+    0x1c,
+    0xc0,
+    0x88,
+    0x39,
+    0x0e,
+    0xd3,
+    0x62,
+    0xf4,
+    0x8e,
+    0xf8,
+    0x1e,
+    0xc2,
+    0x3e,
+    0x2e,
+    0x11,
+    0x09,
+    0xa9,
+    0xac,
+    0x1d,
+    0xe2,
+    0x42,
+    0x3e,
+    0xf0,
+    0x2a,
+    0xf8,
+    0xf8,
+    0x70,
+    0xa0,
+    0xd2,
+    0x70,
+    0x10,
+    0x42,
+    0x5a,
+    0x21,
+    0xc7,
+    0x9f,
+    0x5f,
+    0x3c,
+    0x46,
+    0x12,
+    0x27,
+    0xc7,
+    0x89,
+    0xc0,
+    0xa1,
+    0x86,
+    0x60,
+    0x89,
+    0x7e,
+    0xae,
+    0xe9,
+    0x78,
+    0x8b,
+    0x1e,
+    0x55,
+    0x8c,
+    0x0e,
+    0xa3,
+    0x1d,
+    0x46,
+    0x30,
+    0xda,
+    0x5c,
+    0x50,
+    0x03,
+    0xa0,
+    0x12,
+    0xc2,
+    0x2d,
+    0x0c,
+    0xd0,
+    0xc0,
+    0x86,
+    0x64,
+    0x50,
+    0x58,
+    0xd4,
+    0xd2,
+    0x82,
+    0x0d,
+    0x95,
+    0xec,
+    0x88,
+    0xb0,
+    0xb7,
+    0xe5,
+    0x8c,
+    0x4f,
+    0xb4,
+    0xb4,
+    0xa7,
+    0x62,
+    0x62,
+    0x1c,
+    0x20,
+    0x46,
+    0x39,
+    0x3f,
+    0xd0,
+    0xd2,
+    0x9e,
+    0x83,
+    0xa1,
+    0xb1,
+    0x87,
+    0xb4,
+    0x7f,
+    0xe6,
+    0x1a,
+    0x98,
+    0x68,
+    0x05,
+    0x2a,
+    0x7e,
+    0x1c,
+    0x85,
+    0x90,
+    0x34,
+    0x7e,
+    0xdb,
+    0xda,
+    0x22,
+    0xee,
+    0x68,
+    0xad,
+    0x57,
+    0xa8,
+    0x24,
+    0x51,
+    0x0f,
+    0x50,
+    0x23,
+    0xc3,
+    0x68,
+    0x32,
+    0xc5,
+    0x5c,
+    0x2b,
+    0x13,
+    0xf4,
+    0x34,
+    0x9b,
+    0x16,
+    0x44,
+    0x21,
+    0x8c,
+    0xea,
+    0xd9,
+    0xd3,
+    0x5a,
+    0x84,
+    0x95,
+    0x1c,
+    0x5e,
+    0x3d,
+    0xe2,
+    0xfa,
+    0x67,
+    0x7d,
+    0xfa,
+    0x99,
+    0x5d,
+    0xe0,
+    0x86,
+    0xd8,
+    0xbf,
+    0x88,
+    0x0d,
+    0x15,
+    0x79,
+    0xf1,
+    0x0c,
+    0x18,
+    0x30,
+    0xc4,
+    0x62,
+    0x15,
+    0x3d,
+    0x8a,
+    0xa6,
+    0xf6,
+    0x87,
+    0x50,
+    0x63,
+    0xab,
+    0xc7,
+    0x8e,
+    0x1f,
+    0x63,
+    0x50,
+    0xcf,
+    0xbe,
+    0xab,
+    0x88,
+    0xc1,
+    0x7f,
+    0x24,
+    0x3b,
+    0x84,
+    0x88,
+    0x00,
+    0x61,
+    0x13,
+    0x03,
+    0xaa,
+    0xc8,
+    0x2f,
+    0x70,
+    0x6f,
+    0x9f,
+    0x2c,
+    0x5b,
+    0x41,
+    0x9f,
+    0xdd,
+    0x13,
+    0x75,
+    0xd9,
+    0xfe,
+    0x05,
+    0x2d,
+    0x07,
+    0xb4,
+    0x30,
+    0x63,
+    0x8a,
+    0x15,
+    0xba,
+    0x43,
+    0x25,
+    0x13,
+    0x98,
+    0x88,
+    0x67,
+    0x98,
+    0xf1,
+    0x2d,
+    0xa5,
+    0xa1,
+    0xc9,
+    0xe6,
+    0x17,
+    0x34,
+    0xbb,
+    0xe6,
+    0xef,
+    0xc8,
+    0x2b,
+    0x4f,
+    0xe9,
+    0xa7,
+    0xd3,
+    0x8e,
+    0xde,
+    0xd0,
+    0x1c,
+    0x4e,
+    0x67,
+    0xd4,
+    0xbb,
+    0x07,
+    0x02,
+    0x89,
+    0xd5,
+    0xbf,
+    0xdc,
+    0x44,
+    0x73,
+    0x31,
+    0x86,
+    0x9a,
+    0x40,
+    0x3f,
+    0x8c,
+    0xd0,
+    0x16,
+    0x6f,
+    0xb0,
+    0x70,
+    0x61,
+    0xf1,
+    0x77,
+    0x98,
+    0xbe,
+    0x51,
+    0x99,
+    0x68,
+    0xc9,
+    0xc7,
+    0xe4,
+    0x9b,
+    0x46,
+    0x04,
+    0xf2,
+    0xbc,
+    0x4c,
+    0xbb,
+    0xb9,
+    0x31,
+    0x3d,
+    0xa0,
+    0x25,
+    0x47,
+    0x51,
+    0x55,
+    0x6a,
+    0xb0,
+    0xa4,
+    0xc7,
+    0xb4,
+    0x1d,
+    0x53,
+    0x74,
+    0x34,
+    0x54,
+    0xbb,
+    0x80,
+    0xbc,
+    0xa1,
+    0x2c,
+    0x6b,
+    0x68,
+    0x41,
+    0x82,
+    0x8b,
+    0x69,
+    0xc7,
+    0xa0,
+    0x82,
+    0x48,
+    0x31,
+    0xc1,
+    0xac,
+    0xa3,
+    0x9e,
+    0x42,
+    0xaf,
+    0x69,
+    0xdf,
+    0x83,
+    0x22,
+    0x12,
+    0xbe,
+    0x50,
+    0xc8,
+    0xd1,
+    0x04,
+    0x9f,
+    0x56,
+    0x33,
+    0x09,
+    0xf5,
+    0x68,
+    0x3e,
+    0x92,
+    0x96,
+    0xf6,
+    0x75,
+    0xd4,
+    0x78,
+    0xa5,
+    0xbb,
+    0xbc,
+    0xce,
+    0x95,
+    0x8d,
+    0x99,
+    0x06,
+    0x6e,
+    0xfd,
+    0x74,
+    0x5b,
+    0xc4,
+    0x4f,
+    0x95,
+    0x48,
+    0xb9,
+    0x0e,
+    0xa5,
+    0x45,
+    0xd0,
+    0x8f,
+    0x0a,
+    0xc4,
+    0x96,
+    0x8a,
+    0x21,
+    0xed,
+    0x34,
+    0xd4,
+    0x2c,
+    0xb8,
+    0x2f,
+    0x5f,
+    0x51,
+    0xd2,
+    0x68,
+    0xb4,
+    0xc7,
+    0x8a,
+    0x9b,
+    0xea,
+    0x9e,
+    0xa2,
+    0x49,
+    0xbf,
+    0xce,
+    0x02,
+    0x35,
+    0x99,
+    0x22,
+    0x81,
+    0xae,
+    0x29,
+    0x37,
+    0x91,
+    0xa9,
+    0xb0,
+    0xa0,
+    0x48,
+    0x97,
+    0x2b,
+    0xd1,
+    0xd9,
+    0xe4,
+    0xfa,
+    0xed,
+    0xc9,
+    0x19,
+    0xfd,
+    0xc4,
+    0xfa,
+    0xf6,
+    0xe4,
+    0x3f,
+    0xc1,
+    0xd7,
+    0xa7,
+    0xa1,
+    0x36,
+    0x16,
+    0x00,
+    0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__favicon_ico_gz = 15;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__favicon_ico_gz[] FSDATA_ALIGN_POST = {
+    /* /favicon.ico (13 chars) */
+    0x2f,
+    0x66,
+    0x61,
+    0x76,
+    0x69,
+    0x63,
+    0x6f,
+    0x6e,
+    0x2e,
+    0x69,
+    0x63,
+    0x6f,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 341\r\n" (21 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x33,
+    0x34,
+    0x31,
+    0x0d,
+    0x0a,
+    /* "ETag: \"b11ac9211b1b4c83-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x62,
+    0x31,
+    0x31,
+    0x61,
+    0x63,
+    0x39,
+    0x32,
+    0x31,
+    0x31,
+    0x62,
+    0x31,
+    0x62,
+    0x34,
+    0x63,
+    0x38,
+    0x33,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/x-icon\r\n\r\n" (30 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x69,
+    0x6d,
+    0x61,
+    0x67,
+    0x65,
+    0x2f,
+    0x78,
+    0x2d,
+    0x69,
+    0x63,
+    0x6f,
+    0x6e,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (341 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0xad,
+    0xd4,
+    0xb9,
+    0x4b,
+    0x03,
+    0x41,
+    0x18,
+    0xc6,
+    0xe1,
+    0x59,
+    0x22,
+    0x22,
+    0xd8,
+    0x44,
+    0x85,
+    0x80,
+    0x78,
+    0xa5,
+    0xf1,
+    0x00,
+    0x0f,
+    0x30,
+    0xbd,
+    0xa5,
+    0x69,
+    0xac,
+    0x44,
+    0xb4,
+    0xb1,
+    0x16,
+    0x04,
+    0x6b,
+    0xb1,
+    0x12,
+    0x6c,
+    0xed,
+    0x2c,
+    0x05,
+    0x7b,
+    0xed,
+    0xec,
+    0x45,
+    0x21,
+    0xff,
+    0x40,
+    0x10,
+    0x0f,
+    0xb0,
+    0x08,
+    0x2a,
+    0x5a,
+    0x88,
+    0x22,
+    0x48,
+    0x54,
+    0xc4,
+    0x23,
+    0x1e,
+    0xe3,
+    0x6f,
+    0xdc,
+    0x77,
+    0x71,
+    0x58,
+    0x74,
+    0x59,
+    0xd0,
+    0x09,
+    0x4f,
+    0xf8,
+    0xf6,
+    0x9b,
+    0x7d,
+    0x33,
+    0x24,
+    0x99,
+    0x59,
+    0x63,
+    0x02,
+    0x5e,
+    0xd9,
+    0xac,
+    0xe1,
+    0x3d,
+    0x6f,
+    0x66,
+    0xeb,
+    0x8c,
+    0xc9,
+    0x19,
+    0x63,
+    0xfa,
+    0x40,
+    0x8b,
+    0x4e,
+    0xd8,
+    0xff,
+    0x1a,
+    0xcc,
+    0xb5,
+    0x34,
+    0x86,
+    0xfe,
+    0x6b,
+    0xf4,
+    0x14,
+    0x2f,
+    0x33,
+    0xe8,
+    0x45,
+    0x01,
+    0x03,
+    0xa8,
+    0x87,
+    0xeb,
+    0x37,
+    0x63,
+    0x18,
+    0x83,
+    0x68,
+    0x50,
+    0xaf,
+    0x49,
+    0xbd,
+    0x82,
+    0x32,
+    0x19,
+    0xf5,
+    0x4a,
+    0x78,
+    0xc0,
+    0x21,
+    0x3a,
+    0x74,
+    0xef,
+    0x3c,
+    0xee,
+    0x71,
+    0x81,
+    0x11,
+    0xf5,
+    0xc6,
+    0x71,
+    0xa3,
+    0x7e,
+    0x49,
+    0x59,
+    0xb7,
+    0x4e,
+    0x19,
+    0x16,
+    0x67,
+    0xe8,
+    0xd4,
+    0x7a,
+    0xdb,
+    0xea,
+    0x39,
+    0x8b,
+    0xca,
+    0x4f,
+    0xe1,
+    0x5d,
+    0xbd,
+    0xb2,
+    0xb2,
+    0xf1,
+    0x7c,
+    0x3b,
+    0x86,
+    0x70,
+    0xed,
+    0xe5,
+    0x77,
+    0xf4,
+    0xbd,
+    0xd2,
+    0xe4,
+    0xdb,
+    0x30,
+    0xe7,
+    0x65,
+    0xad,
+    0x3e,
+    0xab,
+    0x1f,
+    0x13,
+    0x29,
+    0xf2,
+    0xdd,
+    0xd8,
+    0xd4,
+    0xf5,
+    0xab,
+    0xb8,
+    0x7a,
+    0x26,
+    0x45,
+    0xfe,
+    0x14,
+    0x45,
+    0x9c,
+    0xeb,
+    0xfa,
+    0x00,
+    0xbb,
+    0xaa,
+    0x37,
+    0x30,
+    0x8d,
+    0xb7,
+    0x84,
+    0xfc,
+    0xb1,
+    0x7e,
+    0xab,
+    0x68,
+    0xcd,
+    0x15,
+    0x2c,
+    0xab,
+    0xae,
+    0x60,
+    0xc1,
+    0x9b,
+    0xfb,
+    0x29,
+    0xef,
+    0xd6,
+    0xdd,
+    0x52,
+    0xfd,
+    0x8c,
+    0x31,
+    0x8c,
+    0xe2,
+    0x09,
+    0x8f,
+    0x58,
+    0xc7,
+    0x4b,
+    0x42,
+    0xfe,
+    0x16,
+    0x57,
+    0xaa,
+    0x8f,
+    0xd0,
+    0x8a,
+    0x9c,
+    0xf6,
+    0x85,
+    0xeb,
+    0x9d,
+    0xa0,
+    0x96,
+    0x90,
+    0xff,
+    0x10,
+    0x57,
+    0xaf,
+    0x21,
+    0x90,
+    0x55,
+    0x6f,
+    0xde,
+    0x26,
+    0xe4,
+    0x23,
+    0x35,
+    0xfd,
+    0xd7,
+    0x46,
+    0x26,
+    0xbd,
+    0x75,
+    0xe3,
+    0xf9,
+    0x68,
+    0xff,
+    0xba,
+    0x3d,
+    0x59,
+    0xc5,
+    0x1d,
+    0xf6,
+    0xd0,
+    0xe5,
+    0xe5,
+    0x5d,
+    0xbd,
+    0xaf,
+    0xb9,
+    0x6a,
+    0x6c,
+    0xff,
+    0xfa,
+    0xe7,
+    0x27,
+    0x7e,
+    0x36,
+    0xa2,
+    0xfc,
+    0xaf,
+    0xf7,
+    0xfc,
+    0xf5,
+    0xfc,
+    0x5a,
+    0xcb,
+    0x63,
+    0x21,
+    0x1f,
+    0x8a,
+    0x1e,
+    0x13,
+    0x49,
+    0x23,
+    0x58,
+    0xfa,
+    0xe6,
+    0xb2,
+    0x9f,
+    0x2d,
+    0x88,
+    0xff,
+    0xb4,
+    0x7e,
+    0x04,
+    0x00,
+    0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__index_css_gz = 16;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__index_css_gz[] FSDATA_ALIGN_POST = {
+    /* /index.css (11 chars) */
+    0x2f,
+    0x69,
+    0x6e,
+    0x64,
+    0x65,
+    0x78,
+    0x2e,
+    0x63,
+    0x73,
+    0x73,
+    0x00,
+    0x00,
+
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 869\r\n" (21 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x38,
+    0x36,
+    0x39,
+    0x0d,
+    0x0a,
+    /* "ETag: \"65f1feb59a68ba6e-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x36,
+    0x35,
+    0x66,
+    0x31,
+    0x66,
+    0x65,
+    0x62,
+    0x35,
+    0x39,
+    0x61,
+    0x36,
+    0x38,
+    0x62,
+    0x61,
+    0x36,
+    0x65,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: text/css\r\n\r\n" (26 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x74,
+    0x65,
+    0x78,
+    0x74,
+    0x2f,
+    0x63,
+    0x73,
+    0x73,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (869 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0xa5,
+    0x56,
+    0xc9,
+    0x6e,
+    0xdb,
+    0x30,
+    0x10,
+    0x3d,
+    0xc7,
+    0x5f,
+    0x41,
+    0x20,
+    0x08,
+    0xd0,
+    0x02,
+    0x91,
+    0x21,
+    0x29,
+    0xb1,
+    0x93,
+    0x2a,
+    0x40,
+    0x0e,
+    0xfd,
+    0x80,
+    0x1e,
+    0xda,
+    0x63,
+    0x90,
+    0x03,
+    0x25,
+    0xd1,
+    0x12,
+    0x51,
+    0x4a,
+    0x14,
+    0x48,
+    0x7a,
+    0x6b,
+    0xd1,
+    0x7f,
+    0xef,
+    0x70,
+    0x11,
+    0x4d,
+    0x2d,
+    0x56,
+    0x0a,
+    0x14,
+    0x86,
+    0x6d,
+    0x90,
+    0xe2,
+    0x6c,
+    0x6f,
+    0xde,
+    0x3c,
+    0x2a,
+    0xe7,
+    0xe5,
+    0x19,
+    0xfd,
+    0x5e,
+    0xdd,
+    0xe4,
+    0xb8,
+    0xf8,
+    0x59,
+    0x09,
+    0xbe,
+    0x6f,
+    0xcb,
+    0x0c,
+    0xe5,
+    0x0c,
+    0x16,
+    0x2f,
+    0xab,
+    0x9b,
+    0x82,
+    0x33,
+    0x2e,
+    0x32,
+    0x74,
+    0xac,
+    0xa9,
+    0x22,
+    0xb0,
+    0xdc,
+    0xf1,
+    0x56,
+    0x45,
+    0x3b,
+    0xdc,
+    0x50,
+    0x76,
+    0xce,
+    0xd0,
+    0x37,
+    0xda,
+    0xe4,
+    0x7b,
+    0x89,
+    0x7e,
+    0xe0,
+    0x56,
+    0xde,
+    0xa3,
+    0x9a,
+    0xb0,
+    0x03,
+    0x51,
+    0xb4,
+    0xc0,
+    0xf7,
+    0x48,
+    0xc2,
+    0x46,
+    0x24,
+    0x89,
+    0xa0,
+    0x3b,
+    0xb0,
+    0x68,
+    0xb0,
+    0xa8,
+    0x68,
+    0x9b,
+    0xa1,
+    0xb8,
+    0xb7,
+    0x96,
+    0xf4,
+    0x17,
+    0xc9,
+    0x50,
+    0xf2,
+    0xd8,
+    0xa9,
+    0x97,
+    0xd5,
+    0x9f,
+    0x95,
+    0x6c,
+    0x30,
+    0x63,
+    0x3a,
+    0x78,
+    0xf8,
+    0x2c,
+    0xb6,
+    0xcf,
+    0xd6,
+    0x35,
+    0xc1,
+    0x25,
+    0x11,
+    0xfa,
+    0x69,
+    0x83,
+    0x4f,
+    0xd1,
+    0x91,
+    0x96,
+    0xaa,
+    0xd6,
+    0x4f,
+    0xd3,
+    0xc7,
+    0xee,
+    0x14,
+    0x7a,
+    0x46,
+    0x78,
+    0xaf,
+    0xb8,
+    0xdf,
+    0x88,
+    0x14,
+    0xef,
+    0x32,
+    0x94,
+    0x92,
+    0x06,
+    0x76,
+    0x72,
+    0x2e,
+    0xc0,
+    0x41,
+    0x94,
+    0x73,
+    0xa5,
+    0x78,
+    0x03,
+    0xa6,
+    0xeb,
+    0x4d,
+    0xa7,
+    0x90,
+    0xe4,
+    0x8c,
+    0x96,
+    0xa8,
+    0x12,
+    0xf8,
+    0xac,
+    0x83,
+    0xd4,
+    0x89,
+    0xf6,
+    0x5f,
+    0x52,
+    0xd9,
+    0x31,
+    0x0c,
+    0x35,
+    0xd1,
+    0x96,
+    0xd1,
+    0x96,
+    0xb8,
+    0x07,
+    0xaf,
+    0x48,
+    0x76,
+    0xb8,
+    0x1d,
+    0x65,
+    0x97,
+    0x9a,
+    0xec,
+    0xec,
+    0xce,
+    0x91,
+    0xd0,
+    0xaa,
+    0x56,
+    0x80,
+    0x16,
+    0x67,
+    0x10,
+    0xe7,
+    0x02,
+    0x57,
+    0x8f,
+    0x5e,
+    0x88,
+    0x68,
+    0x0f,
+    0x61,
+    0x87,
+    0xcb,
+    0x92,
+    0xb6,
+    0x55,
+    0x86,
+    0x74,
+    0x2e,
+    0xfa,
+    0x1b,
+    0xeb,
+    0x5f,
+    0x1f,
+    0x91,
+    0x36,
+    0x15,
+    0x04,
+    0x44,
+    0x28,
+    0x2c,
+    0x26,
+    0xda,
+    0x04,
+    0x05,
+    0xfb,
+    0x6a,
+    0xec,
+    0x66,
+    0x8f,
+    0xca,
+    0x17,
+    0x07,
+    0x5a,
+    0x8b,
+    0x0f,
+    0x26,
+    0x61,
+    0xc6,
+    0x31,
+    0x24,
+    0x26,
+    0x74,
+    0x7e,
+    0x70,
+    0xea,
+    0x40,
+    0x84,
+    0xee,
+    0x0d,
+    0x8b,
+    0x30,
+    0xa3,
+    0x15,
+    0x60,
+    0x06,
+    0x6e,
+    0xfb,
+    0xc3,
+    0x97,
+    0x22,
+    0x47,
+    0x20,
+    0x44,
+    0x39,
+    0xe3,
+    0xa6,
+    0x8a,
+    0x49,
+    0xa9,
+    0xa3,
+    0x56,
+    0xa6,
+    0x06,
+    0x10,
+    0x5f,
+    0xd7,
+    0x83,
+    0xa9,
+    0x49,
+    0x37,
+    0xd1,
+    0x34,
+    0xfd,
+    0xd2,
+    0xa6,
+    0xc4,
+    0x56,
+    0x9b,
+    0x98,
+    0x72,
+    0xc7,
+    0xbd,
+    0x49,
+    0xbb,
+    0x93,
+    0xeb,
+    0x8c,
+    0x12,
+    0xc0,
+    0x9f,
+    0x0e,
+    0x0b,
+    0xd2,
+    0xaa,
+    0x61,
+    0x8e,
+    0x59,
+    0xcb,
+    0xd5,
+    0xa7,
+    0x37,
+    0xc8,
+    0x12,
+    0xe7,
+    0x8c,
+    0x94,
+    0xef,
+    0x9f,
+    0x75,
+    0xce,
+    0xc5,
+    0x5e,
+    0x48,
+    0x8d,
+    0x78,
+    0xc7,
+    0x69,
+    0xab,
+    0x74,
+    0x0b,
+    0x96,
+    0x0c,
+    0xb2,
+    0x9a,
+    0x1f,
+    0x2c,
+    0x9f,
+    0xae,
+    0x06,
+    0x67,
+    0xb4,
+    0x21,
+    0x43,
+    0x27,
+    0x6f,
+    0xb8,
+    0x50,
+    0xf4,
+    0x40,
+    0xde,
+    0x17,
+    0xcd,
+    0x6e,
+    0x77,
+    0xcf,
+    0xdb,
+    0x4d,
+    0x92,
+    0x8f,
+    0x2c,
+    0x7d,
+    0x64,
+    0x93,
+    0xa9,
+    0xa5,
+    0x46,
+    0xcf,
+    0xbb,
+    0x75,
+    0x01,
+    0x08,
+    0x62,
+    0x80,
+    0xf9,
+    0x3f,
+    0xf8,
+    0x0d,
+    0x5e,
+    0xa4,
+    0xc2,
+    0x0a,
+    0x66,
+    0x70,
+    0xe8,
+    0xe2,
+    0x21,
+    0x8e,
+    0x43,
+    0x6e,
+    0xa4,
+    0x4f,
+    0x76,
+    0x79,
+    0xb5,
+    0xbf,
+    0x96,
+    0x2b,
+    0x8c,
+    0xec,
+    0x54,
+    0xe8,
+    0xf3,
+    0x15,
+    0x95,
+    0xf4,
+    0x60,
+    0x3d,
+    0xfb,
+    0x0e,
+    0x82,
+    0x23,
+    0xf7,
+    0x37,
+    0xe5,
+    0xa3,
+    0x1f,
+    0xdb,
+    0x81,
+    0xfd,
+    0x2b,
+    0x5a,
+    0xef,
+    0x28,
+    0x23,
+    0x2d,
+    0x6e,
+    0x88,
+    0x1f,
+    0xa4,
+    0x11,
+    0x97,
+    0x74,
+    0x53,
+    0x20,
+    0x87,
+    0x63,
+    0x86,
+    0x6a,
+    0x5a,
+    0x96,
+    0xa4,
+    0xd5,
+    0x99,
+    0xeb,
+    0x61,
+    0x89,
+    0x00,
+    0xc4,
+    0x02,
+    0x08,
+    0xd6,
+    0xf2,
+    0xa3,
+    0xc0,
+    0xc0,
+    0xd7,
+    0x1b,
+    0x45,
+    0x4e,
+    0x2a,
+    0xba,
+    0x9c,
+    0x26,
+    0x8c,
+    0xd1,
+    0x4e,
+    0x52,
+    0x39,
+    0x1b,
+    0xb4,
+    0x13,
+    0xbc,
+    0x12,
+    0x44,
+    0x1a,
+    0x68,
+    0x6a,
+    0x17,
+    0x6f,
+    0x6b,
+    0xd2,
+    0x0e,
+    0x87,
+    0xf2,
+    0xf6,
+    0x21,
+    0xd1,
+    0x9f,
+    0x69,
+    0x31,
+    0xa9,
+    0x3e,
+    0x0a,
+    0x6e,
+    0xbd,
+    0x1b,
+    0x8f,
+    0x46,
+    0xef,
+    0x2c,
+    0x89,
+    0xe3,
+    0xbb,
+    0x0b,
+    0xc6,
+    0xf1,
+    0xd8,
+    0xf1,
+    0x85,
+    0x10,
+    0x33,
+    0xb9,
+    0x11,
+    0x51,
+    0x00,
+    0xbb,
+    0x4d,
+    0x6e,
+    0xa6,
+    0x26,
+    0x37,
+    0x95,
+    0x7a,
+    0xd3,
+    0x72,
+    0x78,
+    0x6c,
+    0x62,
+    0x55,
+    0xc1,
+    0x0f,
+    0xfb,
+    0xd6,
+    0x4c,
+    0x90,
+    0xcf,
+    0x64,
+    0x3b,
+    0x0f,
+    0x3c,
+    0xc3,
+    0x39,
+    0x31,
+    0xda,
+    0x6a,
+    0xba,
+    0x3d,
+    0x3c,
+    0xed,
+    0xb9,
+    0x11,
+    0x0f,
+    0x5c,
+    0xb9,
+    0xe5,
+    0xdc,
+    0x4d,
+    0x60,
+    0x95,
+    0xc8,
+    0xce,
+    0xba,
+    0xa6,
+    0x0a,
+    0xd4,
+    0xec,
+    0x30,
+    0x1a,
+    0x85,
+    0x9d,
+    0xc8,
+    0xc9,
+    0x40,
+    0x47,
+    0x9c,
+    0x66,
+    0x6c,
+    0xe7,
+    0x45,
+    0x54,
+    0xeb,
+    0x08,
+    0x97,
+    0x54,
+    0x51,
+    0x0e,
+    0x70,
+    0x08,
+    0xc2,
+    0xb0,
+    0x1e,
+    0x3d,
+    0x1f,
+    0xfc,
+    0x31,
+    0x08,
+    0x9e,
+    0x26,
+    0xf3,
+    0x45,
+    0xc3,
+    0xaf,
+    0x1d,
+    0xfb,
+    0x82,
+    0x61,
+    0x29,
+    0xad,
+    0x48,
+    0x2c,
+    0x66,
+    0x62,
+    0x2b,
+    0x5e,
+    0x88,
+    0xba,
+    0x99,
+    0x44,
+    0x0d,
+    0x38,
+    0x60,
+    0x96,
+    0x23,
+    0xee,
+    0x44,
+    0x6e,
+    0xbb,
+    0xef,
+    0xd6,
+    0x53,
+    0x7c,
+    0x35,
+    0x55,
+    0x0d,
+    0x97,
+    0xbe,
+    0x01,
+    0xdf,
+    0x8e,
+    0x58,
+    0x34,
+    0xa0,
+    0x9e,
+    0xef,
+    0xb3,
+    0xe9,
+    0x3a,
+    0xe9,
+    0x08,
+    0x38,
+    0xb5,
+    0xe4,
+    0xaa,
+    0xe0,
+    0x20,
+    0x49,
+    0x1f,
+    0xb8,
+    0xfa,
+    0xce,
+    0xcf,
+    0x98,
+    0x7d,
+    0x65,
+    0x7b,
+    0xb2,
+    0x5c,
+    0xfa,
+    0x62,
+    0x7d,
+    0x9a,
+    0xd9,
+    0x5a,
+    0xc4,
+    0x80,
+    0xb4,
+    0x4b,
+    0xb7,
+    0x47,
+    0xa0,
+    0x4b,
+    0x4f,
+    0x4e,
+    0xd9,
+    0xbc,
+    0xd2,
+    0x99,
+    0x09,
+    0x1a,
+    0x4f,
+    0x5e,
+    0x8f,
+    0x96,
+    0xf3,
+    0x6d,
+    0xbb,
+    0xe9,
+    0x44,
+    0xf8,
+    0x73,
+    0x18,
+    0xa8,
+    0xe5,
+    0xee,
+    0xa6,
+    0x4e,
+    0x03,
+    0x7d,
+    0xf5,
+    0x20,
+    0x4d,
+    0xdf,
+    0x36,
+    0x26,
+    0xaf,
+    0x03,
+    0x5e,
+    0xbe,
+    0xad,
+    0x28,
+    0x0f,
+    0x04,
+    0x36,
+    0x76,
+    0x9e,
+    0x83,
+    0x31,
+    0x9a,
+    0x53,
+    0x70,
+    0x5d,
+    0xfc,
+    0x9c,
+    0xc4,
+    0xb9,
+    0xb8,
+    0xcf,
+    0xd7,
+    0x68,
+    0x3e,
+    0x34,
+    0x9f,
+    0x13,
+    0x2b,
+    0xb0,
+    0xfd,
+    0x48,
+    0xad,
+    0xb2,
+    0x50,
+    0x90,
+    0x6d,
+    0xc6,
+    0x03,
+    0xaf,
+    0x1f,
+    0xc8,
+    0xcc,
+    0x3f,
+    0x67,
+    0x2a,
+    0xf8,
+    0x71,
+    0x3d,
+    0x8f,
+    0x42,
+    0x7f,
+    0xeb,
+    0xbb,
+    0x4b,
+    0xc9,
+    0xd2,
+    0xa5,
+    0x60,
+    0x04,
+    0xeb,
+    0x97,
+    0x20,
+    0xae,
+    0xea,
+    0x91,
+    0xb9,
+    0x21,
+    0xea,
+    0xbd,
+    0xdd,
+    0x39,
+    0x60,
+    0xa0,
+    0x5f,
+    0xa0,
+    0xab,
+    0xfd,
+    0xdd,
+    0xf5,
+    0x70,
+    0x37,
+    0xbd,
+    0x92,
+    0xfe,
+    0x02,
+    0x84,
+    0xc7,
+    0x3d,
+    0x48,
+    0xa2,
+    0x0a,
+    0x00,
+    0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__index_html_gz = 17;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__index_html_gz[] FSDATA_ALIGN_POST = {
+    /* /index.html (12 chars) */
+    0x2f,
+    0x69,
+    0x6e,
+    0x64,
+    0x65,
+    0x78,
+    0x2e,
+    0x68,
+    0x74,
+    0x6d,
+    0x6c,
+    0x00,
+
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 732\r\n" (21 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x37,
+    0x33,
+    0x32,
+    0x0d,
+    0x0a,
+    /* "ETag: \"55dd5b995735a2aa-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x35,
+    0x35,
+    0x64,
+    0x64,
+    0x35,
+    0x62,
+    0x39,
+    0x39,
+    0x35,
+    0x37,
+    0x33,
+    0x35,
+    0x61,
+    0x32,
+    0x61,
+    0x61,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: text/html\r\n\r\n" (27 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x74,
+    0x65,
+    0x78,
+    0x74,
+    0x2f,
+    0x68,
+    0x74,
+    0x6d,
+    0x6c,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (732 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0xed,
+    0x56,
+    0xc1,
+    0x6e,
+    0x9c,
+    0x30,
+    0x10,
+    0xbd,
+    0xe7,
+    0x2b,
+    0x2c,
+    0x4b,
+    0xbd,
+    0x15,
+    0x68,
+    0x72,
+    0xaa,
+    0x12,
+    0xe0,
+    0x12,
+    0x29,
+    0xca,
+    0x25,
+    0x55,
+    0xa5,
+    0xa4,
+    0x97,
+    0x5e,
+    0x56,
+    0x5e,
+    0x33,
+    0x80,
+    0x1b,
+    0x63,
+    0xa8,
+    0x6d,
+    0xd8,
+    0xdd,
+    0x7c,
+    0x55,
+    0xbf,
+    0xa1,
+    0x5f,
+    0xd6,
+    0x31,
+    0x66,
+    0xb3,
+    0x2c,
+    0xd9,
+    0x10,
+    0x5a,
+    0xb5,
+    0xb7,
+    0xae,
+    0xb4,
+    0xbb,
+    0x36,
+    0x7e,
+    0xf3,
+    0xfc,
+    0xde,
+    0xcc,
+    0x08,
+    0x3b,
+    0x2e,
+    0x6d,
+    0x25,
+    0xd3,
+    0xb3,
+    0xb8,
+    0x04,
+    0x96,
+    0xa5,
+    0x67,
+    0x04,
+    0x3f,
+    0x71,
+    0x05,
+    0x96,
+    0x91,
+    0xd2,
+    0xda,
+    0x26,
+    0x80,
+    0xef,
+    0xad,
+    0xe8,
+    0x12,
+    0x7a,
+    0x5d,
+    0x2b,
+    0x0b,
+    0xca,
+    0x06,
+    0x0f,
+    0xbb,
+    0x06,
+    0x28,
+    0xe1,
+    0x7e,
+    0x96,
+    0x50,
+    0x0b,
+    0x5b,
+    0x1b,
+    0xb9,
+    0xf0,
+    0x2b,
+    0xc2,
+    0x4b,
+    0xa6,
+    0x0d,
+    0xd8,
+    0xa4,
+    0xb5,
+    0x79,
+    0xf0,
+    0x91,
+    0x8e,
+    0x79,
+    0x14,
+    0xab,
+    0x20,
+    0xa1,
+    0x9d,
+    0x80,
+    0x4d,
+    0x53,
+    0x6b,
+    0x3b,
+    0x8a,
+    0xde,
+    0x88,
+    0xcc,
+    0x96,
+    0x49,
+    0x06,
+    0x9d,
+    0xe0,
+    0x10,
+    0xf4,
+    0x93,
+    0xf7,
+    0x44,
+    0x28,
+    0x61,
+    0x05,
+    0x93,
+    0x81,
+    0xe1,
+    0x4c,
+    0x42,
+    0x72,
+    0x1e,
+    0x7e,
+    0xd8,
+    0x53,
+    0x49,
+    0xa1,
+    0x1e,
+    0x49,
+    0xa9,
+    0x21,
+    0x4f,
+    0xa8,
+    0x50,
+    0x19,
+    0x6c,
+    0x43,
+    0x6e,
+    0x0c,
+    0x25,
+    0x1a,
+    0x64,
+    0x42,
+    0x8d,
+    0xdd,
+    0x49,
+    0x30,
+    0x25,
+    0x00,
+    0x92,
+    0x5b,
+    0x14,
+    0x38,
+    0xe8,
+    0xea,
+    0x01,
+    0xd1,
+    0x38,
+    0xdc,
+    0xa3,
+    0x4b,
+    0x54,
+    0xc1,
+    0x5b,
+    0x4b,
+    0x04,
+    0x0a,
+    0xa1,
+    0x03,
+    0x65,
+    0x94,
+    0xb3,
+    0xce,
+    0xcd,
+    0x43,
+    0xfc,
+    0xd9,
+    0x93,
+    0x88,
+    0x8a,
+    0x15,
+    0x10,
+    0x6d,
+    0x03,
+    0x8f,
+    0x43,
+    0xa2,
+    0x38,
+    0xf2,
+    0x29,
+    0x8a,
+    0xd7,
+    0x75,
+    0xb6,
+    0x1b,
+    0x78,
+    0x33,
+    0xd1,
+    0x11,
+    0x2e,
+    0x99,
+    0x31,
+    0x09,
+    0x75,
+    0x8b,
+    0xa0,
+    0x07,
+    0xbd,
+    0xfd,
+    0x62,
+    0x79,
+    0x9e,
+    0xc6,
+    0xa2,
+    0x2a,
+    0x88,
+    0xd1,
+    0x3c,
+    0xa1,
+    0xc8,
+    0xa2,
+    0x80,
+    0xdb,
+    0xd5,
+    0x5a,
+    0x32,
+    0xfe,
+    0x18,
+    0x9a,
+    0xae,
+    0xa0,
+    0x29,
+    0x12,
+    0x9e,
+    0x8f,
+    0xe0,
+    0x8a,
+    0x75,
+    0x87,
+    0x59,
+    0xff,
+    0xc4,
+    0x34,
+    0x4c,
+    0x11,
+    0xcb,
+    0x74,
+    0x81,
+    0x89,
+    0x45,
+    0x9b,
+    0xcc,
+    0xb6,
+    0x68,
+    0x89,
+    0x71,
+    0x2b,
+    0x3a,
+    0xd4,
+    0xe7,
+    0xff,
+    0x69,
+    0x7a,
+    0xdf,
+    0x3f,
+    0x8f,
+    0x23,
+    0x07,
+    0x1e,
+    0xb1,
+    0x45,
+    0x47,
+    0x74,
+    0xbd,
+    0xd0,
+    0x3e,
+    0x51,
+    0xa8,
+    0x44,
+    0x02,
+    0xd3,
+    0x97,
+    0x64,
+    0x5d,
+    0xdb,
+    0xf2,
+    0xca,
+    0x89,
+    0xc0,
+    0xa5,
+    0xc1,
+    0x8d,
+    0x1f,
+    0x4e,
+    0x9d,
+    0xb9,
+    0x82,
+    0x31,
+    0xa1,
+    0x40,
+    0x4f,
+    0xe8,
+    0x06,
+    0xdf,
+    0x43,
+    0x3d,
+    0xe9,
+    0x50,
+    0xe8,
+    0xd7,
+    0x64,
+    0x1e,
+    0x3b,
+    0x2b,
+    0x2f,
+    0xd2,
+    0x2f,
+    0x58,
+    0x46,
+    0xed,
+    0xba,
+    0xc1,
+    0x58,
+    0xdd,
+    0x22,
+    0xa8,
+    0x56,
+    0x98,
+    0x8f,
+    0x8b,
+    0x09,
+    0xae,
+    0x49,
+    0xef,
+    0x6a,
+    0x0d,
+    0x24,
+    0x07,
+    0x24,
+    0xd5,
+    0x60,
+    0x10,
+    0x5e,
+    0x09,
+    0x85,
+    0x19,
+    0xad,
+    0x1d,
+    0xba,
+    0x99,
+    0x80,
+    0x39,
+    0xca,
+    0x40,
+    0x95,
+    0x87,
+    0x9c,
+    0xb7,
+    0x6e,
+    0x8b,
+    0xd5,
+    0x78,
+    0x8b,
+    0xb0,
+    0x10,
+    0xb9,
+    0xf3,
+    0x3c,
+    0x40,
+    0xcf,
+    0x46,
+    0xf9,
+    0x3a,
+    0x78,
+    0x9f,
+    0x3a,
+    0xdc,
+    0x5b,
+    0x1a,
+    0x2d,
+    0x3f,
+    0x43,
+    0x7c,
+    0xaf,
+    0xe4,
+    0x42,
+    0x4e,
+    0x2d,
+    0x4e,
+    0x49,
+    0x1c,
+    0xc4,
+    0x65,
+    0xe8,
+    0x28,
+    0xe3,
+    0xaf,
+    0x81,
+    0x1b,
+    0x5d,
+    0x17,
+    0x68,
+    0xd7,
+    0x20,
+    0xd8,
+    0x61,
+    0x7d,
+    0xc4,
+    0x92,
+    0x38,
+    0xd0,
+    0xce,
+    0x99,
+    0x39,
+    0xb9,
+    0xc9,
+    0xd4,
+    0xe2,
+    0xc4,
+    0x83,
+    0xaa,
+    0x9f,
+    0x9e,
+    0x4e,
+    0xbb,
+    0x78,
+    0xce,
+    0xa7,
+    0x4f,
+    0xc4,
+    0xca,
+    0x23,
+    0x7d,
+    0x0f,
+    0xbf,
+    0x44,
+    0x4b,
+    0xb6,
+    0x06,
+    0x99,
+    0x7e,
+    0xea,
+    0x31,
+    0xe4,
+    0x01,
+    0x2a,
+    0xd4,
+    0xd4,
+    0x17,
+    0x2f,
+    0x8e,
+    0xfc,
+    0xca,
+    0xcb,
+    0x88,
+    0xbe,
+    0x73,
+    0x83,
+    0x20,
+    0x88,
+    0xf0,
+    0xfb,
+    0xf3,
+    0xc7,
+    0xf5,
+    0xb4,
+    0x95,
+    0xc7,
+    0x5a,
+    0x5f,
+    0x3e,
+    0xf5,
+    0x0c,
+    0x15,
+    0x93,
+    0x92,
+    0x6c,
+    0x98,
+    0x76,
+    0xdd,
+    0x81,
+    0x6f,
+    0x16,
+    0x3f,
+    0xa0,
+    0xfb,
+    0x8e,
+    0xef,
+    0x84,
+    0x11,
+    0x6b,
+    0x21,
+    0x85,
+    0xdd,
+    0x5d,
+    0x92,
+    0x52,
+    0x64,
+    0x19,
+    0x28,
+    0x6c,
+    0x7c,
+    0x04,
+    0x29,
+    0xd7,
+    0x4b,
+    0x6d,
+    0x43,
+    0xc2,
+    0x30,
+    0xc4,
+    0x4d,
+    0x1d,
+    0xc7,
+    0x2c,
+    0x3f,
+    0xaf,
+    0x6b,
+    0xd9,
+    0xf3,
+    0x0f,
+    0x83,
+    0x79,
+    0xfe,
+    0x01,
+    0x44,
+    0xb2,
+    0x7a,
+    0xa3,
+    0x66,
+    0x77,
+    0xf8,
+    0xfd,
+    0x52,
+    0xad,
+    0x21,
+    0x5b,
+    0x52,
+    0x27,
+    0x7c,
+    0x23,
+    0x59,
+    0x84,
+    0xce,
+    0x17,
+    0xea,
+    0xd6,
+    0x83,
+    0xfe,
+    0x57,
+    0xe7,
+    0xaf,
+    0x55,
+    0xa7,
+    0xd1,
+    0x42,
+    0x59,
+    0xe4,
+    0xbe,
+    0x6f,
+    0x60,
+    0x59,
+    0x9d,
+    0x1a,
+    0xad,
+    0x8c,
+    0xc3,
+    0xce,
+    0x17,
+    0xea,
+    0xf3,
+    0x40,
+    0x4b,
+    0x7a,
+    0xde,
+    0xb7,
+    0xeb,
+    0xf5,
+    0xee,
+    0x54,
+    0xa5,
+    0x16,
+    0x4a,
+    0xbf,
+    0x91,
+    0xf5,
+    0x66,
+    0xa1,
+    0xf2,
+    0x1c,
+    0xa1,
+    0xf3,
+    0xc2,
+    0x1d,
+    0x19,
+    0xb9,
+    0xc1,
+    0x73,
+    0xa0,
+    0xd6,
+    0xff,
+    0x46,
+    0xf5,
+    0xd3,
+    0x8a,
+    0x6d,
+    0x85,
+    0x59,
+    0xa2,
+    0xd7,
+    0x23,
+    0xe7,
+    0xe5,
+    0x7e,
+    0x0d,
+    0x6e,
+    0x41,
+    0x14,
+    0xa5,
+    0x7d,
+    0x53,
+    0x6b,
+    0x18,
+    0x04,
+    0xa4,
+    0xaa,
+    0xfe,
+    0x40,
+    0x2f,
+    0x1e,
+    0x05,
+    0x78,
+    0x10,
+    0x28,
+    0x7b,
+    0xc7,
+    0xf0,
+    0x0c,
+    0xc2,
+    0xdb,
+    0xce,
+    0x12,
+    0xe5,
+    0xfb,
+    0x98,
+    0x79,
+    0xed,
+    0x7b,
+    0xc6,
+    0xb7,
+    0xf3,
+    0x3c,
+    0x23,
+    0xfb,
+    0x94,
+    0x8b,
+    0xa3,
+    0xb1,
+    0xe1,
+    0x5a,
+    0x34,
+    0xd6,
+    0xcb,
+    0xf3,
+    0x97,
+    0xb1,
+    0x6f,
+    0xfd,
+    0x89,
+    0xe3,
+    0x9f,
+    0xbb,
+    0x8b,
+    0x92,
+    0xbf,
+    0x21,
+    0xc5,
+    0x91,
+    0xbf,
+    0x5a,
+    0xfe,
+    0x02,
+    0x7f,
+    0x2c,
+    0xe8,
+    0xe5,
+    0x62,
+    0x0a,
+    0x00,
+    0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__index_js_gz = 18;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__index_js_gz[] FSDATA_ALIGN_POST = {
+    /* /index.js (10 chars) */
+    0x2f,
+    0x69,
+    0x6e,
+    0x64,
+    0x65,
+    0x78,
+    0x2e,
+    0x6a,
+    0x73,
+    0x00,
+    0x00,
+    0x00,
+
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 1111\r\n" (22 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x31,
+    0x31,
+    0x31,
+    0x31,
+    0x0d,
+    0x0a,
+    /* "ETag: \"b384c5099a5ae9b4-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x62,
+    0x33,
+    0x38,
+    0x34,
+    0x63,
+    0x35,
+    0x30,
+    0x39,
+    0x39,
+    0x61,
+    0x35,
+    0x61,
+    0x65,
+    0x39,
+    0x62,
+    0x34,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: application/javascript\r\n\r\n" (40 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x61,
+    0x70,
+    0x70,
+    0x6c,
+    0x69,
+    0x63,
+    0x61,
+    0x74,
+    0x69,
+    0x6f,
+    0x6e,
+    0x2f,
+    0x6a,
+    0x61,
+    0x76,
+    0x61,
+    0x73,
+    0x63,
+    0x72,
+    0x69,
+    0x70,
+    0x74,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (1111 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0xbd,
+    0x57,
+    0xeb,
+    0x6e,
+    0xdb,
+    0x36,
+    0x14,
+    0xfe,
+    0x3d,
+    0x3f,
+    0x05,
+    0x2b,
+    0x60,
+    0x85,
+    0x8c,
+    0xc4,
+    0x8e,
+    0xeb,
+    0xb8,
+    0x6d,
+    0x52,
+    0xcf,
+    0x06,
+    0xb2,
+    0xd4,
+    0x59,
+    0xb7,
+    0xb5,
+    0x1b,
+    0xd0,
+    0xe4,
+    0x47,
+    0x01,
+    0xc3,
+    0x10,
+    0x68,
+    0xe9,
+    0x38,
+    0x66,
+    0x4a,
+    0x93,
+    0x1a,
+    0x45,
+    0x39,
+    0x71,
+    0x57,
+    0xbf,
+    0xd3,
+    0x9e,
+    0x61,
+    0x4f,
+    0xd6,
+    0x43,
+    0xdd,
+    0x4c,
+    0xc9,
+    0xd7,
+    0x14,
+    0xd9,
+    0x04,
+    0x24,
+    0x86,
+    0xc4,
+    0xef,
+    0x7c,
+    0xe7,
+    0xf6,
+    0x91,
+    0x3a,
+    0x9a,
+    0x53,
+    0x45,
+    0x22,
+    0x4d,
+    0x75,
+    0x1c,
+    0x79,
+    0x42,
+    0x7e,
+    0xf9,
+    0xc2,
+    0x81,
+    0xf4,
+    0x48,
+    0x20,
+    0xfd,
+    0x78,
+    0x06,
+    0x42,
+    0x37,
+    0xff,
+    0x8a,
+    0x41,
+    0x2d,
+    0xae,
+    0x81,
+    0x83,
+    0xaf,
+    0xa5,
+    0x72,
+    0x9d,
+    0x66,
+    0x0a,
+    0xec,
+    0x0f,
+    0xf5,
+    0x22,
+    0x84,
+    0x5e,
+    0x0a,
+    0x1f,
+    0x39,
+    0xf5,
+    0x6e,
+    0x6d,
+    0xbe,
+    0x22,
+    0x19,
+    0x43,
+    0x70,
+    0x30,
+    0x03,
+    0x62,
+    0x0b,
+    0xf3,
+    0x50,
+    0x31,
+    0xa1,
+    0x99,
+    0xb8,
+    0xbd,
+    0x0e,
+    0xe1,
+    0x11,
+    0x0c,
+    0x25,
+    0xab,
+    0x35,
+    0xae,
+    0x2b,
+    0x2e,
+    0xef,
+    0x1f,
+    0x4d,
+    0x65,
+    0x8c,
+    0x0a,
+    0xa6,
+    0x09,
+    0xe3,
+    0xd4,
+    0x98,
+    0x7e,
+    0xa0,
+    0x1a,
+    0x14,
+    0xa3,
+    0xfc,
+    0x60,
+    0xb6,
+    0xaa,
+    0xa1,
+    0xcd,
+    0x08,
+    0x02,
+    0x97,
+    0xa2,
+    0xad,
+    0x54,
+    0x17,
+    0x9c,
+    0x23,
+    0x5b,
+    0x8e,
+    0x5b,
+    0xe5,
+    0x24,
+    0x6f,
+    0x15,
+    0x44,
+    0xfb,
+    0xcc,
+    0x72,
+    0x58,
+    0x3f,
+    0x60,
+    0xf3,
+    0xc2,
+    0x14,
+    0x94,
+    0x8f,
+    0xf0,
+    0xbd,
+    0xa6,
+    0x19,
+    0xcc,
+    0x98,
+    0xd5,
+    0x6a,
+    0x93,
+    0x58,
+    0xf8,
+    0x9a,
+    0x49,
+    0x41,
+    0x04,
+    0x9d,
+    0x7b,
+    0x3e,
+    0x67,
+    0xfe,
+    0x67,
+    0x17,
+    0xe6,
+    0xb8,
+    0x5c,
+    0xff,
+    0xbb,
+    0x46,
+    0xf0,
+    0xda,
+    0x5a,
+    0x05,
+    0x5f,
+    0x0a,
+    0x8d,
+    0xcf,
+    0x87,
+    0x14,
+    0xad,
+    0xe7,
+    0x46,
+    0x1d,
+    0x4d,
+    0x05,
+    0x33,
+    0x39,
+    0x87,
+    0x0b,
+    0xad,
+    0x15,
+    0x1b,
+    0xc7,
+    0x1a,
+    0x5c,
+    0x27,
+    0x5d,
+    0x32,
+    0x6e,
+    0x76,
+    0x31,
+    0xa1,
+    0xdf,
+    0x7e,
+    0x14,
+    0x52,
+    0x71,
+    0x18,
+    0x53,
+    0x42,
+    0xc5,
+    0x41,
+    0x13,
+    0x53,
+    0x33,
+    0x4c,
+    0x54,
+    0x4f,
+    0x59,
+    0xd4,
+    0xbc,
+    0x05,
+    0x6d,
+    0x81,
+    0x35,
+    0x55,
+    0xf8,
+    0x60,
+    0x9f,
+    0xdb,
+    0x22,
+    0x01,
+    0x43,
+    0xd4,
+    0x73,
+    0x8e,
+    0xcc,
+    0xcf,
+    0x91,
+    0x83,
+    0xde,
+    0x13,
+    0xab,
+    0x66,
+    0x54,
+    0xa2,
+    0xcc,
+    0xfc,
+    0x1f,
+    0x93,
+    0x4a,
+    0x4e,
+    0x89,
+    0xf7,
+    0x7d,
+    0xd0,
+    0xda,
+    0xd2,
+    0xaa,
+    0xb2,
+    0x14,
+    0x5e,
+    0x1c,
+    0x06,
+    0x28,
+    0x16,
+    0x2f,
+    0xd1,
+    0x21,
+    0x28,
+    0xf7,
+    0x61,
+    0xaa,
+    0xb2,
+    0x5a,
+    0xb3,
+    0x09,
+    0x31,
+    0x77,
+    0x99,
+    0xc0,
+    0xc8,
+    0xb3,
+    0x1e,
+    0x69,
+    0xb7,
+    0x5a,
+    0x75,
+    0x92,
+    0x2e,
+    0x9a,
+    0x4b,
+    0x81,
+    0x8e,
+    0x95,
+    0x48,
+    0x5d,
+    0x2f,
+    0x57,
+    0xa5,
+    0x40,
+    0x3a,
+    0x8a,
+    0xa5,
+    0xf8,
+    0xed,
+    0xfa,
+    0xcf,
+    0x3f,
+    0x9a,
+    0x21,
+    0x55,
+    0x11,
+    0x24,
+    0x2c,
+    0xa8,
+    0x8e,
+    0x50,
+    0x8a,
+    0x08,
+    0x6e,
+    0xe0,
+    0x41,
+    0x67,
+    0xe1,
+    0x26,
+    0x75,
+    0x2b,
+    0x36,
+    0x3f,
+    0x5a,
+    0x0d,
+    0x1d,
+    0x0d,
+    0x33,
+    0xd4,
+    0x03,
+    0xfa,
+    0x53,
+    0xe0,
+    0x8c,
+    0xf0,
+    0x56,
+    0x4a,
+    0xde,
+    0x72,
+    0x46,
+    0x29,
+    0xbc,
+    0x74,
+    0x5c,
+    0x54,
+    0xeb,
+    0x67,
+    0x5a,
+    0x86,
+    0xad,
+    0x62,
+    0x42,
+    0x80,
+    0x32,
+    0x2e,
+    0x48,
+    0x2f,
+    0xb1,
+    0xc1,
+    0x7d,
+    0x30,
+    0x6d,
+    0x2a,
+    0x19,
+    0x8b,
+    0xc0,
+    0x4d,
+    0xed,
+    0x86,
+    0xa6,
+    0x0e,
+    0x31,
+    0xe5,
+    0xce,
+    0xa8,
+    0x4e,
+    0x8e,
+    0x88,
+    0x73,
+    0xe2,
+    0xe0,
+    0xff,
+    0x0d,
+    0xa0,
+    0xac,
+    0x69,
+    0x29,
+    0xe8,
+    0xdf,
+    0x7f,
+    0x2e,
+    0x9d,
+    0x55,
+    0xc4,
+    0x72,
+    0x32,
+    0xc1,
+    0x12,
+    0x63,
+    0xc4,
+    0x55,
+    0x2c,
+    0x69,
+    0x90,
+    0xaa,
+    0x8f,
+    0x6e,
+    0x51,
+    0xc8,
+    0xcc,
+    0xaa,
+    0x4f,
+    0xda,
+    0xf5,
+    0x55,
+    0x01,
+    0x77,
+    0x66,
+    0x84,
+    0x3b,
+    0xa9,
+    0x3f,
+    0xbc,
+    0xa7,
+    0x6a,
+    0x86,
+    0x87,
+    0x83,
+    0x51,
+    0x61,
+    0xa4,
+    0x17,
+    0x08,
+    0x9a,
+    0xb3,
+    0x88,
+    0x8d,
+    0x19,
+    0x67,
+    0x7a,
+    0x81,
+    0x11,
+    0x38,
+    0xc9,
+    0x1d,
+    0x87,
+    0x2c,
+    0xba,
+    0x25,
+    0x01,
+    0x1e,
+    0x01,
+    0x79,
+    0x42,
+    0xfe,
+    0x29,
+    0x0b,
+    0x02,
+    0x10,
+    0x39,
+    0x7d,
+    0x35,
+    0x99,
+    0x9f,
+    0x48,
+    0xa3,
+    0x4d,
+    0x9e,
+    0x3f,
+    0x5f,
+    0xcb,
+    0x1a,
+    0xb3,
+    0xec,
+    0x9c,
+    0x3f,
+    0x2a,
+    0x4d,
+    0x1f,
+    0xfb,
+    0xfc,
+    0x5f,
+    0xa6,
+    0xb9,
+    0x87,
+    0xbf,
+    0x92,
+    0x66,
+    0xd1,
+    0xea,
+    0xec,
+    0xa5,
+    0xb2,
+    0x49,
+    0x99,
+    0xb8,
+    0x54,
+    0xd1,
+    0x25,
+    0x3e,
+    0x79,
+    0xbc,
+    0x28,
+    0xd1,
+    0x68,
+    0x8f,
+    0x22,
+    0x13,
+    0xc4,
+    0x16,
+    0x39,
+    0x16,
+    0x52,
+    0x2c,
+    0x81,
+    0x50,
+    0x87,
+    0x25,
+    0xda,
+    0xc3,
+    0x44,
+    0xb8,
+    0x21,
+    0xfc,
+    0xa7,
+    0x53,
+    0xe0,
+    0x77,
+    0x92,
+    0x6f,
+    0xea,
+    0x8b,
+    0xc9,
+    0xc3,
+    0x16,
+    0x60,
+    0xdd,
+    0x28,
+    0xb0,
+    0x5c,
+    0xc7,
+    0x54,
+    0x7f,
+    0x87,
+    0xa7,
+    0xf8,
+    0x24,
+    0xea,
+    0xfb,
+    0x4e,
+    0xf2,
+    0x6d,
+    0xd2,
+    0xcb,
+    0xc7,
+    0x02,
+    0x2f,
+    0xca,
+    0x07,
+    0x93,
+    0x44,
+    0x85,
+    0xc9,
+    0x63,
+    0x0f,
+    0x73,
+    0x37,
+    0x6b,
+    0x91,
+    0x11,
+    0x62,
+    0x19,
+    0x98,
+    0x77,
+    0xbb,
+    0x34,
+    0xa0,
+    0x1c,
+    0x28,
+    0xcb,
+    0x8a,
+    0x4b,
+    0x54,
+    0xda,
+    0x8f,
+    0x8e,
+    0xf5,
+    0x86,
+    0x9b,
+    0xe0,
+    0x80,
+    0xe2,
+    0x4d,
+    0xa8,
+    0xa1,
+    0xd8,
+    0x11,
+    0x8e,
+    0x85,
+    0xaa,
+    0xc6,
+    0x62,
+    0x26,
+    0x9c,
+    0xfd,
+    0xa1,
+    0x90,
+    0x1f,
+    0x6c,
+    0x47,
+    0x6b,
+    0x41,
+    0x64,
+    0xf3,
+    0x8d,
+    0x67,
+    0x4f,
+    0x46,
+    0xdb,
+    0x42,
+    0xc9,
+    0xb1,
+    0xb3,
+    0x0c,
+    0x9b,
+    0x07,
+    0x54,
+    0x1d,
+    0x92,
+    0x0e,
+    0x08,
+    0x6a,
+    0xcd,
+    0x6f,
+    0xb7,
+    0xb6,
+    0xec,
+    0x6e,
+    0x7c,
+    0x8f,
+    0xde,
+    0xc9,
+    0xf1,
+    0xff,
+    0xfd,
+    0x0e,
+    0xf5,
+    0xe5,
+    0x2c,
+    0xc4,
+    0x5f,
+    0x13,
+    0xc7,
+    0xaa,
+    0x1a,
+    0xe9,
+    0x3c,
+    0x96,
+    0x2a,
+    0x04,
+    0xcc,
+    0x80,
+    0xe5,
+    0x05,
+    0x52,
+    0xe0,
+    0xd1,
+    0x45,
+    0xbe,
+    0x7e,
+    0x25,
+    0xad,
+    0xbc,
+    0x31,
+    0x29,
+    0xa8,
+    0x39,
+    0x91,
+    0x6a,
+    0x40,
+    0xfd,
+    0xa9,
+    0x9b,
+    0xa7,
+    0xe3,
+    0x02,
+    0x9f,
+    0x59,
+    0xdb,
+    0x07,
+    0xef,
+    0x32,
+    0xed,
+    0xde,
+    0xb3,
+    0x40,
+    0x4f,
+    0xd1,
+    0xc9,
+    0xca,
+    0xe3,
+    0x51,
+    0xd2,
+    0x9f,
+    0x24,
+    0xfa,
+    0x2c,
+    0xa2,
+    0x7c,
+    0x9e,
+    0x3b,
+    0x84,
+    0xd5,
+    0x2e,
+    0xf1,
+    0x36,
+    0x4e,
+    0xbb,
+    0xf7,
+    0xc9,
+    0x68,
+    0x9a,
+    0xe7,
+    0x68,
+    0xee,
+    0xed,
+    0xd3,
+    0xad,
+    0x18,
+    0x71,
+    0x87,
+    0xad,
+    0x91,
+    0xc5,
+    0xfc,
+    0xac,
+    0x57,
+    0x58,
+    0x5a,
+    0xde,
+    0x0b,
+    0xf0,
+    0xbe,
+    0x30,
+    0x37,
+    0x85,
+    0x9a,
+    0x1b,
+    0x77,
+    0x0b,
+    0x54,
+    0x9e,
+    0xfc,
+    0xb2,
+    0x34,
+    0x5d,
+    0xd1,
+    0x3b,
+    0xfa,
+    0xe0,
+    0xe1,
+    0x99,
+    0xec,
+    0xc6,
+    0x8a,
+    0x1f,
+    0x13,
+    0x9f,
+    0x72,
+    0x3e,
+    0xa6,
+    0xfe,
+    0xe7,
+    0x8c,
+    0xdc,
+    0xa4,
+    0x84,
+    0x4d,
+    0x35,
+    0x83,
+    0x04,
+    0xdc,
+    0x93,
+    0x4f,
+    0x1f,
+    0xde,
+    0xbf,
+    0xd3,
+    0x3a,
+    0xfc,
+    0x08,
+    0xa8,
+    0xc5,
+    0x48,
+    0xbb,
+    0x19,
+    0x9d,
+    0x69,
+    0xba,
+    0x0c,
+    0x41,
+    0xb8,
+    0xce,
+    0x2f,
+    0x83,
+    0x1b,
+    0x1c,
+    0xe2,
+    0x12,
+    0x1e,
+    0xad,
+    0x62,
+    0xb0,
+    0xd6,
+    0x51,
+    0xf2,
+    0x99,
+    0xd5,
+    0x3b,
+    0xa0,
+    0x01,
+    0x4e,
+    0x70,
+    0xce,
+    0x65,
+    0x3a,
+    0x4a,
+    0x36,
+    0x6e,
+    0xf0,
+    0x8b,
+    0x20,
+    0x99,
+    0xfc,
+    0xc2,
+    0x10,
+    0x07,
+    0x69,
+    0x6a,
+    0x42,
+    0x3a,
+    0xb9,
+    0x8b,
+    0xa4,
+    0x70,
+    0x76,
+    0x5a,
+    0x7f,
+    0x6a,
+    0x5c,
+    0x84,
+    0xac,
+    0xf1,
+    0x3b,
+    0x2c,
+    0x8c,
+    0x69,
+    0xfb,
+    0xf5,
+    0x79,
+    0xab,
+    0xdd,
+    0x39,
+    0xef,
+    0x9c,
+    0xbe,
+    0xbc,
+    0xfa,
+    0xb9,
+    0x73,
+    0x79,
+    0x76,
+    0x7a,
+    0x36,
+    0x68,
+    0x9d,
+    0xbd,
+    0x7d,
+    0x3b,
+    0x78,
+    0xf5,
+    0xea,
+    0xb4,
+    0xd3,
+    0x6a,
+    0x0f,
+    0x5e,
+    0x5f,
+    0xd9,
+    0x54,
+    0x52,
+    0x28,
+    0xa4,
+    0x58,
+    0x18,
+    0xa9,
+    0x83,
+    0x3f,
+    0xa5,
+    0xe2,
+    0xd6,
+    0x8c,
+    0x75,
+    0x45,
+    0x55,
+    0xad,
+    0x92,
+    0xe6,
+    0x9b,
+    0x22,
+    0x81,
+    0x5f,
+    0x1b,
+    0xb8,
+    0x69,
+    0x52,
+    0xa7,
+    0x52,
+    0x74,
+    0x7b,
+    0x67,
+    0xac,
+    0xc6,
+    0x0f,
+    0x73,
+    0xe5,
+    0x85,
+    0x4c,
+    0xf6,
+    0x59,
+    0x56,
+    0x77,
+    0x3b,
+    0x23,
+    0x7c,
+    0x6b,
+    0xe2,
+    0x63,
+    0xbb,
+    0x11,
+    0xd9,
+    0xde,
+    0x4c,
+    0x77,
+    0x61,
+    0x1e,
+    0x4a,
+    0xd1,
+    0x1d,
+    0xe7,
+    0x84,
+    0x86,
+    0xec,
+    0x24,
+    0x1b,
+    0x80,
+    0x31,
+    0xeb,
+    0xb5,
+    0xa1,
+    0xb8,
+    0xbe,
+    0x09,
+    0x8f,
+    0x1b,
+    0xbd,
+    0x84,
+    0xc5,
+    0xfb,
+    0xd4,
+    0x2b,
+    0x96,
+    0xf4,
+    0x57,
+    0x63,
+    0x35,
+    0xa7,
+    0xdc,
+    0x2d,
+    0x39,
+    0x3e,
+    0x26,
+    0x2f,
+    0x70,
+    0xf3,
+    0xa3,
+    0xa2,
+    0x77,
+    0x7c,
+    0x0e,
+    0xe5,
+    0x9f,
+    0x1f,
+    0x6f,
+    0x84,
+    0xd4,
+    0xee,
+    0x30,
+    0x60,
+    0x11,
+    0xc5,
+    0x57,
+    0x4f,
+    0x30,
+    0xaa,
+    0xe3,
+    0x79,
+    0xb4,
+    0x43,
+    0xa8,
+    0x46,
+    0xa0,
+    0x34,
+    0x08,
+    0x06,
+    0xe6,
+    0x4b,
+    0xe9,
+    0x3d,
+    0x8b,
+    0xb0,
+    0xfb,
+    0xa6,
+    0x93,
+    0xc9,
+    0xe7,
+    0x13,
+    0xc6,
+    0x58,
+    0x7c,
+    0x4a,
+    0x99,
+    0xf8,
+    0xf0,
+    0xef,
+    0x1b,
+    0x8c,
+    0x57,
+    0x67,
+    0x6e,
+    0x7c,
+    0x0f,
+    0x00,
+    0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__status_filament_svg_gz = 19;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__status_filament_svg_gz[] FSDATA_ALIGN_POST = {
+    /* /status_filament.svg (21 chars) */
+    0x2f,
+    0x73,
+    0x74,
+    0x61,
+    0x74,
+    0x75,
+    0x73,
+    0x5f,
+    0x66,
+    0x69,
+    0x6c,
+    0x61,
+    0x6d,
+    0x65,
+    0x6e,
+    0x74,
+    0x2e,
+    0x73,
+    0x76,
+    0x67,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 481\r\n" (21 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x34,
+    0x38,
+    0x31,
+    0x0d,
+    0x0a,
+    /* "ETag: \"bf4304377e0c28dc-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x62,
+    0x66,
+    0x34,
+    0x33,
+    0x30,
+    0x34,
+    0x33,
+    0x37,
+    0x37,
+    0x65,
+    0x30,
+    0x63,
+    0x32,
+    0x38,
+    0x64,
+    0x63,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x69,
+    0x6d,
+    0x61,
+    0x67,
+    0x65,
+    0x2f,
+    0x73,
+    0x76,
+    0x67,
+    0x2b,
+    0x78,
+    0x6d,
+    0x6c,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (481 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0xbd,
+    0x53,
+    0xcb,
+    0x8e,
+    0xdb,
+    0x30,
+    0x0c,
+    0xbc,
+    0xef,
+    0x57,
+    0x10,
+    0xea,
+    0x59,
+    0x8c,
+    0xde,
+    0x92,
+    0x8b,
+    0x78,
+    0x0f,
+    0xed,
+    0xb9,
+    0x40,
+    0x8b,
+    0x7e,
+    0x81,
+    0xe1,
+    0x28,
+    0xb6,
+    0x80,
+    0x38,
+    0x0e,
+    0x1c,
+    0xaf,
+    0xbd,
+    0xcd,
+    0xd7,
+    0x97,
+    0x92,
+    0xb3,
+    0x9b,
+    0xf6,
+    0x50,
+    0xf4,
+    0x52,
+    0x54,
+    0x06,
+    0x86,
+    0x43,
+    0x90,
+    0xa0,
+    0xc8,
+    0xa1,
+    0xbc,
+    0xbf,
+    0x2e,
+    0xdd,
+    0x13,
+    0xd0,
+    0x79,
+    0x1d,
+    0x4e,
+    0xe7,
+    0x6b,
+    0xcd,
+    0xfa,
+    0x79,
+    0xbe,
+    0x7c,
+    0xdc,
+    0xed,
+    0xd6,
+    0x75,
+    0xc5,
+    0x55,
+    0xe3,
+    0x38,
+    0x75,
+    0x3b,
+    0x25,
+    0x84,
+    0xd8,
+    0x51,
+    0x16,
+    0x83,
+    0x35,
+    0x1d,
+    0xe6,
+    0xbe,
+    0x66,
+    0xc6,
+    0xa0,
+    0x75,
+    0x92,
+    0x41,
+    0x1f,
+    0x53,
+    0xd7,
+    0xcf,
+    0x0f,
+    0x7f,
+    0x49,
+    0x71,
+    0xfd,
+    0x34,
+    0xbe,
+    0xd6,
+    0x4c,
+    0x80,
+    0x00,
+    0xa5,
+    0x25,
+    0x7a,
+    0x77,
+    0x37,
+    0x0c,
+    0xae,
+    0x7d,
+    0x73,
+    0x89,
+    0x7c,
+    0x8a,
+    0xe7,
+    0x43,
+    0x9c,
+    0xd2,
+    0xb9,
+    0xab,
+    0x59,
+    0x17,
+    0xc7,
+    0x21,
+    0xce,
+    0x53,
+    0x6a,
+    0xbf,
+    0x4e,
+    0xb1,
+    0x4d,
+    0xd7,
+    0x34,
+    0x9e,
+    0x19,
+    0xa4,
+    0xa1,
+    0xe9,
+    0x7e,
+    0x4b,
+    0x1a,
+    0x2f,
+    0x73,
+    0x1a,
+    0xd2,
+    0x2d,
+    0x7e,
+    0x7b,
+    0x69,
+    0x4e,
+    0x69,
+    0xfe,
+    0xc1,
+    0xe0,
+    0x98,
+    0x4e,
+    0x27,
+    0x3e,
+    0xbd,
+    0x9c,
+    0x62,
+    0xcd,
+    0xe2,
+    0x12,
+    0xcf,
+    0xe3,
+    0xe1,
+    0xc0,
+    0x9e,
+    0x4b,
+    0xf7,
+    0xfb,
+    0x4b,
+    0x33,
+    0xf7,
+    0x70,
+    0xa8,
+    0xd9,
+    0x17,
+    0x29,
+    0x2d,
+    0x86,
+    0x00,
+    0xe2,
+    0xb3,
+    0x95,
+    0xc5,
+    0xd2,
+    0xf7,
+    0xc6,
+    0xb6,
+    0x50,
+    0x4b,
+    0xcd,
+    0x49,
+    0x34,
+    0x1e,
+    0xc8,
+    0x31,
+    0x60,
+    0x24,
+    0x5a,
+    0x0f,
+    0xd2,
+    0xa1,
+    0x50,
+    0x60,
+    0x03,
+    0x86,
+    0x85,
+    0xdb,
+    0x0a,
+    0x85,
+    0x6d,
+    0x51,
+    0x6a,
+    0x6e,
+    0x2d,
+    0x0a,
+    0xca,
+    0x30,
+    0x18,
+    0x78,
+    0x55,
+    0xa1,
+    0x53,
+    0x40,
+    0x18,
+    0xec,
+    0x9d,
+    0x87,
+    0x80,
+    0xae,
+    0x14,
+    0xd5,
+    0x1a,
+    0xb5,
+    0x03,
+    0x29,
+    0x3c,
+    0x7a,
+    0x05,
+    0x5e,
+    0x20,
+    0x71,
+    0x42,
+    0xe3,
+    0xb9,
+    0xf1,
+    0x39,
+    0x2f,
+    0xa3,
+    0xe6,
+    0x92,
+    0xae,
+    0x94,
+    0x06,
+    0x4a,
+    0x2e,
+    0x97,
+    0x56,
+    0x63,
+    0x50,
+    0x64,
+    0x50,
+    0xb8,
+    0x45,
+    0x11,
+    0x86,
+    0x96,
+    0xc2,
+    0xc2,
+    0xe5,
+    0xbe,
+    0xbc,
+    0x06,
+    0x2b,
+    0x48,
+    0x4f,
+    0xd0,
+    0x16,
+    0x95,
+    0x81,
+    0xa0,
+    0x51,
+    0xdd,
+    0xa9,
+    0x33,
+    0xef,
+    0x23,
+    0xf0,
+    0x6d,
+    0xa2,
+    0xbb,
+    0xb3,
+    0x99,
+    0xef,
+    0xd2,
+    0x53,
+    0x77,
+    0x9e,
+    0xa3,
+    0x90,
+    0x5b,
+    0xa0,
+    0xd0,
+    0xdb,
+    0xa0,
+    0xa9,
+    0x23,
+    0x0f,
+    0x81,
+    0x4a,
+    0xb4,
+    0x5c,
+    0x79,
+    0x2a,
+    0x54,
+    0xd0,
+    0x72,
+    0x6f,
+    0x50,
+    0x68,
+    0xee,
+    0x31,
+    0xb8,
+    0x8d,
+    0xc2,
+    0x96,
+    0x28,
+    0x40,
+    0x07,
+    0xb4,
+    0xd4,
+    0xb6,
+    0xc3,
+    0x00,
+    0xd6,
+    0x63,
+    0x45,
+    0x33,
+    0xfd,
+    0x12,
+    0x26,
+    0xa1,
+    0x2a,
+    0x9a,
+    0x86,
+    0xd0,
+    0x14,
+    0x6e,
+    0x38,
+    0xc9,
+    0x43,
+    0x8d,
+    0x71,
+    0x27,
+    0x51,
+    0xeb,
+    0xdb,
+    0xc0,
+    0x4b,
+    0x1a,
+    0x47,
+    0x6b,
+    0x5a,
+    0x2e,
+    0xe9,
+    0x1e,
+    0x4d,
+    0x21,
+    0x7a,
+    0x02,
+    0x8a,
+    0x64,
+    0xc2,
+    0xca,
+    0x6f,
+    0x34,
+    0xc3,
+    0xb5,
+    0xf8,
+    0xf0,
+    0xee,
+    0x3f,
+    0x80,
+    0x3f,
+    0x22,
+    0xfc,
+    0xe1,
+    0xf3,
+    0x87,
+    0x9f,
+    0xe1,
+    0xb6,
+    0x3d,
+    0x85,
+    0x9a,
+    0x7d,
+    0x38,
+    0x96,
+    0xc3,
+    0x76,
+    0x7f,
+    0x78,
+    0x06,
+    0x65,
+    0xb1,
+    0xed,
+    0xbf,
+    0xda,
+    0x15,
+    0xc9,
+    0x6e,
+    0x54,
+    0x13,
+    0x50,
+    0xd3,
+    0xfa,
+    0x33,
+    0x50,
+    0x45,
+    0x90,
+    0x59,
+    0x8d,
+    0xbc,
+    0x9b,
+    0x85,
+    0xe7,
+    0xba,
+    0xea,
+    0xaf,
+    0x2f,
+    0xe7,
+    0x6d,
+    0x25,
+    0xae,
+    0xfa,
+    0x2f,
+    0x2b,
+    0x79,
+    0x57,
+    0x2a,
+    0x1e,
+    0xfd,
+    0x51,
+    0x36,
+    0x59,
+    0xa9,
+    0x7d,
+    0xfe,
+    0x9d,
+    0x9f,
+    0x9f,
+    0x7e,
+    0x02,
+    0xab,
+    0xee,
+    0x0a,
+    0xb3,
+    0xfb,
+    0x03,
+    0x00,
+    0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__status_heatbed_svg_gz = 20;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__status_heatbed_svg_gz[] FSDATA_ALIGN_POST = {
+    /* /status_heatbed.svg (20 chars) */
+    0x2f,
+    0x73,
+    0x74,
+    0x61,
+    0x74,
+    0x75,
+    0x73,
+    0x5f,
+    0x68,
+    0x65,
+    0x61,
+    0x74,
+    0x62,
+    0x65,
+    0x64,
+    0x2e,
+    0x73,
+    0x76,
+    0x67,
+    0x00,
+
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 367\r\n" (21 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x33,
+    0x36,
+    0x37,
+    0x0d,
+    0x0a,
+    /* "ETag: \"2331944d34c268f2-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x32,
+    0x33,
+    0x33,
+    0x31,
+    0x39,
+    0x34,
+    0x34,
+    0x64,
+    0x33,
+    0x34,
+    0x63,
+    0x32,
+    0x36,
+    0x38,
+    0x66,
+    0x32,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x69,
+    0x6d,
+    0x61,
+    0x67,
+    0x65,
+    0x2f,
+    0x73,
+    0x76,
+    0x67,
+    0x2b,
+    0x78,
+    0x6d,
+    0x6c,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (367 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0xad,
+    0x92,
+    0x4d,
+    0x6e,
+    0x83,
+    0x30,
+    0x10,
+    0x85,
+    0xf7,
+    0x39,
+    0xc5,
+    0xc8,
+    0x5d,
+    0x33,
+    0xd8,
+    0x06,
+    0x63,
+    0x53,
+    0x85,
+    0x2c,
+    0xda,
+    0x4d,
+    0x37,
+    0x95,
+    0xda,
+    0x23,
+    0x20,
+    0x30,
+    0x60,
+    0x89,
+    0x3f,
+    0x01,
+    0x81,
+    0x94,
+    0xd3,
+    0x77,
+    0x9c,
+    0x48,
+    0x95,
+    0xd2,
+    0x5d,
+    0xa4,
+    0x58,
+    0xc2,
+    0x63,
+    0x33,
+    0xcf,
+    0x6f,
+    0x3e,
+    0xf0,
+    0x1c,
+    0xe7,
+    0xb5,
+    0x3e,
+    0x00,
+    0x8d,
+    0x4b,
+    0xd7,
+    0xf6,
+    0x73,
+    0xc6,
+    0x9a,
+    0x65,
+    0x19,
+    0x5f,
+    0xc3,
+    0x70,
+    0xdb,
+    0x36,
+    0xdc,
+    0x22,
+    0x1c,
+    0xa6,
+    0x3a,
+    0x94,
+    0x9c,
+    0xf3,
+    0x90,
+    0x54,
+    0x0c,
+    0x36,
+    0x57,
+    0x2e,
+    0x4d,
+    0xc6,
+    0x44,
+    0x84,
+    0x46,
+    0x2b,
+    0x06,
+    0x8d,
+    0x75,
+    0x75,
+    0xb3,
+    0xd0,
+    0x5e,
+    0xa0,
+    0x4c,
+    0x34,
+    0x83,
+    0xd5,
+    0xd9,
+    0xed,
+    0x6d,
+    0xb8,
+    0x64,
+    0x8c,
+    0x03,
+    0x07,
+    0xc1,
+    0x91,
+    0x1b,
+    0x30,
+    0x28,
+    0x0c,
+    0x83,
+    0xb9,
+    0xc9,
+    0x47,
+    0x1b,
+    0x4c,
+    0xb6,
+    0x2f,
+    0xed,
+    0xe4,
+    0xfa,
+    0x3a,
+    0x63,
+    0xb5,
+    0x1d,
+    0x3a,
+    0xbb,
+    0x4c,
+    0xae,
+    0xf8,
+    0x9a,
+    0x6c,
+    0xe1,
+    0x66,
+    0x37,
+    0xf4,
+    0x0c,
+    0x5c,
+    0x97,
+    0xd7,
+    0x77,
+    0xa2,
+    0x61,
+    0x5c,
+    0x5c,
+    0xe7,
+    0x76,
+    0xfb,
+    0x7d,
+    0xce,
+    0x5b,
+    0xb7,
+    0xfc,
+    0x30,
+    0xa8,
+    0x5c,
+    0xdb,
+    0x06,
+    0xd3,
+    0xb9,
+    0xb5,
+    0x19,
+    0xb3,
+    0xab,
+    0xed,
+    0x87,
+    0xb2,
+    0x64,
+    0xa7,
+    0x2b,
+    0xfa,
+    0x71,
+    0xcc,
+    0x97,
+    0x06,
+    0xca,
+    0x8c,
+    0x7d,
+    0x46,
+    0x28,
+    0x24,
+    0x28,
+    0xe4,
+    0xb2,
+    0x08,
+    0xd0,
+    0x04,
+    0xa8,
+    0xe9,
+    0x49,
+    0x03,
+    0xc2,
+    0x8b,
+    0x03,
+    0x94,
+    0x81,
+    0x44,
+    0x22,
+    0xf7,
+    0xcb,
+    0x08,
+    0x23,
+    0x15,
+    0x60,
+    0x22,
+    0xaf,
+    0x21,
+    0x95,
+    0xef,
+    0xf4,
+    0x56,
+    0x83,
+    0xc0,
+    0x28,
+    0x06,
+    0x89,
+    0x06,
+    0xb5,
+    0xa4,
+    0x20,
+    0x81,
+    0xb7,
+    0x94,
+    0x53,
+    0x98,
+    0x16,
+    0x98,
+    0x52,
+    0x8e,
+    0x2b,
+    0x34,
+    0x92,
+    0xa2,
+    0x48,
+    0x50,
+    0x68,
+    0xca,
+    0x73,
+    0x72,
+    0xa6,
+    0xf3,
+    0xde,
+    0x2b,
+    0xf1,
+    0x53,
+    0x4a,
+    0x9f,
+    0x8c,
+    0x3a,
+    0x41,
+    0xe5,
+    0x8d,
+    0x62,
+    0xe3,
+    0x95,
+    0x5e,
+    0x25,
+    0x5b,
+    0xaa,
+    0x4f,
+    0x7f,
+    0x6b,
+    0xef,
+    0x14,
+    0x6a,
+    0xe0,
+    0x0f,
+    0x51,
+    0x19,
+    0x4c,
+    0x93,
+    0x1b,
+    0x95,
+    0x41,
+    0xe5,
+    0xa9,
+    0xb4,
+    0xaf,
+    0xf2,
+    0x5c,
+    0x2a,
+    0xaa,
+    0x6e,
+    0xcc,
+    0x63,
+    0x5c,
+    0xc0,
+    0x69,
+    0x43,
+    0x25,
+    0xe2,
+    0xc4,
+    0x4b,
+    0x15,
+    0x4d,
+    0xdc,
+    0xaf,
+    0x52,
+    0xfd,
+    0x54,
+    0xb2,
+    0xdb,
+    0x6d,
+    0x67,
+    0xec,
+    0xc5,
+    0x56,
+    0xba,
+    0x12,
+    0x39,
+    0x0b,
+    0xff,
+    0xdf,
+    0x34,
+    0x87,
+    0x04,
+    0x4d,
+    0x73,
+    0xed,
+    0xb2,
+    0x95,
+    0x1c,
+    0x3e,
+    0xf8,
+    0x7e,
+    0xd7,
+    0x20,
+    0xfd,
+    0xd0,
+    0xef,
+    0x76,
+    0x1a,
+    0xfe,
+    0x6c,
+    0xaa,
+    0xeb,
+    0xf0,
+    0x36,
+    0x47,
+    0xdf,
+    0xcb,
+    0xa7,
+    0xc3,
+    0x2f,
+    0x1d,
+    0xb7,
+    0x84,
+    0xaa,
+    0xf8,
+    0x02,
+    0x00,
+    0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__status_nozzle_svg_gz = 21;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__status_nozzle_svg_gz[] FSDATA_ALIGN_POST = {
+    /* /status_nozzle.svg (19 chars) */
+    0x2f,
+    0x73,
+    0x74,
+    0x61,
+    0x74,
+    0x75,
+    0x73,
+    0x5f,
+    0x6e,
+    0x6f,
+    0x7a,
+    0x7a,
+    0x6c,
+    0x65,
+    0x2e,
+    0x73,
+    0x76,
+    0x67,
+    0x00,
+    0x00,
+
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 328\r\n" (21 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x33,
+    0x32,
+    0x38,
+    0x0d,
+    0x0a,
+    /* "ETag: \"8763b121352f782c-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x38,
+    0x37,
+    0x36,
+    0x33,
+    0x62,
+    0x31,
+    0x32,
+    0x31,
+    0x33,
+    0x35,
+    0x32,
+    0x66,
+    0x37,
+    0x38,
+    0x32,
+    0x63,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x69,
+    0x6d,
+    0x61,
+    0x67,
+    0x65,
+    0x2f,
+    0x73,
+    0x76,
+    0x67,
+    0x2b,
+    0x78,
+    0x6d,
+    0x6c,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (328 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0x6d,
+    0x51,
+    0x4d,
+    0x6f,
+    0xc2,
+    0x30,
+    0x0c,
+    0xbd,
+    0xf3,
+    0x2b,
+    0xac,
+    0xec,
+    0x5c,
+    0x37,
+    0x49,
+    0xd3,
+    0x0f,
+    0x10,
+    0xe5,
+    0xb0,
+    0x13,
+    0x07,
+    0x26,
+    0x6d,
+    0x97,
+    0xde,
+    0x2b,
+    0x48,
+    0x9b,
+    0x48,
+    0xfd,
+    0x52,
+    0x1b,
+    0x5a,
+    0xc6,
+    0xaf,
+    0x9f,
+    0x03,
+    0x48,
+    0x88,
+    0x6d,
+    0x4e,
+    0x22,
+    0xd9,
+    0xce,
+    0xb3,
+    0xdf,
+    0xb3,
+    0xbc,
+    0x9d,
+    0xe6,
+    0x7a,
+    0x05,
+    0x64,
+    0x97,
+    0xb6,
+    0xe9,
+    0xa6,
+    0x9c,
+    0x19,
+    0xe7,
+    0x86,
+    0x4d,
+    0x18,
+    0x2e,
+    0xcb,
+    0x82,
+    0x4b,
+    0x84,
+    0xfd,
+    0x58,
+    0x87,
+    0x92,
+    0x73,
+    0x1e,
+    0x12,
+    0x8a,
+    0xc1,
+    0x62,
+    0x4f,
+    0xce,
+    0xe4,
+    0x4c,
+    0x48,
+    0x8c,
+    0xb2,
+    0x35,
+    0x03,
+    0xa3,
+    0x6d,
+    0x6d,
+    0x1c,
+    0xc5,
+    0x31,
+    0xaa,
+    0x88,
+    0xe2,
+    0xd9,
+    0xea,
+    0xe5,
+    0xbd,
+    0xbf,
+    0xe4,
+    0x8c,
+    0x03,
+    0x87,
+    0x14,
+    0x25,
+    0x64,
+    0xb8,
+    0x4e,
+    0x19,
+    0x4c,
+    0xa6,
+    0x1c,
+    0x74,
+    0x30,
+    0xea,
+    0xee,
+    0xa4,
+    0x47,
+    0xdb,
+    0xd5,
+    0x39,
+    0xab,
+    0x75,
+    0xdf,
+    0x6a,
+    0x37,
+    0xda,
+    0xe3,
+    0xe7,
+    0xa8,
+    0x8f,
+    0x76,
+    0xb2,
+    0x7d,
+    0xc7,
+    0xc0,
+    0xb6,
+    0x65,
+    0xfd,
+    0x02,
+    0xea,
+    0x07,
+    0x67,
+    0x5b,
+    0x7b,
+    0xd5,
+    0x5f,
+    0xe7,
+    0xb2,
+    0xb1,
+    0xee,
+    0x9b,
+    0x41,
+    0x65,
+    0x9b,
+    0x26,
+    0x18,
+    0xcf,
+    0x8d,
+    0xce,
+    0x59,
+    0xd7,
+    0x77,
+    0x57,
+    0x3d,
+    0xf6,
+    0x6c,
+    0x77,
+    0x13,
+    0xbe,
+    0x1d,
+    0x4a,
+    0x67,
+    0xe0,
+    0x94,
+    0xb3,
+    0x0f,
+    0x85,
+    0x22,
+    0x01,
+    0x85,
+    0xaa,
+    0x88,
+    0x31,
+    0x2e,
+    0x31,
+    0x4e,
+    0xe8,
+    0x82,
+    0xd7,
+    0x22,
+    0x82,
+    0x7b,
+    0xb0,
+    0x17,
+    0x28,
+    0xe4,
+    0x8c,
+    0x91,
+    0x32,
+    0x04,
+    0x88,
+    0x5e,
+    0x10,
+    0x70,
+    0x0f,
+    0x66,
+    0x81,
+    0xea,
+    0xff,
+    0x52,
+    0x8c,
+    0xd3,
+    0x67,
+    0x5e,
+    0xd0,
+    0xe1,
+    0x81,
+    0xef,
+    0xb6,
+    0x4f,
+    0x50,
+    0xcc,
+    0x01,
+    0xb5,
+    0x7c,
+    0x05,
+    0x3c,
+    0x0a,
+    0xfd,
+    0xfb,
+    0x23,
+    0x06,
+    0x1e,
+    0x1f,
+    0x46,
+    0xa2,
+    0xca,
+    0x0a,
+    0x92,
+    0x6b,
+    0x7c,
+    0xa3,
+    0xeb,
+    0x7d,
+    0xc2,
+    0x9c,
+    0xbd,
+    0xe9,
+    0x2a,
+    0xad,
+    0x44,
+    0xc9,
+    0xc2,
+    0xdf,
+    0xd3,
+    0x11,
+    0x53,
+    0x04,
+    0x7c,
+    0x96,
+    0xc8,
+    0x93,
+    0x83,
+    0x22,
+    0x46,
+    0x3f,
+    0xe9,
+    0x5e,
+    0x62,
+    0x96,
+    0x34,
+    0xa4,
+    0x24,
+    0x0b,
+    0x68,
+    0x29,
+    0x51,
+    0xc1,
+    0x29,
+    0x21,
+    0x69,
+    0x88,
+    0x24,
+    0x6b,
+    0x04,
+    0x2d,
+    0x80,
+    0x1c,
+    0x83,
+    0xea,
+    0x10,
+    0x7b,
+    0x27,
+    0x2b,
+    0xf8,
+    0x93,
+    0xa3,
+    0xba,
+    0x99,
+    0xe7,
+    0xd8,
+    0xfa,
+    0xd5,
+    0xee,
+    0x56,
+    0x3f,
+    0xfe,
+    0x7e,
+    0xef,
+    0xb4,
+    0x07,
+    0x02,
+    0x00,
+    0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__status_prnflow_svg_gz = 22;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__status_prnflow_svg_gz[] FSDATA_ALIGN_POST = {
+    /* /status_prnflow.svg (20 chars) */
+    0x2f,
+    0x73,
+    0x74,
+    0x61,
+    0x74,
+    0x75,
+    0x73,
+    0x5f,
+    0x70,
+    0x72,
+    0x6e,
+    0x66,
+    0x6c,
+    0x6f,
+    0x77,
+    0x2e,
+    0x73,
+    0x76,
+    0x67,
+    0x00,
+
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 331\r\n" (21 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x33,
+    0x33,
+    0x31,
+    0x0d,
+    0x0a,
+    /* "ETag: \"3421ef843737549f-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x33,
+    0x34,
+    0x32,
+    0x31,
+    0x65,
+    0x66,
+    0x38,
+    0x34,
+    0x33,
+    0x37,
+    0x33,
+    0x37,
+    0x35,
+    0x34,
+    0x39,
+    0x66,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x69,
+    0x6d,
+    0x61,
+    0x67,
+    0x65,
+    0x2f,
+    0x73,
+    0x76,
+    0x67,
+    0x2b,
+    0x78,
+    0x6d,
+    0x6c,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (331 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0x5d,
+    0x51,
+    0xcb,
+    0x6e,
+    0x83,
+    0x30,
+    0x10,
+    0xbc,
+    0xe7,
+    0x2b,
+    0x56,
+    0xee,
+    0xd9,
+    0x8b,
+    0x6d,
+    0x0c,
+    0x86,
+    0x2a,
+    0xe4,
+    0xd0,
+    0x5e,
+    0x72,
+    0x68,
+    0xa5,
+    0xf6,
+    0xd2,
+    0x3b,
+    0x02,
+    0x83,
+    0x2d,
+    0xf1,
+    0x12,
+    0x38,
+    0x21,
+    0xcd,
+    0xd7,
+    0xd7,
+    0x76,
+    0x0e,
+    0x55,
+    0xbb,
+    0x92,
+    0xa5,
+    0x5d,
+    0xcd,
+    0xec,
+    0xcc,
+    0x8e,
+    0x7c,
+    0xdc,
+    0xae,
+    0xfd,
+    0x01,
+    0x7c,
+    0xdd,
+    0xc6,
+    0x61,
+    0xda,
+    0x2a,
+    0x62,
+    0x9c,
+    0x5b,
+    0x9e,
+    0x93,
+    0x64,
+    0xdf,
+    0x77,
+    0xdc,
+    0x53,
+    0x9c,
+    0xd7,
+    0x3e,
+    0x11,
+    0x8c,
+    0xb1,
+    0xc4,
+    0xb3,
+    0x08,
+    0xec,
+    0xb6,
+    0x75,
+    0xa6,
+    0x22,
+    0x42,
+    0x20,
+    0x63,
+    0x9c,
+    0x80,
+    0xd1,
+    0xb6,
+    0x37,
+    0xce,
+    0xcf,
+    0x92,
+    0xc0,
+    0xd5,
+    0xea,
+    0xfd,
+    0x65,
+    0xbe,
+    0x55,
+    0x84,
+    0x01,
+    0x83,
+    0x9c,
+    0x63,
+    0x99,
+    0x41,
+    0xae,
+    0x30,
+    0x2b,
+    0x08,
+    0x6c,
+    0xa6,
+    0x5e,
+    0x34,
+    0x5d,
+    0xf5,
+    0xd4,
+    0xea,
+    0xd5,
+    0x4e,
+    0x7d,
+    0x45,
+    0x7a,
+    0x3d,
+    0x8f,
+    0xda,
+    0xad,
+    0xb6,
+    0xf9,
+    0x58,
+    0x75,
+    0x63,
+    0x37,
+    0x3b,
+    0x4f,
+    0x04,
+    0xec,
+    0x58,
+    0xf7,
+    0x7f,
+    0x48,
+    0xf3,
+    0xe2,
+    0xec,
+    0x68,
+    0xef,
+    0xfa,
+    0xf3,
+    0x52,
+    0x0f,
+    0xd6,
+    0x7d,
+    0x13,
+    0xe8,
+    0xec,
+    0x30,
+    0xd0,
+    0xf5,
+    0x32,
+    0xe8,
+    0x8a,
+    0xe8,
+    0xab,
+    0x9e,
+    0xe6,
+    0xb6,
+    0x25,
+    0xa7,
+    0x78,
+    0xf7,
+    0x71,
+    0xa9,
+    0x9d,
+    0x81,
+    0xb6,
+    0x22,
+    0xef,
+    0x22,
+    0xc3,
+    0x54,
+    0x40,
+    0xc6,
+    0x50,
+    0x19,
+    0x5a,
+    0xa0,
+    0x54,
+    0x03,
+    0x97,
+    0xc8,
+    0x0a,
+    0xe0,
+    0x39,
+    0x96,
+    0x6f,
+    0x32,
+    0x8b,
+    0xc0,
+    0xfd,
+    0x21,
+    0x54,
+    0x91,
+    0x27,
+    0xdd,
+    0xa9,
+    0x8e,
+    0xd7,
+    0x24,
+    0xf9,
+    0x2f,
+    0x92,
+    0xe6,
+    0x98,
+    0xe5,
+    0x20,
+    0x15,
+    0xa6,
+    0xc5,
+    0x80,
+    0xcc,
+    0x27,
+    0x15,
+    0x0d,
+    0xa3,
+    0x3c,
+    0x03,
+    0xee,
+    0xc5,
+    0x15,
+    0xf5,
+    0x68,
+    0x99,
+    0x82,
+    0x88,
+    0xbd,
+    0xe7,
+    0xc8,
+    0xb3,
+    0x2c,
+    0x31,
+    0x6f,
+    0xa8,
+    0x0c,
+    0xc6,
+    0x12,
+    0x39,
+    0x2d,
+    0xa3,
+    0x21,
+    0x43,
+    0xa1,
+    0x28,
+    0x4f,
+    0xfd,
+    0x6e,
+    0x34,
+    0xff,
+    0x62,
+    0xe7,
+    0xb0,
+    0x91,
+    0x5e,
+    0xc3,
+    0xf0,
+    0x2a,
+    0x38,
+    0xca,
+    0x07,
+    0x25,
+    0x80,
+    0x2a,
+    0xac,
+    0x01,
+    0x17,
+    0x5e,
+    0x10,
+    0xd8,
+    0x19,
+    0x19,
+    0x6f,
+    0x38,
+    0x0b,
+    0xa8,
+    0x54,
+    0xd1,
+    0x05,
+    0x52,
+    0xe1,
+    0xd9,
+    0xb1,
+    0x0b,
+    0x76,
+    0xe1,
+    0x22,
+    0xea,
+    0x9f,
+    0xe1,
+    0x1c,
+    0x85,
+    0xfc,
+    0x0d,
+    0xd3,
+    0xc5,
+    0x0a,
+    0x61,
+    0x8e,
+    0xe1,
+    0xa7,
+    0x4e,
+    0x87,
+    0x1f,
+    0xf0,
+    0x42,
+    0x56,
+    0xfa,
+    0xd6,
+    0x01,
+    0x00,
+    0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__status_prnspeed_svg_gz = 23;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__status_prnspeed_svg_gz[] FSDATA_ALIGN_POST = {
+    /* /status_prnspeed.svg (21 chars) */
+    0x2f,
+    0x73,
+    0x74,
+    0x61,
+    0x74,
+    0x75,
+    0x73,
+    0x5f,
+    0x70,
+    0x72,
+    0x6e,
+    0x73,
+    0x70,
+    0x65,
+    0x65,
+    0x64,
+    0x2e,
+    0x73,
+    0x76,
+    0x67,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 825\r\n" (21 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x38,
+    0x32,
+    0x35,
+    0x0d,
+    0x0a,
+    /* "ETag: \"e5c3462962924e8a-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x65,
+    0x35,
+    0x63,
+    0x33,
+    0x34,
+    0x36,
+    0x32,
+    0x39,
+    0x36,
+    0x32,
+    0x39,
+    0x32,
+    0x34,
+    0x65,
+    0x38,
+    0x61,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x69,
+    0x6d,
+    0x61,
+    0x67,
+    0x65,
+    0x2f,
+    0x73,
+    0x76,
+    0x67,
+    0x2b,
+    0x78,
+    0x6d,
+    0x6c,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (825 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0x5d,
+    0x54,
+    0xc9,
+    0x8e,
+    0xda,
+    0x40,
+    0x10,
+    0xbd,
+    0xcf,
+    0x57,
+    0x94,
+    0x9c,
+    0x73,
+    0x17,
+    0xbd,
+    0x2f,
+    0xd1,
+    0x30,
+    0x87,
+    0xcc,
+    0x75,
+    0x90,
+    0x92,
+    0x4b,
+    0xee,
+    0xc8,
+    0x18,
+    0xb0,
+    0x64,
+    0x16,
+    0x01,
+    0x03,
+    0x13,
+    0xbe,
+    0x3e,
+    0xaf,
+    0xba,
+    0x19,
+    0x65,
+    0xf1,
+    0xc1,
+    0xee,
+    0xe5,
+    0x75,
+    0xd7,
+    0xab,
+    0x57,
+    0xaf,
+    0xfc,
+    0x7c,
+    0xbe,
+    0x6e,
+    0x9e,
+    0x08,
+    0xcf,
+    0xc7,
+    0x6e,
+    0xda,
+    0x9f,
+    0xe7,
+    0xdd,
+    0xf6,
+    0x72,
+    0x39,
+    0x7e,
+    0x9d,
+    0xcd,
+    0x6e,
+    0xb7,
+    0x1b,
+    0xdf,
+    0x1c,
+    0x1f,
+    0x4e,
+    0x9b,
+    0x99,
+    0xd5,
+    0x5a,
+    0xcf,
+    0x80,
+    0xea,
+    0xe8,
+    0x36,
+    0xae,
+    0x2e,
+    0xdb,
+    0x79,
+    0xe7,
+    0x0b,
+    0x97,
+    0x52,
+    0x3a,
+    0xda,
+    0x0e,
+    0xe3,
+    0x66,
+    0x7b,
+    0x99,
+    0x77,
+    0x2e,
+    0x71,
+    0xe8,
+    0xe8,
+    0x3a,
+    0x0e,
+    0xb7,
+    0x6f,
+    0x87,
+    0x8f,
+    0x79,
+    0xa7,
+    0x49,
+    0x93,
+    0xd1,
+    0x36,
+    0xb3,
+    0x76,
+    0x94,
+    0x92,
+    0x61,
+    0x6d,
+    0x3b,
+    0x3a,
+    0x6f,
+    0x97,
+    0xc7,
+    0x41,
+    0x9d,
+    0x86,
+    0xfd,
+    0x6a,
+    0x38,
+    0x8d,
+    0xfb,
+    0xcd,
+    0xbc,
+    0xdb,
+    0x0c,
+    0x87,
+    0xdd,
+    0x70,
+    0x39,
+    0x8d,
+    0xfd,
+    0xf7,
+    0xd3,
+    0xd0,
+    0x8f,
+    0xe7,
+    0xf1,
+    0xb0,
+    0xef,
+    0x68,
+    0xdc,
+    0x2d,
+    0x37,
+    0xff,
+    0x80,
+    0x0e,
+    0xc7,
+    0xcb,
+    0xb8,
+    0x1b,
+    0xef,
+    0xc3,
+    0x8f,
+    0xf7,
+    0xe5,
+    0x34,
+    0x5e,
+    0x7e,
+    0x75,
+    0xb4,
+    0x1e,
+    0xa7,
+    0x49,
+    0x9d,
+    0xde,
+    0xa7,
+    0x61,
+    0xde,
+    0x0d,
+    0xd7,
+    0x61,
+    0x7f,
+    0x58,
+    0xad,
+    0xba,
+    0x97,
+    0x4a,
+    0xfe,
+    0xf9,
+    0xb8,
+    0xbc,
+    0x6c,
+    0x69,
+    0x35,
+    0xef,
+    0x16,
+    0x9f,
+    0x91,
+    0x83,
+    0xf1,
+    0xbd,
+    0xa6,
+    0xe2,
+    0x38,
+    0x44,
+    0x65,
+    0x03,
+    0x1b,
+    0x32,
+    0xd9,
+    0xb0,
+    0x73,
+    0x2a,
+    0x66,
+    0x2e,
+    0x89,
+    0x6c,
+    0x88,
+    0x5c,
+    0xe2,
+    0x5b,
+    0xce,
+    0x9e,
+    0x13,
+    0x25,
+    0x9b,
+    0x7b,
+    0x17,
+    0xd9,
+    0x47,
+    0x15,
+    0x71,
+    0x2e,
+    0x71,
+    0x0c,
+    0xca,
+    0xb8,
+    0x80,
+    0xfd,
+    0xc7,
+    0xc4,
+    0x1a,
+    0xff,
+    0x5a,
+    0xbc,
+    0x65,
+    0x17,
+    0xc8,
+    0xa6,
+    0xc4,
+    0xde,
+    0x52,
+    0x0a,
+    0x9a,
+    0x23,
+    0xe5,
+    0xc0,
+    0x31,
+    0x4a,
+    0xa0,
+    0xc7,
+    0xa8,
+    0x6e,
+    0x7e,
+    0x4e,
+    0xe4,
+    0x9d,
+    0x3f,
+    0xf1,
+    0x6d,
+    0xd2,
+    0x28,
+    0x25,
+    0xd0,
+    0xc3,
+    0x45,
+    0x86,
+    0x2d,
+    0x99,
+    0x60,
+    0x5a,
+    0x08,
+    0x4c,
+    0xfd,
+    0xa4,
+    0x92,
+    0x67,
+    0x17,
+    0x09,
+    0x81,
+    0x4a,
+    0x7a,
+    0xad,
+    0x94,
+    0x63,
+    0x09,
+    0xec,
+    0x2c,
+    0xe4,
+    0x8c,
+    0x1a,
+    0x12,
+    0x07,
+    0x0c,
+    0x24,
+    0x98,
+    0x26,
+    0xeb,
+    0x24,
+    0x7c,
+    0x7b,
+    0x3f,
+    0xd6,
+    0x7a,
+    0x9b,
+    0x1d,
+    0x7b,
+    0xd7,
+    0xa6,
+    0x90,
+    0xfc,
+    0xb1,
+    0xfb,
+    0x98,
+    0xe0,
+    0x73,
+    0x5f,
+    0x08,
+    0xae,
+    0xd5,
+    0xa3,
+    0x57,
+    0x21,
+    0x54,
+    0xb0,
+    0x32,
+    0x5a,
+    0x23,
+    0x2d,
+    0xe5,
+    0x3d,
+    0x17,
+    0xfb,
+    0x39,
+    0x69,
+    0x1f,
+    0x6c,
+    0xa2,
+    0xae,
+    0x19,
+    0x17,
+    0x69,
+    0x2e,
+    0x41,
+    0x25,
+    0xcd,
+    0x49,
+    0xae,
+    0xc3,
+    0x8a,
+    0xca,
+    0x58,
+    0x8f,
+    0x6f,
+    0x72,
+    0x9d,
+    0x03,
+    0xd9,
+    0x98,
+    0x26,
+    0x9f,
+    0x39,
+    0x78,
+    0xb2,
+    0x5e,
+    0xb3,
+    0x86,
+    0x92,
+    0xc0,
+    0x23,
+    0xb5,
+    0x04,
+    0xfe,
+    0x15,
+    0x4e,
+    0xd0,
+    0xaa,
+    0xd6,
+    0x43,
+    0xc6,
+    0xf5,
+    0xa8,
+    0x90,
+    0x44,
+    0xfc,
+    0xd4,
+    0xc2,
+    0x92,
+    0xc4,
+    0xf3,
+    0x2d,
+    0x6a,
+    0x6c,
+    0x93,
+    0x7b,
+    0xab,
+    0xf4,
+    0xbc,
+    0xfb,
+    0xb2,
+    0xae,
+    0x4f,
+    0x37,
+    0xfb,
+    0xbf,
+    0xca,
+    0xc1,
+    0x1b,
+    0x4e,
+    0x09,
+    0x02,
+    0x46,
+    0xce,
+    0xa9,
+    0x57,
+    0x85,
+    0x5d,
+    0x52,
+    0x9c,
+    0xb2,
+    0x32,
+    0x99,
+    0x93,
+    0x32,
+    0x6c,
+    0x94,
+    0x45,
+    0xa0,
+    0x3a,
+    0x28,
+    0xe0,
+    0x24,
+    0x89,
+    0x66,
+    0xd4,
+    0x17,
+    0x61,
+    0x64,
+    0xdd,
+    0x13,
+    0x36,
+    0xae,
+    0xc6,
+    0x14,
+    0xb6,
+    0xa1,
+    0xc7,
+    0x2b,
+    0x02,
+    0xa8,
+    0x11,
+    0x3a,
+    0xb3,
+    0x8c,
+    0xe0,
+    0x81,
+    0x0a,
+    0x6a,
+    0x43,
+    0xd9,
+    0x16,
+    0x3f,
+    0x63,
+    0x8f,
+    0x43,
+    0xdd,
+    0x20,
+    0x59,
+    0xff,
+    0xd9,
+    0x22,
+    0xdf,
+    0x17,
+    0x29,
+    0x17,
+    0xce,
+    0x38,
+    0x81,
+    0xc4,
+    0xca,
+    0xd2,
+    0xa1,
+    0xda,
+    0x80,
+    0x3f,
+    0x3e,
+    0xd2,
+    0x07,
+    0x10,
+    0x11,
+    0xdc,
+    0xac,
+    0x82,
+    0x34,
+    0xa5,
+    0x4c,
+    0x2a,
+    0x6b,
+    0x31,
+    0x1f,
+    0x4c,
+    0xe7,
+    0x42,
+    0x8f,
+    0xca,
+    0x04,
+    0x24,
+    0x6f,
+    0x85,
+    0x1f,
+    0xee,
+    0x4d,
+    0x50,
+    0x3a,
+    0xe0,
+    0x4a,
+    0xaa,
+    0x07,
+    0xc8,
+    0x9b,
+    0xa9,
+    0x82,
+    0x55,
+    0x05,
+    0xdf,
+    0x77,
+    0xca,
+    0x18,
+    0x03,
+    0xfa,
+    0x05,
+    0xb6,
+    0x71,
+    0xbd,
+    0x32,
+    0x20,
+    0x93,
+    0x15,
+    0x72,
+    0x4d,
+    0xca,
+    0xb9,
+    0xca,
+    0x35,
+    0x62,
+    0x5d,
+    0x05,
+    0x81,
+    0x58,
+    0xcb,
+    0xd6,
+    0x4e,
+    0xca,
+    0x3b,
+    0x51,
+    0xda,
+    0x18,
+    0x8d,
+    0xd9,
+    0x52,
+    0x4a,
+    0x23,
+    0x6e,
+    0x6c,
+    0x9f,
+    0xda,
+    0xa0,
+    0x52,
+    0x10,
+    0xd4,
+    0xac,
+    0x82,
+    0x2b,
+    0x56,
+    0x35,
+    0xec,
+    0x7d,
+    0x61,
+    0xc5,
+    0x87,
+    0xe4,
+    0x23,
+    0xb6,
+    0x7c,
+    0x0f,
+    0x1b,
+    0x56,
+    0x55,
+    0x21,
+    0x05,
+    0xa8,
+    0xa2,
+    0x7f,
+    0xd0,
+    0x28,
+    0x51,
+    0xdc,
+    0xeb,
+    0xbc,
+    0x0a,
+    0x68,
+    0x2e,
+    0xd8,
+    0xd6,
+    0xe8,
+    0x20,
+    0x44,
+    0x3c,
+    0x3c,
+    0x1e,
+    0x96,
+    0x0e,
+    0x7c,
+    0xc5,
+    0x18,
+    0xed,
+    0xd3,
+    0x24,
+    0xa8,
+    0x68,
+    0x12,
+    0xb4,
+    0x9b,
+    0x1a,
+    0x98,
+    0x2a,
+    0xf8,
+    0xbe,
+    0x33,
+    0xb8,
+    0x19,
+    0xbe,
+    0x0b,
+    0xf0,
+    0x41,
+    0x2f,
+    0x29,
+    0x20,
+    0x41,
+    0xf8,
+    0x82,
+    0x90,
+    0x93,
+    0x0f,
+    0x92,
+    0x13,
+    0xc4,
+    0x02,
+    0x4d,
+    0xe8,
+    0x07,
+    0x9e,
+    0x88,
+    0x04,
+    0xbf,
+    0xb8,
+    0x4a,
+    0x53,
+    0x7b,
+    0x68,
+    0x80,
+    0x96,
+    0x88,
+    0x14,
+    0x21,
+    0x9f,
+    0x72,
+    0xbe,
+    0x9a,
+    0xc1,
+    0xa1,
+    0x7e,
+    0x15,
+    0x2e,
+    0x69,
+    0x79,
+    0x3f,
+    0x09,
+    0x5c,
+    0x14,
+    0x80,
+    0x7a,
+    0xc9,
+    0xc9,
+    0xbd,
+    0xb1,
+    0xc6,
+    0x31,
+    0x52,
+    0x66,
+    0xe4,
+    0x85,
+    0xbf,
+    0x80,
+    0xe7,
+    0x8c,
+    0xf6,
+    0xce,
+    0xe2,
+    0x42,
+    0x91,
+    0x3d,
+    0x2b,
+    0xc8,
+    0xae,
+    0xfe,
+    0xd2,
+    0x1d,
+    0x51,
+    0xbc,
+    0x74,
+    0x2b,
+    0x52,
+    0x8f,
+    0x62,
+    0x1d,
+    0x0b,
+    0x0d,
+    0xa3,
+    0xa4,
+    0xfe,
+    0x4f,
+    0x91,
+    0xe8,
+    0x51,
+    0xa3,
+    0xe0,
+    0xd0,
+    0x07,
+    0x60,
+    0x0f,
+    0xb5,
+    0x72,
+    0xaf,
+    0xc0,
+    0xcc,
+    0x8b,
+    0x72,
+    0x60,
+    0x5c,
+    0xd3,
+    0x81,
+    0x70,
+    0x26,
+    0x48,
+    0x22,
+    0x46,
+    0x84,
+    0xb3,
+    0x6f,
+    0x09,
+    0x8d,
+    0xe2,
+    0xa0,
+    0x04,
+    0x04,
+    0x31,
+    0x70,
+    0x21,
+    0x98,
+    0x8a,
+    0xa3,
+    0xe4,
+    0x8d,
+    0x2b,
+    0xe4,
+    0xb7,
+    0x24,
+    0xd0,
+    0x20,
+    0xb2,
+    0xd9,
+    0xaa,
+    0x9a,
+    0x86,
+    0xc4,
+    0x09,
+    0x27,
+    0xfe,
+    0x34,
+    0xc7,
+    0xb0,
+    0x4e,
+    0x6b,
+    0xb3,
+    0x94,
+    0xe6,
+    0x78,
+    0x96,
+    0xff,
+    0xf3,
+    0xcb,
+    0xd3,
+    0x6f,
+    0x1b,
+    0xbf,
+    0xaf,
+    0x1d,
+    0xcc,
+    0x05,
+    0x00,
+    0x00,
+};
+
+#if FSDATA_FILE_ALIGNMENT == 1
+static const unsigned int dummy_align__status_z_axis_svg_gz = 24;
+#endif
+static const unsigned char FSDATA_ALIGN_PRE data__status_z_axis_svg_gz[] FSDATA_ALIGN_POST = {
+    /* /status_z_axis.svg (19 chars) */
+    0x2f,
+    0x73,
+    0x74,
+    0x61,
+    0x74,
+    0x75,
+    0x73,
+    0x5f,
+    0x7a,
+    0x5f,
+    0x61,
+    0x78,
+    0x69,
+    0x73,
+    0x2e,
+    0x73,
+    0x76,
+    0x67,
+    0x00,
+    0x00,
+
+    /* HTTP header */
+    /* "HTTP/1.1 200 OK\r\n" (17 bytes) */
+    0x48,
+    0x54,
+    0x54,
+    0x50,
+    0x2f,
+    0x31,
+    0x2e,
+    0x31,
+    0x20,
+    0x32,
+    0x30,
+    0x30,
+    0x20,
+    0x4f,
+    0x4b,
+    0x0d,
+    0x0a,
+    /* "Server: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\n" (63 bytes) */
+    0x53,
+    0x65,
+    0x72,
+    0x76,
+    0x65,
+    0x72,
+    0x3a,
+    0x20,
+    0x6c,
+    0x77,
+    0x49,
+    0x50,
+    0x2f,
+    0x32,
+    0x2e,
+    0x31,
+    0x2e,
+    0x32,
+    0x20,
+    0x28,
+    0x68,
+    0x74,
+    0x74,
+    0x70,
+    0x3a,
+    0x2f,
+    0x2f,
+    0x73,
+    0x61,
+    0x76,
+    0x61,
+    0x6e,
+    0x6e,
+    0x61,
+    0x68,
+    0x2e,
+    0x6e,
+    0x6f,
+    0x6e,
+    0x67,
+    0x6e,
+    0x75,
+    0x2e,
+    0x6f,
+    0x72,
+    0x67,
+    0x2f,
+    0x70,
+    0x72,
+    0x6f,
+    0x6a,
+    0x65,
+    0x63,
+    0x74,
+    0x73,
+    0x2f,
+    0x6c,
+    0x77,
+    0x69,
+    0x70,
+    0x29,
+    0x0d,
+    0x0a,
+    /* "Content-Length: 317\r\n" (21 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x4c,
+    0x65,
+    0x6e,
+    0x67,
+    0x74,
+    0x68,
+    0x3a,
+    0x20,
+    0x33,
+    0x31,
+    0x37,
+    0x0d,
+    0x0a,
+    /* "ETag: \"3868038abd6de822-gz\"\r\n" (29 bytes) */
+    0x45,
+    0x54,
+    0x61,
+    0x67,
+    0x3a,
+    0x20,
+    0x22,
+    0x33,
+    0x38,
+    0x36,
+    0x38,
+    0x30,
+    0x33,
+    0x38,
+    0x61,
+    0x62,
+    0x64,
+    0x36,
+    0x64,
+    0x65,
+    0x38,
+    0x32,
+    0x32,
+    0x2d,
+    0x67,
+    0x7a,
+    0x22,
+    0x0d,
+    0x0a,
+    /* "Cache-Control: no-cache\r\n" (25 bytes) */
+    0x43,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x2d,
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x72,
+    0x6f,
+    0x6c,
+    0x3a,
+    0x20,
+    0x6e,
+    0x6f,
+    0x2d,
+    0x63,
+    0x61,
+    0x63,
+    0x68,
+    0x65,
+    0x0d,
+    0x0a,
+    /* "Vary: Accept-Encoding\r\n" (23 bytes) */
+    0x56,
+    0x61,
+    0x72,
+    0x79,
+    0x3a,
+    0x20,
+    0x41,
+    0x63,
+    0x63,
+    0x65,
+    0x70,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x0d,
+    0x0a,
+    /* "Content-Encoding: gzip\r\n" (24 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x45,
+    0x6e,
+    0x63,
+    0x6f,
+    0x64,
+    0x69,
+    0x6e,
+    0x67,
+    0x3a,
+    0x20,
+    0x67,
+    0x7a,
+    0x69,
+    0x70,
+    0x0d,
+    0x0a,
+    /* "Content-Type: image/svg+xml\r\n\r\n" (31 bytes) */
+    0x43,
+    0x6f,
+    0x6e,
+    0x74,
+    0x65,
+    0x6e,
+    0x74,
+    0x2d,
+    0x54,
+    0x79,
+    0x70,
+    0x65,
+    0x3a,
+    0x20,
+    0x69,
+    0x6d,
+    0x61,
+    0x67,
+    0x65,
+    0x2f,
+    0x73,
+    0x76,
+    0x67,
+    0x2b,
+    0x78,
+    0x6d,
+    0x6c,
+    0x0d,
+    0x0a,
+    0x0d,
+    0x0a,
+    /* raw file data (317 bytes) */
+    0x1f,
+    0x8b,
+    0x08,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x00,
+    0x02,
+    0x03,
+    0x5d,
+    0x51,
+    0xc9,
+    0x6e,
+    0x83,
+    0x40,
+    0x0c,
+    0xbd,
+    0xf7,
+    0x2b,
+    0xac,
+    0xe9,
+    0x19,
+    0x33,
+    0xc3,
+    0xac,
+    0x54,
+    0x21,
+    0x87,
+    0x9e,
+    0x72,
+    0x48,
+    0xa4,
+    0xf6,
+    0x92,
+    0x3b,
+    0x0a,
+    0x03,
+    0x33,
+    0x12,
+    0x9b,
+    0x60,
+    0x02,
+    0x29,
+    0x5f,
+    0x5f,
+    0x20,
+    0x52,
+    0xa5,
+    0xd4,
+    0x07,
+    0x2f,
+    0xd2,
+    0xb3,
+    0xdf,
+    0xb3,
+    0x7d,
+    0x18,
+    0xa7,
+    0xea,
+    0x0d,
+    0x56,
+    0x7b,
+    0x34,
+    0x75,
+    0x3b,
+    0x66,
+    0xc4,
+    0x85,
+    0xd0,
+    0x7f,
+    0xc4,
+    0xf1,
+    0x3c,
+    0xcf,
+    0x38,
+    0x73,
+    0xec,
+    0x86,
+    0x2a,
+    0x4e,
+    0x28,
+    0xa5,
+    0xf1,
+    0x8a,
+    0x22,
+    0x30,
+    0xfb,
+    0x22,
+    0xb8,
+    0x8c,
+    0x70,
+    0x85,
+    0x52,
+    0x08,
+    0x02,
+    0xce,
+    0xfa,
+    0xca,
+    0x85,
+    0x67,
+    0xcd,
+    0x08,
+    0x4c,
+    0xde,
+    0xce,
+    0x9f,
+    0xdd,
+    0x23,
+    0x23,
+    0x14,
+    0x28,
+    0x24,
+    0x54,
+    0xa2,
+    0x31,
+    0x7b,
+    0x50,
+    0x29,
+    0x81,
+    0xd1,
+    0xe5,
+    0xbd,
+    0x8d,
+    0x06,
+    0xdb,
+    0x16,
+    0x76,
+    0xf0,
+    0x6d,
+    0x95,
+    0x91,
+    0xca,
+    0x76,
+    0x8d,
+    0x0d,
+    0x83,
+    0xbf,
+    0x7d,
+    0x0d,
+    0xf6,
+    0xe6,
+    0x47,
+    0xdf,
+    0xb5,
+    0x04,
+    0x7c,
+    0x93,
+    0x57,
+    0x2f,
+    0xa0,
+    0xae,
+    0x0f,
+    0xbe,
+    0xf1,
+    0x8b,
+    0xfd,
+    0xbe,
+    0xe7,
+    0xb5,
+    0x0f,
+    0x3f,
+    0x04,
+    0x4a,
+    0x5f,
+    0xd7,
+    0xd1,
+    0x70,
+    0xaf,
+    0x6d,
+    0x46,
+    0xec,
+    0x64,
+    0xdb,
+    0xae,
+    0x28,
+    0xc8,
+    0x71,
+    0x17,
+    0x7f,
+    0xe8,
+    0xf3,
+    0xe0,
+    0xa0,
+    0xc8,
+    0xc8,
+    0x85,
+    0xa7,
+    0x48,
+    0x05,
+    0x68,
+    0x86,
+    0x4c,
+    0x9c,
+    0xa5,
+    0x40,
+    0x06,
+    0x52,
+    0x21,
+    0xd5,
+    0xb5,
+    0x30,
+    0x68,
+    0x04,
+    0x88,
+    0x14,
+    0x75,
+    0x02,
+    0x5b,
+    0x1e,
+    0x3d,
+    0x53,
+    0x26,
+    0x91,
+    0xaa,
+    0xdd,
+    0xeb,
+    0x48,
+    0x71,
+    0x34,
+    0x0a,
+    0x94,
+    0x40,
+    0x6d,
+    0x96,
+    0x27,
+    0x55,
+    0x46,
+    0xde,
+    0x6d,
+    0xa9,
+    0x4b,
+    0x96,
+    0x93,
+    0xf8,
+    0x3f,
+    0x8d,
+    0x56,
+    0x1b,
+    0x78,
+    0x25,
+    0x50,
+    0xc9,
+    0x99,
+    0x31,
+    0x0e,
+    0x8c,
+    0x62,
+    0x7a,
+    0xd2,
+    0x1a,
+    0x8d,
+    0xbc,
+    0x52,
+    0xb7,
+    0xce,
+    0x96,
+    0x53,
+    0x8a,
+    0x5c,
+    0xd7,
+    0x11,
+    0x97,
+    0x20,
+    0x38,
+    0x6a,
+    0xee,
+    0xb8,
+    0xc4,
+    0x44,
+    0x5e,
+    0x95,
+    0x38,
+    0xed,
+    0x9d,
+    0xcb,
+    0x85,
+    0x02,
+    0x5b,
+    0xe1,
+    0x89,
+    0x7b,
+    0x1e,
+    0x6a,
+    0x4a,
+    0x0c,
+    0xca,
+    0x13,
+    0x5d,
+    0x5e,
+    0x56,
+    0x6c,
+    0xbb,
+    0x76,
+    0xb1,
+    0x43,
+    0xf7,
+    0xa7,
+    0xa5,
+    0xdc,
+    0x6d,
+    0xd3,
+    0x72,
+    0xd8,
+    0xfe,
+    0x71,
+    0x7c,
+    0xfb,
+    0x05,
+    0xde,
+    0xe4,
+    0x3b,
+    0x8e,
+    0xbc,
+    0x01,
+    0x00,
+    0x00,
+};
+
+const struct fsdata_file file__404_html[] = { {
+    file_NULL,
+    data__404_html,
+    data__404_html + 12,
+    sizeof(data__404_html) - 12,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__connect_black_svg[] = { {
+    file__404_html,
+    data__connect_black_svg,
+    data__connect_black_svg + 20,
+    sizeof(data__connect_black_svg) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__favicon_ico[] = { {
+    file__connect_black_svg,
+    data__favicon_ico,
+    data__favicon_ico + 16,
+    sizeof(data__favicon_ico) - 16,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__index_css[] = { {
+    file__favicon_ico,
+    data__index_css,
+    data__index_css + 12,
+    sizeof(data__index_css) - 12,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__index_html[] = { {
+    file__index_css,
+    data__index_html,
+    data__index_html + 12,
+    sizeof(data__index_html) - 12,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__index_js[] = { {
+    file__index_html,
+    data__index_js,
+    data__index_js + 12,
+    sizeof(data__index_js) - 12,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_filament_svg[] = { {
+    file__index_js,
+    data__status_filament_svg,
+    data__status_filament_svg + 24,
+    sizeof(data__status_filament_svg) - 24,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_heatbed_svg[] = { {
+    file__status_filament_svg,
+    data__status_heatbed_svg,
+    data__status_heatbed_svg + 20,
+    sizeof(data__status_heatbed_svg) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_nozzle_svg[] = { {
+    file__status_heatbed_svg,
+    data__status_nozzle_svg,
+    data__status_nozzle_svg + 20,
+    sizeof(data__status_nozzle_svg) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_prnflow_svg[] = { {
+    file__status_nozzle_svg,
+    data__status_prnflow_svg,
+    data__status_prnflow_svg + 20,
+    sizeof(data__status_prnflow_svg) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_prnspeed_svg[] = { {
+    file__status_prnflow_svg,
+    data__status_prnspeed_svg,
+    data__status_prnspeed_svg + 24,
+    sizeof(data__status_prnspeed_svg) - 24,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_z_axis_svg[] = { {
+    file__status_prnspeed_svg,
+    data__status_z_axis_svg,
+    data__status_z_axis_svg + 20,
+    sizeof(data__status_z_axis_svg) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__under_construction_gif[] = { {
+    file__status_z_axis_svg,
+    data__under_construction_gif,
+    data__under_construction_gif + 24,
+    sizeof(data__under_construction_gif) - 24,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__under_construction_png[] = { {
+    file__under_construction_gif,
+    data__under_construction_png,
+    data__under_construction_png + 24,
+    sizeof(data__under_construction_png) - 24,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__connect_black_svg_gz[] = { {
+    file_NULL,
+    data__connect_black_svg_gz,
+    data__connect_black_svg_gz + 20,
+    sizeof(data__connect_black_svg_gz) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__favicon_ico_gz[] = { {
+    file_NULL,
+    data__favicon_ico_gz,
+    data__favicon_ico_gz + 16,
+    sizeof(data__favicon_ico_gz) - 16,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__index_css_gz[] = { {
+    file_NULL,
+    data__index_css_gz,
+    data__index_css_gz + 12,
+    sizeof(data__index_css_gz) - 12,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__index_html_gz[] = { {
+    file_NULL,
+    data__index_html_gz,
+    data__index_html_gz + 12,
+    sizeof(data__index_html_gz) - 12,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__index_js_gz[] = { {
+    file_NULL,
+    data__index_js_gz,
+    data__index_js_gz + 12,
+    sizeof(data__index_js_gz) - 12,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_filament_svg_gz[] = { {
+    file_NULL,
+    data__status_filament_svg_gz,
+    data__status_filament_svg_gz + 24,
+    sizeof(data__status_filament_svg_gz) - 24,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_heatbed_svg_gz[] = { {
+    file_NULL,
+    data__status_heatbed_svg_gz,
+    data__status_heatbed_svg_gz + 20,
+    sizeof(data__status_heatbed_svg_gz) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_nozzle_svg_gz[] = { {
+    file_NULL,
+    data__status_nozzle_svg_gz,
+    data__status_nozzle_svg_gz + 20,
+    sizeof(data__status_nozzle_svg_gz) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_prnflow_svg_gz[] = { {
+    file_NULL,
+    data__status_prnflow_svg_gz,
+    data__status_prnflow_svg_gz + 20,
+    sizeof(data__status_prnflow_svg_gz) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_prnspeed_svg_gz[] = { {
+    file_NULL,
+    data__status_prnspeed_svg_gz,
+    data__status_prnspeed_svg_gz + 24,
+    sizeof(data__status_prnspeed_svg_gz) - 24,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_file file__status_z_axis_svg_gz[] = { {
+    file_NULL,
+    data__status_z_axis_svg_gz,
+    data__status_z_axis_svg_gz + 20,
+    sizeof(data__status_z_axis_svg_gz) - 20,
+    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,
+} };
+
+const struct fsdata_asset fs_assets[] = {
+    {
+        "/connect_black.svg",
+        "f13d5c73495d4ac4",
+        file__connect_black_svg,
+        file__connect_black_svg_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"f13d5c73495d4ac4\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"f13d5c73495d4ac4-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/favicon.ico",
+        "b11ac9211b1b4c83",
+        file__favicon_ico,
+        file__favicon_ico_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"b11ac9211b1b4c83\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"b11ac9211b1b4c83-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/index.css",
+        "65f1feb59a68ba6e",
+        file__index_css,
+        file__index_css_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"65f1feb59a68ba6e\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"65f1feb59a68ba6e-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/index.html",
+        "55dd5b995735a2aa",
+        file__index_html,
+        file__index_html_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"55dd5b995735a2aa\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"55dd5b995735a2aa-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/index.js",
+        "b384c5099a5ae9b4",
+        file__index_js,
+        file__index_js_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"b384c5099a5ae9b4\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"b384c5099a5ae9b4-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/status_filament.svg",
+        "bf4304377e0c28dc",
+        file__status_filament_svg,
+        file__status_filament_svg_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"bf4304377e0c28dc\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"bf4304377e0c28dc-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/status_heatbed.svg",
+        "2331944d34c268f2",
+        file__status_heatbed_svg,
+        file__status_heatbed_svg_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"2331944d34c268f2\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"2331944d34c268f2-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/status_nozzle.svg",
+        "8763b121352f782c",
+        file__status_nozzle_svg,
+        file__status_nozzle_svg_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"8763b121352f782c\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"8763b121352f782c-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/status_prnflow.svg",
+        "3421ef843737549f",
+        file__status_prnflow_svg,
+        file__status_prnflow_svg_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"3421ef843737549f\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"3421ef843737549f-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/status_prnspeed.svg",
+        "e5c3462962924e8a",
+        file__status_prnspeed_svg,
+        file__status_prnspeed_svg_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"e5c3462962924e8a\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"e5c3462962924e8a-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/status_z_axis.svg",
+        "3868038abd6de822",
+        file__status_z_axis_svg,
+        file__status_z_axis_svg_gz,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"3868038abd6de822\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"3868038abd6de822-gz\"\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n\r\n",
+    },
+    {
+        "/under_construction.gif",
+        "02b14f7614ef4d5e",
+        file__under_construction_gif,
+        file_NULL,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"02b14f7614ef4d5e\"\r\nCache-Control: no-cache\r\n\r\n",
+        NULL,
+    },
+    {
+        "/under_construction.png",
+        "ec88499d97ea5e95",
+        file__under_construction_png,
+        file_NULL,
+        "HTTP/1.1 304 Not Modified\r\nServer: lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)\r\nETag: \"ec88499d97ea5e95\"\r\nCache-Control: no-cache\r\n\r\n",
+        NULL,
+    },
+};
 
-#define FS_ROOT     file__under_construction_png
-#define FS_NUMFILES 14
+#define FS_ROOT      file__under_construction_png
+#define FS_NUMFILES  14
+#define FS_NUMASSETS 13
@@ -11,6 +11,7 @@
 #include "marlin_client.h"
 #include "lwip.h"
 #include "ethernetif.h"
+#include "wui_upload.h"
 
 #include "cmsis_os.h"
 
@@ -23,6 +24,7 @@ marlin_vars_t webserver_marlin_vars;
 void StartWebServerTask(void const *argument) {
     wui_web_mutex_id = osMutexCreate(osMutex(wui_web_mutex));
     wui_marlin_vars = marlin_client_init(); // init the client
+    wui_upload_init();
     MX_LWIP_Init();
     http_server_init();
     for (;;) {
@@ -31,9 +33,11 @@ void StartWebServerTask(void const *argument) {
         if (wui_marlin_vars) {
             marlin_client_loop();
         }
+        // consistent set of variables (client copy is updated one variable per message),
+        // copied under server lock straight to the web server copy
         osMutexWait(wui_web_mutex_id, osWaitForever);
-        webserver_marlin_vars = *wui_marlin_vars;
+        marlin_get_snapshot_vars(&webserver_marlin_vars);
         osMutexRelease(wui_web_mutex_id);
-        osDelay(100);
+        wui_upload_cycle(100); // file writes for http upload, otherwise same as osDelay
     }
 }
@@ -10,32 +10,146 @@
 
 #include "wui.h"
 #include "filament.h"
+#include "sysprof.h"
+#include "wui_upload.h"
 
 #include "cmsis_os.h"
 #include "stdarg.h"
-
-#define BDY_WUI_API_BUFFER_SIZE 512
-#define BDY_NO_FS_FLAGS         0  // no flags for fs_open
-#define BDY_API_PRINTER_LEN     12 // length of "/api/printer" string
-#define BDY_API_JOB_LEN         8  // length of "/api/job" string
-#define X_AXIS_POS              0
-#define Y_AXIS_POS              1
-#define Z_AXIS_POS              2
+#include "lwip/stats.h"
+
+#define BDY_API_FS_FLAGS     (FS_FILE_FLAGS_HEADER_PERSISTENT | WUI_API_FS_FLAGS_VOLATILE) // Content-Length (keep-alive), tcp_write copies _buffer
+#define BDY_API_PRINTER_LEN  12 // length of "/api/printer" string
+#define BDY_API_JOB_LEN      8  // length of "/api/job" string
+#define BDY_API_SYSINFO_LEN  12 // length of "/api/sysinfo" string
+#define BDY_API_UPLOAD_LEN   11 // length of "/api/upload" string
+#define BDY_API_NETSTATS_LEN 13 // length of "/api/netstats" string
+#define X_AXIS_POS           0
+#define Y_AXIS_POS           1
+#define Z_AXIS_POS           2
 
 static marlin_vars_t webserver_marlin_vars_copy;
-// for storing /api/* data
-static struct fs_file api_file;
-static char _buffer[BDY_WUI_API_BUFFER_SIZE];
+// for storing /api/* data, buffer of the connection being served (http_state), set by wui_api_main
+// every connection has its own buffer: response larger than TCP_SND_BUF is queued by more tcp_writes
+// and its unsent tail must not be overwritten by requests on other connections
+static char *_buffer = NULL;
 
 static int char_streamer(const char *format, ...) {
     int rv = 0;
     va_list args;
     va_start(args, format);
-    rv = vsnprintf(_buffer, BDY_WUI_API_BUFFER_SIZE, format, args);
+    rv = vsnprintf(_buffer, WUI_API_BUFFER_SIZE, format, args);
     va_end(args);
     return rv;
 }
 
+// append to _buffer at position len, returns new length
+static int char_streamer_append(int len, const char *format, ...) {
+    int rv = 0;
+    va_list args;
+    if ((len < 0) || (len >= WUI_API_BUFFER_SIZE))
+        return len;
+    va_start(args, format);
+    rv = vsnprintf(_buffer + len, WUI_API_BUFFER_SIZE - len, format, args);
+    va_end(args);
+    if (rv < 0)
+        return len;
+    len += rv;
+    return (len < WUI_API_BUFFER_SIZE) ? len : (WUI_API_BUFFER_SIZE - 1);
+}
+
+static void wui_api_sysinfo(struct fs_file *file) {
+    static sysprof_t prof; // not on stack
+    int i;
+    sysprof_get(&prof);
+
+    int response_len = char_streamer("{"
+                                     "\"seq\":%lu,"
+                                     "\"cpu\":%u.%u,"
+                                     "\"tick_isr\":{\"load\":%u.%u, \"avg_us\":%u.%u, \"max_us\":%u.%u},"
+                                     "\"heap\":{\"size\":%lu, \"free\":%lu, \"min_free\":%lu, \"max_block\":%lu},"
+                                     "\"queues\":{\"marlin\":%u, \"marlin_max\":%u, \"client\":[",
+        (unsigned long)prof.seq,
+        prof.cpu / 10, prof.cpu % 10,
+        prof.isr_load / 10, prof.isr_load % 10,
+        prof.isr_avg / 10, prof.isr_avg % 10,
+        prof.isr_max / 10, prof.isr_max % 10,
+        (unsigned long)prof.heap_size, (unsigned long)prof.heap_free,
+        (unsigned long)prof.heap_min_free, (unsigned long)prof.heap_max_block,
+        prof.server_queue, prof.server_queue_max);
+    for (i = 0; i < MARLIN_MAX_CLIENTS; i++)
+        response_len = char_streamer_append(response_len, "%s%u", i ? "," : "", prof.client_queue[i]);
+    response_len = char_streamer_append(response_len, "], \"client_max\":[");
+    for (i = 0; i < MARLIN_MAX_CLIENTS; i++)
+        response_len = char_streamer_append(response_len, "%s%u", i ? "," : "", prof.client_queue_max[i]);
+    response_len = char_streamer_append(response_len, "]}, \"tasks\":[");
+    for (i = 0; i < prof.task_count; i++)
+        response_len = char_streamer_append(response_len,
+            "%s{\"name\":\"%s\", \"cpu\":%u.%u, \"stack_free\":%u, \"prio\":%u}",
+            i ? "," : "", prof.task[i].name, prof.task[i].cpu / 10, prof.task[i].cpu % 10,
+            prof.task[i].stack_free, prof.task[i].priority);
+    response_len = char_streamer_append(response_len, "]}");
+    file->len = response_len;
+    file->data = _buffer;
+    file->index = response_len;
+    file->pextension = NULL;
+    file->flags = BDY_API_FS_FLAGS;
+}
+
+static void wui_api_upload(struct fs_file *file) {
+    wui_upload_status_t status;
+    wui_upload_get_status(&status);
+
+    int response_len = char_streamer("{"
+                                     "\"file\":\"%s\","
+                                     "\"state\":\"%s\","
+                                     "\"result\":%u,"
+                                     "\"size\":%lu, \"received\":%lu, \"written\":%lu,"
+                                     "\"time_ms\":%lu, \"rate_kBs\":%lu"
+                                     "}",
+        status.name,
+        wui_upload_state_name(status.state),
+        status.result,
+        (unsigned long)status.size, (unsigned long)status.received, (unsigned long)status.written,
+        (unsigned long)status.time, (unsigned long)(status.time ? (status.written / status.time) : 0));
+    file->len = response_len;
+    file->data = _buffer;
+    file->index = response_len;
+    file->pextension = NULL;
+    file->flags = BDY_API_FS_FLAGS;
+}
+
+#if LWIP_STATS
+// lwIP heap and pool usage since boot, err counts failed allocations (exhaustion)
+// pools are identified by memp index, name is added when lwIP keeps it
+static void wui_api_netstats(struct fs_file *file) {
+    const struct stats_mem *mem = &lwip_stats.mem;
+    int i;
+    int response_len = char_streamer("{"
+                                     "\"heap\":{\"avail\":%lu, \"used\":%lu, \"max\":%lu, \"err\":%lu},"
+                                     "\"tcp\":{\"xmit\":%lu, \"recv\":%lu, \"drop\":%lu, \"memerr\":%lu},"
+                                     "\"pools\":[",
+        (unsigned long)mem->avail, (unsigned long)mem->used, (unsigned long)mem->max, (unsigned long)mem->err,
+        (unsigned long)lwip_stats.tcp.xmit, (unsigned long)lwip_stats.tcp.recv,
+        (unsigned long)lwip_stats.tcp.drop, (unsigned long)lwip_stats.tcp.memerr);
+    for (i = 0; i < MEMP_MAX; i++) {
+        mem = lwip_stats.memp[i];
+        response_len = char_streamer_append(response_len, "%s{\"index\":%d,", i ? "," : "", i);
+    #if defined(LWIP_DEBUG) || LWIP_STATS_DISPLAY // pool names are compiled in only for stats display
+        if (mem->name)
+            response_len = char_streamer_append(response_len, "\"name\":\"%s\",", mem->name);
+    #endif // LWIP_DEBUG || LWIP_STATS_DISPLAY
+        response_len = char_streamer_append(response_len, "\"avail\":%lu,\"used\":%lu,\"max\":%lu,\"err\":%lu}",
+            (unsigned long)mem->avail, (unsigned long)mem->used, (unsigned long)mem->max, (unsigned long)mem->err);
+    }
+    response_len = char_streamer_append(response_len, "]}");
+    file->len = response_len;
+    file->data = _buffer;
+    file->index = response_len;
+    file->pextension = NULL;
+    file->flags = BDY_API_FS_FLAGS;
+}
+#endif // LWIP_STATS
+
 static void wui_api_job(struct fs_file *file) {
 
     const char *file_name = "test.gcode";
@@ -51,10 +165,10 @@ static void wui_api_job(struct fs_file *file) {
         print_duration,
         sd_percent_done);
     file->len = response_len;
-    file->data = (const char *)&_buffer;
+    file->data = _buffer;
     file->index = response_len;
     file->pextension = NULL;
-    file->flags = BDY_NO_FS_FLAGS;
+    file->flags = BDY_API_FS_FLAGS;
 }
 
 static void wui_api_printer(struct fs_file *file) {
@@ -69,6 +183,8 @@ static void wui_api_printer(struct fs_file *file) {
     double z_pos_mm = (double)webserver_marlin_vars_copy.pos[Z_AXIS_POS];
     uint16_t print_speed = (uint16_t)(webserver_marlin_vars_copy.print_speed);
     uint16_t flow_factor = (uint16_t)(webserver_marlin_vars_copy.flow_factor);
+    uint16_t hotend_fan_rpm = webserver_marlin_vars_copy.fan_rpm[0];
+    uint16_t print_fan_rpm = webserver_marlin_vars_copy.fan_rpm[1];
     const char *filament_material = filaments[get_filament()].name;
 
     int response_len = char_streamer(
@@ -78,37 +194,50 @@ static void wui_api_printer(struct fs_file *file) {
         "\"xyz_pos_mm\":{"
         "\"x\":%.2f, \"y\":%.2f, \"z\":%.2f},"
         "\"print_settings\":{"
-        "\"printing_speed\":%hd, \"flow_factor\":%hd, \"filament_material\":\"%s\"} }",
+        "\"printing_speed\":%hd, \"flow_factor\":%hd, \"filament_material\":\"%s\"},"
+        "\"fan_rpm\":{"
+        "\"hotend\":%hu, \"print\":%hu} }",
 
         actual_nozzle, target_nozzle, actual_heatbed, target_heatbed,
         x_pos_mm, y_pos_mm, z_pos_mm, print_speed, flow_factor,
-        filament_material);
+        filament_material, hotend_fan_rpm, print_fan_rpm);
     file->len = response_len;
-    file->data = (const char *)&_buffer;
+    file->data = _buffer;
     file->index = response_len;
     file->pextension = NULL;
-    file->flags = BDY_NO_FS_FLAGS; // http server adds response header
+    file->flags = BDY_API_FS_FLAGS; // http server adds response header
 }
 
-struct fs_file *wui_api_main(char *uri, struct fs_file *file) {
+struct fs_file *wui_api_main(char *uri, struct fs_file *file, char *buffer) {
 
     osStatus status = osMutexWait(wui_web_mutex_id, osWaitForever);
     if (status == osOK) {
         webserver_marlin_vars_copy = webserver_marlin_vars;
     }
     osMutexRelease(wui_web_mutex_id);
-    file = &api_file;
+    _buffer = buffer;
     file->len = 0;
     file->data = NULL;
     file->index = 0;
     file->pextension = NULL;
-    file->flags = BDY_NO_FS_FLAGS; // http server adds response header
+    file->flags = BDY_API_FS_FLAGS; // http server adds response header
     if (!strncmp(uri, "/api/printer", BDY_API_PRINTER_LEN) && (BDY_API_PRINTER_LEN == strlen(uri))) {
         wui_api_printer(file);
         return file;
     } else if (!strncmp(uri, "/api/job", BDY_API_JOB_LEN) && (BDY_API_JOB_LEN == strlen(uri))) {
         wui_api_job(file);
         return file;
+    } else if (!strncmp(uri, "/api/sysinfo", BDY_API_SYSINFO_LEN) && (BDY_API_SYSINFO_LEN == strlen(uri))) {
+        wui_api_sysinfo(file);
+        return file;
+    } else if (!strncmp(uri, WUI_UPLOAD_RESPONSE_URI, BDY_API_UPLOAD_LEN) && ((uri[BDY_API_UPLOAD_LEN] == 0) || (uri[BDY_API_UPLOAD_LEN] == '/'))) { // "/<status code>" after POST
+        wui_api_upload(file);
+        return file;
+#if LWIP_STATS
+    } else if (!strncmp(uri, "/api/netstats", BDY_API_NETSTATS_LEN) && (BDY_API_NETSTATS_LEN == strlen(uri))) {
+        wui_api_netstats(file);
+        return file;
+#endif // LWIP_STATS
     }
     return NULL;
 }
@@ -19,11 +19,18 @@
 extern "C" {
 #endif
 
+// fs_file flag of api responses: data in buffer of the connection (overwritten by its next request), must be copied by tcp_write
+#define WUI_API_FS_FLAGS_VOLATILE 0x80
+
+#define WUI_API_BUFFER_SIZE 1536 // response buffer of http connection, /api/sysinfo with all tasks
+
 // for data exchange between wui thread and HTTP thread
 extern marlin_vars_t webserver_marlin_vars;
 extern osMutexId wui_web_mutex_id;
 
-struct fs_file *wui_api_main(char *uri, struct fs_file *file);
+// response of api request in file, body is written to buffer (WUI_API_BUFFER_SIZE) of the connection,
+// returns NULL for unknown uri
+struct fs_file *wui_api_main(char *uri, struct fs_file *file, char *buffer);
 
 #ifdef __cplusplus
 }
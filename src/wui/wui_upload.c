@@ -0,0 +1,301 @@
+/*
+ * wui_upload.c
+ * \brief   streaming file upload (HTTP POST) from WUI to USB flash
+ *
+ * tcpip thread (httpd_post_xxx callbacks) copies received pbufs into one of
+ * two sector aligned buffers, full buffer is passed to webserver thread and
+ * written by single f_write (whole sectors go directly to the disk). Received
+ * data are acknowledged (TCP window opened) only when they fit into a free
+ * buffer, so the sender is throttled by the USB write speed. The response is
+ * delayed until the file is closed.
+ */
+
+#include "wui_upload.h"
+
+#include "httpd.h"
+#include "lwip/tcpip.h"
+#include "lwip/pbuf.h"
+#include "lwip/def.h"
+#include "ff.h"
+#include "cmsis_os.h"
+#include "stm32f4xx_hal.h"
+#include <string.h>
+#include <stdio.h>
+
+#define WUI_UPLOAD_BUF_SIZE  4096 // multiple of sector size
+#define WUI_UPLOAD_BUF_COUNT 2    // one buffer is filled while the other is written
+#define WUI_UPLOAD_QUEUE_LEN 4    // max. queued commands are open, write, close/abort
+
+// writer commands, message value is command | buffer << 8, callback adds result << 16
+#define WUI_UPLOAD_CMD_OPEN  0
+#define WUI_UPLOAD_CMD_WRITE 1
+#define WUI_UPLOAD_CMD_CLOSE 2
+#define WUI_UPLOAD_CMD_ABORT 3 // close and remove file
+
+typedef struct _wui_upload_t {
+    void *connection;     // http connection, NULL when not receiving
+    struct pbuf *pending; // received data not copied to buffers (not acknowledged)
+    uint32_t start;       // tick of upload begin
+    uint32_t held;        // copied data acknowledged after file is closed (delays response)
+    uint16_t fill;        // bytes in buffer being filled
+    uint8_t buf;          // index of buffer being filled
+    uint8_t commands;     // commands queued to writer
+    uint8_t writing;      // write command queued (the other buffer is busy)
+    uint8_t closing;      // close/abort command queued
+} wui_upload_t;
+
+osMessageQDef(wui_upload_queue, WUI_UPLOAD_QUEUE_LEN, uint32_t);
+static osMessageQId wui_upload_queue = 0;
+
+// tcpip thread
+static wui_upload_t wui_upload;
+static wui_upload_status_t wui_upload_status;
+
+// shared, written by tcpip thread before the command is queued
+static char wui_upload_path[WUI_UPLOAD_NAME_LEN + 2];
+static uint16_t wui_upload_len[WUI_UPLOAD_BUF_COUNT];
+static uint8_t wui_upload_buf[WUI_UPLOAD_BUF_COUNT][WUI_UPLOAD_BUF_SIZE] __attribute__((aligned(4)));
+
+// webserver thread
+static FIL wui_upload_file;
+static uint8_t wui_upload_opened = 0;
+static FRESULT wui_upload_result = FR_OK; // first error of current upload
+
+static const char *wui_upload_state_names[] = {
+    "idle",
+    "busy",
+    "done",
+    "error",
+    "aborted",
+};
+
+static void wui_upload_done(void *arg);
+
+//-----------------------------------------------------------------------------
+// webserver thread
+
+void wui_upload_init(void) {
+    wui_upload_queue = osMessageCreate(osMessageQ(wui_upload_queue), NULL);
+}
+
+void wui_upload_cycle(uint32_t timeout) {
+    osEvent event = osMessageGet(wui_upload_queue, timeout);
+    UINT bw;
+    if (event.status != osEventMessage)
+        return;
+    const uint8_t cmd = event.value.v & 0xff;
+    const uint8_t buf = (event.value.v >> 8) & 0xff;
+    switch (cmd) {
+    case WUI_UPLOAD_CMD_OPEN:
+        wui_upload_result = f_open(&wui_upload_file, wui_upload_path, FA_WRITE | FA_CREATE_ALWAYS);
+        wui_upload_opened = (wui_upload_result == FR_OK);
+        break;
+    case WUI_UPLOAD_CMD_WRITE:
+        if (wui_upload_result == FR_OK) {
+            wui_upload_result = f_write(&wui_upload_file, wui_upload_buf[buf], wui_upload_len[buf], &bw);
+            if ((wui_upload_result == FR_OK) && (bw != wui_upload_len[buf]))
+                wui_upload_result = FR_DENIED; // disk full
+        }
+        break;
+    case WUI_UPLOAD_CMD_CLOSE:
+    case WUI_UPLOAD_CMD_ABORT:
+        if (wui_upload_opened) {
+            const FRESULT result = f_close(&wui_upload_file);
+            if (wui_upload_result == FR_OK)
+                wui_upload_result = result;
+            if ((wui_upload_result != FR_OK) || (cmd == WUI_UPLOAD_CMD_ABORT))
+                f_unlink(wui_upload_path); // incomplete file
+            wui_upload_opened = 0;
+        }
+        break;
+    }
+    // tcpip mbox can be full for a while
+    while (tcpip_callback(wui_upload_done, (void *)(uintptr_t)(event.value.v | ((uint32_t)wui_upload_result << 16))) != ERR_OK)
+        osDelay(1);
+}
+
+//-----------------------------------------------------------------------------
+// tcpip thread
+
+static void wui_upload_submit(uint8_t cmd, uint8_t buf) {
+    wui_upload.commands++;
+    osMessagePut(wui_upload_queue, cmd | ((uint32_t)buf << 8), 0);
+}
+
+static void wui_upload_submit_write(void) {
+    wui_upload_len[wui_upload.buf] = wui_upload.fill;
+    wui_upload.writing = 1;
+    wui_upload_submit(WUI_UPLOAD_CMD_WRITE, wui_upload.buf);
+    wui_upload.buf = (wui_upload.buf + 1) % WUI_UPLOAD_BUF_COUNT;
+    wui_upload.fill = 0;
+}
+
+// open TCP window, last acknowledge finishes the POST (httpd_post_finished)
+static void wui_upload_recved(uint32_t len) {
+    while (len && wui_upload.connection) {
+        const u16_t n = (len > 0xffff) ? 0xffff : len;
+        len -= n;
+        httpd_post_data_recved(wui_upload.connection, n);
+    }
+}
+
+static void wui_upload_set_error(uint8_t state, uint8_t result) {
+    if (wui_upload_status.state != WUI_UPLOAD_BUSY)
+        return; // keep first error
+    wui_upload_status.state = state;
+    wui_upload_status.result = result;
+}
+
+// copy pending data to buffers, queue full buffers and close when complete
+static void wui_upload_consume(void) {
+    struct pbuf *p;
+    uint32_t copied = 0;
+    while ((p = wui_upload.pending) != NULL) {
+        u16_t len = LWIP_MIN(p->len, wui_upload_status.size - wui_upload_status.received);
+        if ((wui_upload_status.state == WUI_UPLOAD_BUSY) && len) {
+            if (wui_upload.fill == WUI_UPLOAD_BUF_SIZE) {
+                if (wui_upload.writing)
+                    break; // both buffers are busy, TCP window stays closed
+                wui_upload_submit_write();
+            }
+            len = LWIP_MIN(len, WUI_UPLOAD_BUF_SIZE - wui_upload.fill);
+            memcpy(wui_upload_buf[wui_upload.buf] + wui_upload.fill, p->payload, len);
+            wui_upload.fill += len;
+        } // after error data are discarded
+        wui_upload_status.received += len;
+        if ((len < p->len) && (wui_upload_status.received < wui_upload_status.size)) {
+            pbuf_remove_header(p, len); // buffer full
+            copied += len;
+        } else {
+            copied += p->len; // including data beyond Content-Length
+            wui_upload.pending = p->next;
+            p->next = NULL;
+            pbuf_free(p);
+        }
+    }
+    if (wui_upload_status.received < wui_upload_status.size) {
+        wui_upload_recved(copied);
+        return;
+    }
+    wui_upload.held += copied;
+    if (wui_upload.closing || wui_upload.writing)
+        return;
+    if (wui_upload_status.state == WUI_UPLOAD_BUSY) {
+        if (wui_upload.fill)
+            wui_upload_submit_write();
+        wui_upload_submit(WUI_UPLOAD_CMD_CLOSE, 0);
+    } else
+        wui_upload_submit(WUI_UPLOAD_CMD_ABORT, 0);
+    wui_upload.closing = 1;
+}
+
+// writer command finished (called by tcpip_callback)
+static void wui_upload_done(void *arg) {
+    const uint32_t value = (uint32_t)(uintptr_t)arg;
+    const uint8_t cmd = value & 0xff;
+    const uint8_t buf = (value >> 8) & 0xff;
+    const uint8_t result = (value >> 16) & 0xff;
+    wui_upload.commands--;
+    if (result != FR_OK)
+        wui_upload_set_error(WUI_UPLOAD_ERROR, result);
+    switch (cmd) {
+    case WUI_UPLOAD_CMD_WRITE:
+        if (result == FR_OK)
+            wui_upload_status.written += wui_upload_len[buf];
+        wui_upload.writing = 0;
+        if (wui_upload.connection)
+            wui_upload_consume();
+        break;
+    case WUI_UPLOAD_CMD_CLOSE:
+    case WUI_UPLOAD_CMD_ABORT:
+        if (wui_upload_status.state == WUI_UPLOAD_BUSY)
+            wui_upload_status.state = WUI_UPLOAD_DONE;
+        wui_upload_status.time = HAL_GetTick() - wui_upload.start;
+        wui_upload_recved(wui_upload.held); // sends response
+        wui_upload.held = 0;
+        break;
+    }
+}
+
+static int wui_upload_name_valid(const char *name) {
+    const size_t len = strlen(name);
+    if ((len == 0) || (len > WUI_UPLOAD_NAME_LEN) || (name[0] == '.'))
+        return 0;
+    for (; *name; name++)
+        if ((*name < ' ') || strchr("/\\:*?\"<>|%", *name))
+            return 0;
+    return 1;
+}
+
+err_t httpd_post_begin(void *connection, const char *uri, const char *http_request,
+    u16_t http_request_len, int content_len, char *response_uri,
+    u16_t response_uri_len, u8_t *post_auto_wnd) {
+    LWIP_UNUSED_ARG(http_request);
+    LWIP_UNUSED_ARG(http_request_len);
+    if (strncmp(uri, WUI_UPLOAD_URI, strlen(WUI_UPLOAD_URI)) != 0) {
+        snprintf(response_uri, response_uri_len, "/404.html");
+        return ERR_ARG;
+    }
+    if (wui_upload.connection || wui_upload.commands) {
+        snprintf(response_uri, response_uri_len, WUI_UPLOAD_RESPONSE_BUSY);
+        return ERR_INPROGRESS; // one upload at a time, status of current one is returned
+    }
+    const char *name = uri + strlen(WUI_UPLOAD_URI);
+    memset(&wui_upload, 0, sizeof(wui_upload));
+    memset(&wui_upload_status, 0, sizeof(wui_upload_status));
+    strncpy(wui_upload_status.name, name, WUI_UPLOAD_NAME_LEN);
+    wui_upload_status.size = content_len;
+    if (!wui_upload_name_valid(name) || (content_len <= 0)) {
+        wui_upload_status.state = WUI_UPLOAD_ERROR;
+        snprintf(response_uri, response_uri_len, WUI_UPLOAD_RESPONSE_INVALID);
+        return ERR_ARG;
+    }
+    wui_upload_status.state = WUI_UPLOAD_BUSY;
+    wui_upload.connection = connection;
+    wui_upload.start = HAL_GetTick();
+    snprintf(wui_upload_path, sizeof(wui_upload_path), "/%s", name);
+    wui_upload_submit(WUI_UPLOAD_CMD_OPEN, 0);
+    *post_auto_wnd = 0; // window is opened by wui_upload_recved
+    return ERR_OK;
+}
+
+err_t httpd_post_receive_data(void *connection, struct pbuf *p) {
+    if (connection != wui_upload.connection) {
+        pbuf_free(p);
+        return ERR_VAL;
+    }
+    if (wui_upload.pending)
+        pbuf_cat(wui_upload.pending, p);
+    else
+        wui_upload.pending = p;
+    wui_upload_consume();
+    return ERR_OK;
+}
+
+void httpd_post_finished(void *connection, char *response_uri, u16_t response_uri_len) {
+    // called after last data are acknowledged (file closed), or when connection is lost
+    snprintf(response_uri, response_uri_len, (wui_upload_status.state == WUI_UPLOAD_DONE) ? WUI_UPLOAD_RESPONSE_OK : WUI_UPLOAD_RESPONSE_FAILED);
+    if (connection != wui_upload.connection)
+        return;
+    wui_upload.connection = NULL;
+    if (wui_upload.pending) {
+        pbuf_free(wui_upload.pending);
+        wui_upload.pending = NULL;
+    }
+    if (wui_upload.closing)
+        return; // regular finish after close, or connection lost while closing (file is complete)
+    // connection closed before all data were received
+    wui_upload_set_error(WUI_UPLOAD_ABORTED, FR_OK);
+    wui_upload_submit(WUI_UPLOAD_CMD_ABORT, 0);
+    wui_upload.closing = 1;
+}
+
+void wui_upload_get_status(wui_upload_status_t *status) {
+    *status = wui_upload_status;
+    if (wui_upload_status.state == WUI_UPLOAD_BUSY)
+        status->time = HAL_GetTick() - wui_upload.start;
+}
+
+const char *wui_upload_state_name(uint8_t state) {
+    return (state <= WUI_UPLOAD_STATE_MAX) ? wui_upload_state_names[state] : "";
+}
@@ -0,0 +1,68 @@
+/*
+ * wui_upload.h
+ * \brief   streaming file upload (HTTP POST) from WUI to USB flash
+ *
+ * Body of "POST /api/files/<name>" is collected in sector aligned buffers by
+ * the http server (tcpip thread) and written to USB by the webserver thread.
+ * TCP window is opened only for data that fits in free buffers, so upload
+ * speed is limited by the USB write speed without buffering in heap.
+ */
+
+#ifndef _WUI_UPLOAD_H_
+#define _WUI_UPLOAD_H_
+
+#include <inttypes.h>
+
+#define WUI_UPLOAD_URI          "/api/files/" // POST prefix, followed by file name
+#define WUI_UPLOAD_RESPONSE_URI "/api/upload" // GET upload status (json)
+#define WUI_UPLOAD_NAME_LEN     48            // max. length of file name (without leading '/')
+
+// POST response is upload status with http status code in uri (see get_http_headers)
+#define WUI_UPLOAD_RESPONSE_OK      WUI_UPLOAD_RESPONSE_URI        // 200, file written
+#define WUI_UPLOAD_RESPONSE_INVALID WUI_UPLOAD_RESPONSE_URI "/400" // invalid file name or empty body
+#define WUI_UPLOAD_RESPONSE_BUSY    WUI_UPLOAD_RESPONSE_URI "/409" // other upload in progress
+#define WUI_UPLOAD_RESPONSE_FAILED  WUI_UPLOAD_RESPONSE_URI "/500" // USB error or disk full
+
+#define WUI_UPLOAD_IDLE      0 // no upload since boot
+#define WUI_UPLOAD_BUSY      1 // receiving/writing
+#define WUI_UPLOAD_DONE      2 // file written and closed
+#define WUI_UPLOAD_ERROR     3 // invalid request, USB error or disk full (file removed)
+#define WUI_UPLOAD_ABORTED   4 // connection closed before complete (file removed)
+#define WUI_UPLOAD_STATE_MAX WUI_UPLOAD_ABORTED
+
+#pragma pack(push)
+#pragma pack(1)
+
+typedef struct _wui_upload_status_t {
+    char name[WUI_UPLOAD_NAME_LEN + 1]; // file name
+    uint8_t state;                      // WUI_UPLOAD_xxx
+    uint8_t result;                     // FatFS result of failed operation (FRESULT)
+    uint32_t size;                      // Content-Length [bytes]
+    uint32_t received;                  // bytes received [bytes]
+    uint32_t written;                   // bytes written to USB [bytes]
+    uint32_t time;                      // duration of upload [ms]
+} wui_upload_status_t;
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// create writer queue, call from webserver thread before http_server_init
+extern void wui_upload_init(void);
+
+// wait up to timeout [ms] for writer command and execute it (webserver thread)
+extern void wui_upload_cycle(uint32_t timeout);
+
+// copy upload status (tcpip thread)
+extern void wui_upload_get_status(wui_upload_status_t *status);
+
+// state name for json
+extern const char *wui_upload_state_name(uint8_t state);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif /* _WUI_UPLOAD_H_ */
@@ -29,3 +29,12 @@ def pytest_addoption(parser):
                      type="string",
                      default=API_KEY,
                      help="HTTP API KEY")
+    parser.addoption("--benchmark",
+                     action="store_true",
+                     default=False,
+                     help="Run load and latency benchmark")
+    parser.addoption("--benchmark-time",
+                     action="store",
+                     type=float,
+                     default=10.0,
+                     help="Duration of one benchmark run [s]")
@@ -0,0 +1,135 @@
+# load and latency benchmark of the web stack (httpd, fs, wui_api)
+# run with --benchmark against the tapif build with -DLWIP_STATS=1
+from concurrent.futures import ThreadPoolExecutor
+from threading import Event
+from time import perf_counter, sleep
+
+from requests import Session
+from requests.exceptions import RequestException
+
+import pytest
+
+CLIENTS = 4  # MEMP_NUM_PARALLEL_HTTPD_CONNS
+POLL_INTERVAL = 0.05  # WUI polls /api/printer every 1s, test 20x more
+
+
+@pytest.fixture
+def url(request):
+    if not request.config.option.benchmark:
+        pytest.skip("benchmark is enabled with --benchmark")
+    return request.config.option.url
+
+
+@pytest.fixture
+def duration(request):
+    return request.config.option.benchmark_time
+
+
+def netstats(url):
+    """lwIP heap and pool statistics, None when built without LWIP_STATS."""
+    req = Session().get(url + "/api/netstats")
+    return req.json() if req.status_code == 200 else None
+
+
+def percentile(values, pct):
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * pct / 100))]
+
+
+def client(url, uri, stop, interval=0):
+    """Request uri until stop is set, returns (latencies, bytes, failures)."""
+    session = Session()
+    latencies = []
+    size = failures = 0
+    while not stop.is_set():
+        start = perf_counter()
+        try:
+            req = session.get(url + uri)
+            if req.status_code == 200:
+                latencies.append(perf_counter() - start)
+                size += len(req.content)
+            else:
+                failures += 1
+        except RequestException:
+            failures += 1
+            session = Session()  # connection refused or reset
+        if interval:
+            sleep(interval)
+    return latencies, size, failures
+
+
+def run(url, clients, duration):
+    """Run clients [(uri, interval)] in parallel, print and return report."""
+    before = netstats(url)
+    stop = Event()
+    with ThreadPoolExecutor(len(clients)) as pool:
+        start = perf_counter()
+        futures = [
+            pool.submit(client, url, uri, stop, interval)
+            for uri, interval in clients
+        ]
+        sleep(duration)
+        stop.set()
+        results = [future.result() for future in futures]
+        elapsed = perf_counter() - start
+    after = netstats(url)
+
+    latencies = [lat for result in results for lat in result[0]]
+    size = sum(result[1] for result in results)
+    failures = sum(result[2] for result in results)
+    assert latencies, "no successful request"
+    report = {
+        "requests": len(latencies),
+        "failures": failures,
+        "req_s": len(latencies) / elapsed,
+        "kB_s": size / elapsed / 1024,
+        "p50_ms": percentile(latencies, 50) * 1000,
+        "p99_ms": percentile(latencies, 99) * 1000,
+    }
+    print("\n%(requests)d requests, %(failures)d failed, %(req_s).1f req/s, "
+          "%(kB_s).1f kB/s, p50 %(p50_ms).1f ms, p99 %(p99_ms).1f ms" % report)
+    if before and after:
+        # max is high-water mark since boot, err is counted per run
+        report["heap_max"] = after["heap"]["max"]
+        report["heap_err"] = after["heap"]["err"] - before["heap"]["err"]
+        print("heap: max %d of %d, %d failed allocations" %
+              (after["heap"]["max"], after["heap"]["avail"],
+               report["heap_err"]))
+        for prev, pool in zip(before["pools"], after["pools"]):
+            # name is present only when lwIP is built with stats display
+            name = pool.get("name", str(pool["index"]))
+            err = pool["err"] - prev["err"]
+            report["pool_err_" + name] = err
+            if err or pool["max"] == pool["avail"]:
+                print("pool %s: max %d of %d, %d exhausted" %
+                      (name, pool["max"], pool["avail"], err))
+    return report
+
+
+class TestBenchmark:
+    def test_api_polling(self, url, duration):
+        report = run(url, [("/api/printer", POLL_INTERVAL),
+                           ("/api/job", POLL_INTERVAL)], duration)
+        assert report["failures"] == 0
+        assert report.get("heap_err", 0) == 0
+
+    @pytest.mark.parametrize("uri", ["/index.js", "/index.html"])
+    def test_static(self, url, duration, uri):
+        report = run(url, [(uri, 0)] * CLIENTS, duration)
+        assert report["failures"] == 0
+        assert report.get("heap_err", 0) == 0
+
+    def test_mixed(self, url, duration):
+        # large transfers must not starve api polling of the WUI
+        report = run(url, [("/index.js", 0)] * (CLIENTS - 1) +
+                     [("/api/printer", POLL_INTERVAL)], duration)
+        assert report["failures"] == 0
+        assert report.get("heap_err", 0) == 0
+
+    def test_overload(self, url, duration):
+        # more clients than httpd connections, refused connections are
+        # expected, but the server must recover and allocations must not fail
+        run(url, [("/index.js", 0)] * (2 * CLIENTS), duration)
+        report = run(url, [("/api/printer", 0)], 1)
+        assert report["failures"] == 0
+        assert report.get("heap_err", 0) == 0
@@ -0,0 +1,83 @@
+# integrity test for persistent connections and request pipelining
+from socket import create_connection
+from time import time
+from urllib.parse import urlparse
+
+from requests import Session
+
+import pytest
+
+REQUESTS = 50
+
+
+@pytest.fixture
+def url(request):
+    return request.config.option.url
+
+
+@pytest.fixture
+def session():
+    return Session()
+
+
+def read_response(sock, buf):
+    """Read one Content-Length framed response, returns (head, body, rest)."""
+    while b"\r\n\r\n" not in buf:
+        data = sock.recv(4096)
+        assert data, "connection closed"
+        buf += data
+    head, buf = buf.split(b"\r\n\r\n", 1)
+    length = 0
+    for line in head.split(b"\r\n")[1:]:
+        name, value = line.split(b":", 1)
+        if name.strip().lower() == b"content-length":
+            length = int(value)
+    while len(buf) < length:
+        data = sock.recv(4096)
+        assert data, "connection closed"
+        buf += data
+    return head, buf[:length], buf[length:]
+
+
+class TestKeepAlive:
+    @pytest.mark.parametrize("uri", ["/api/printer", "/index.js"])
+    def test_reuse(self, url, session, uri):
+        start = time()
+        for _ in range(REQUESTS):
+            # identity: Content-Length is the length of the decoded content
+            req = session.get(url + uri,
+                              headers={"Accept-Encoding": "identity"})
+            assert req.status_code == 200
+            assert req.headers["Connection"] == "keep-alive"
+            assert int(req.headers["Content-Length"]) == len(req.content)
+        pool = session.get_adapter(url).poolmanager.connection_from_url(url)
+        # new connection is opened only when the server closed the previous one
+        print("%s: %.1f req/s, %d connections" %
+              (uri, REQUESTS / (time() - start), pool.num_connections))
+        assert pool.num_connections == 1
+
+    def test_pipelining(self, url):
+        location = urlparse(url)
+        request = ("GET %%s HTTP/1.1\r\nHost: %s\r\n"
+                   "Connection: keep-alive\r\n\r\n" % location.netloc)
+        uris = ["/api/printer", "/index.html", "/api/job", "/api/sysinfo"]
+        with create_connection(
+            (location.hostname, location.port or 80), timeout=5) as sock:
+            # all requests in one segment
+            sock.sendall("".join(request % uri for uri in uris).encode())
+            buf = b""
+            for uri in uris:
+                head, body, buf = read_response(sock, buf)
+                assert b" 200 OK" in head.split(b"\r\n")[0], uri
+                assert body
+            assert not buf
+
+    @pytest.mark.parametrize("uri", ["/api/job", "/index.html"])
+    def test_close(self, url, uri):
+        location = urlparse(url)
+        with create_connection(
+            (location.hostname, location.port or 80), timeout=5) as sock:
+            sock.sendall(b"GET %s HTTP/1.0\r\n\r\n" % uri.encode())
+            head, body, buf = read_response(sock, b"")
+            assert b"keep-alive" not in head
+            assert not sock.recv(4096)  # closed by server
@@ -0,0 +1,44 @@
+# integrity test for precompressed static assets and ETag revalidation
+from requests import Session
+
+import pytest
+
+
+@pytest.fixture
+def url(request):
+    return request.config.option.url
+
+
+@pytest.fixture
+def session():
+    return Session()
+
+
+class TestStaticAssets:
+    @pytest.mark.parametrize("uri", ["/index.html", "/index.js"])
+    def test_gzip(self, url, session, uri):
+        plain = session.get(url + uri, headers={"Accept-Encoding": "identity"})
+        assert plain.status_code == 200
+        assert "Content-Encoding" not in plain.headers
+        packed = session.get(url + uri, headers={"Accept-Encoding": "gzip"})
+        assert packed.status_code == 200
+        assert packed.headers["Content-Encoding"] == "gzip"
+        assert packed.headers["Vary"] == "Accept-Encoding"
+        # bytes on the wire vs. decoded content
+        assert int(packed.headers["Content-Length"]) < len(plain.content)
+        assert packed.content == plain.content
+
+    def test_not_modified(self, url, session):
+        req = session.get(url + "/index.js")
+        etag = req.headers["ETag"]
+        assert req.headers["Cache-Control"] == "no-cache"
+        req = session.get(url + "/index.js", headers={"If-None-Match": etag})
+        assert req.status_code == 304
+        assert req.headers["ETag"] == etag
+        assert not req.content
+
+    def test_modified(self, url, session):
+        req = session.get(url + "/index.js",
+                          headers={"If-None-Match": '"0000000000000000"'})
+        assert req.status_code == 200
+        assert req.content
@@ -0,0 +1,42 @@
+# integrity test for streaming file upload to USB flash
+from os import urandom
+
+from requests import Session
+
+import pytest
+
+
+@pytest.fixture
+def api_url(request):
+    return request.config.option.url + "/api"
+
+
+@pytest.fixture
+def session():
+    return Session()
+
+
+class TestUpload:
+    @pytest.mark.parametrize("size", [1, 4096, 100 * 1024 + 7])
+    def test_upload(self, api_url, session, size):
+        data = urandom(size)
+        req = session.post(api_url + "/files/upload_test.gcode",
+                           data=data,
+                           headers={"Content-Type": "application/octet-stream"})
+        assert req.status_code == 200
+        status = req.json()
+        assert status["file"] == "upload_test.gcode"
+        assert status["state"] == "done"
+        assert status["size"] == size
+        assert status["written"] == size
+        print("%d bytes, %d kB/s" % (size, status["rate_kBs"]))
+
+    def test_upload_status(self, api_url, session):
+        req = session.get(api_url + "/upload")
+        assert req.status_code == 200
+        assert req.json()["state"] in ("idle", "done", "error", "aborted")
+
+    def test_invalid_name(self, api_url, session):
+        req = session.post(api_url + "/files/..", data=b"G28\n")
+        assert req.status_code == 400
+        assert req.json()["state"] == "error"
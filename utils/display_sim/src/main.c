@@ -0,0 +1,86 @@
+//display_sim - main.c
+//renders a test screen with the in-memory framebuffer display (same code path
+//as the gui on target), checks pixels and optionally saves it to png
+//usage: display_sim [output.png]
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "display_sim.h"
+#include "res/cc/font_11x18.c"
+#include "res/cc/png_statusscreen_icon_nozzle.c"
+
+#define IDR_FNT_NORMAL             0x0001
+#define IDR_PNG_status_icon_nozzle 0x0002
+
+RESOURCE_TABLE_BEGIN
+RESOURCE_ENTRY_NUL()
+RESOURCE_ENTRY_FNT(font_11x18)
+RESOURCE_ENTRY_PNG(png_statusscreen_icon_nozzle)
+RESOURCE_TABLE_END
+
+display_t *display = (display_t *)&display_sim;
+
+static int errors = 0;
+
+static void check_pixel(uint16_t x, uint16_t y, color_t clr) {
+    color_t px = display_sim_get_pixel(point_ui16(x, y));
+    if (px != (clr & 0x00ffffff)) {
+        printf("pixel [%u, %u] is %06x, expected %06x\n", x, y, (unsigned)px, (unsigned)(clr & 0x00ffffff));
+        errors++;
+    }
+}
+
+static void render(void) {
+    font_t *pf = resource_font(IDR_FNT_NORMAL);
+    display->clear(COLOR_BLACK);
+    display->fill_rect(rect_ui16(0, 0, 240, 24), COLOR_ORANGE);
+    display->draw_text(rect_ui16(10, 3, 220, 18), "display_sim", pf, COLOR_ORANGE, COLOR_BLACK);
+    display->draw_rect(rect_ui16(10, 40, 220, 100), COLOR_WHITE);
+    display->draw_line(point_ui16(10, 40), point_ui16(229, 139), COLOR_RED);
+    display->draw_icon(point_ui16(20, 160), IDR_PNG_status_icon_nozzle, COLOR_BLACK, 0);
+    display->draw_text(rect_ui16(60, 160, 170, 40), "215/215\nABCxyz{}", pf, COLOR_BLACK, COLOR_WHITE);
+}
+
+int main(int argc, char **argv) {
+    const int frames = 100;
+    uint32_t pixels;
+    clock_t clk;
+    int i;
+    display->init();
+    display_sim_reset_stats();
+    render();
+    pixels = display_sim_pixel_count();
+    //primitives
+    check_pixel(0, 0, COLOR_ORANGE);
+    check_pixel(239, 23, COLOR_ORANGE);
+    check_pixel(0, 24, COLOR_BLACK);
+    check_pixel(10, 90, COLOR_WHITE);
+    check_pixel(229, 90, COLOR_WHITE);
+    check_pixel(120, 139, COLOR_WHITE);
+    check_pixel(10, 40, COLOR_RED);
+    check_pixel(229, 139, COLOR_WHITE); //line end point is excluded (as st7789v)
+    check_pixel(239, 319, COLOR_BLACK);
+    //top row of character cell is background
+    check_pixel(60, 160, COLOR_BLACK);
+    check_pixel(60 + 7 * 11 - 1, 160, COLOR_BLACK);
+    //expected pixel count: 240x320 clear, 240x24 header, 11 chars header, 2 lines 8 chars text,
+    //2x 220 + 2x 100 rectangle, 220 pixel line, icon
+    if (pixels < (240 * 320 + 240 * 24 + (11 + 16) * 11 * 18 + 2 * 220 + 2 * 100 + 220)) {
+        printf("pixel count %u too low\n", (unsigned)pixels);
+        errors++;
+    }
+    //rendering speed
+    clk = clock();
+    for (i = 0; i < frames; i++)
+        render();
+    clk = clock() - clk;
+    printf("%u pixels/frame, %.3f ms/frame\n", (unsigned)pixels, 1000.0 * clk / CLOCKS_PER_SEC / frames);
+    if ((argc > 1) && !display_sim_save_png(argv[1])) {
+        printf("cannot save %s\n", argv[1]);
+        errors++;
+    }
+    display->done();
+    return errors ? 1 : 0;
+}
@@ -31,12 +31,114 @@ void dump_free(dump_t *pd) {
     pd->flash = 0;
 }
 
+int dump_unpack_rle(const uint8_t *src, uint32_t src_size, uint8_t *dst, uint32_t dst_size) {
+    uint32_t is = 0;
+    uint32_t id = 0;
+    uint32_t cnt;
+    uint8_t ctl;
+    while ((is < src_size) && (id < dst_size)) {
+        ctl = src[is++];
+        if (ctl & 0x80) {
+            cnt = (ctl & 0x7f) + DUMP_RLE_RUN_MIN;
+            if (is >= src_size)
+                break;
+            while (cnt-- && (id < dst_size))
+                dst[id++] = src[is];
+            is++;
+        } else {
+            cnt = ctl + 1;
+            while (cnt-- && (is < src_size) && (id < dst_size))
+                dst[id++] = src[is++];
+        }
+    }
+    return id;
+}
+
+static int dump_load_v2(dump_t *pd, FILE *fdump_bin) {
+    dump_hdr_t hdr;
+    uint8_t *packed;
+    uint8_t *p;
+    uint32_t i;
+    uint32_t size;
+    uint32_t max_size;
+    uint32_t data_size;
+    if (fread(&hdr, 1, sizeof(hdr), fdump_bin) != sizeof(hdr))
+        return 0;
+    if (hdr.version == DUMP_INCOMPLETE) {
+        //incomplete dump contains whole slot, only entries of finished sections are programmed
+        printf("incomplete dump v2 seq=%u (fault during dump)\n", hdr.seq);
+        hdr.flags = DUMP_FLAG_RLE;
+        hdr.size = DUMP_SLOT_SIZE;
+        hdr.count = DUMP_SECT_MAX;
+    } else if (hdr.version == DUMP_VERSION)
+        printf("dump v2 seq=%u tick=%u size=%u sections=%u%s\n", hdr.seq, hdr.tick, hdr.size, hdr.count,
+            (hdr.flags & DUMP_FLAG_TRUNCATED) ? " TRUNCATED" : "");
+    else {
+        printf("unknown dump version 0x%04x (seq %u)\n", hdr.version, hdr.seq);
+        return 0;
+    }
+    if ((packed = (uint8_t *)malloc(hdr.size)) == 0)
+        return 0;
+    fseek(fdump_bin, 0, SEEK_SET);
+    if (fread(packed, 1, hdr.size, fdump_bin) != hdr.size) {
+        free(packed);
+        return 0;
+    }
+    memset(pd->ram, 0, DUMP_RAM_SIZE);
+    memset(pd->ccram, 0, DUMP_CCRAM_SIZE);
+    for (i = 0; (i < hdr.count) && (i < DUMP_SECT_MAX); i++) {
+        dump_sect_t *psect = hdr.sect + i;
+        //sections are finished in table order, erased entry - this and following ones were not written
+        if ((psect->addr == 0xffffffff) || (psect->size == 0xffffffff) || (psect->offset == 0xffffffff) || (psect->packed == 0xffffffff)) {
+            printf("warning: section %u and following not written, dump is incomplete\n", i);
+            break;
+        }
+        if ((p = dump_get_data_ptr(pd, psect->addr)) == 0)
+            continue;
+        if ((psect->offset + psect->packed) > hdr.size)
+            continue;
+        //limit to end of memory area
+        max_size = (psect->addr < DUMP_RAM_ADDR) ? (DUMP_CCRAM_ADDR + DUMP_CCRAM_SIZE - psect->addr) : (DUMP_RAM_ADDR + DUMP_RAM_SIZE - psect->addr);
+        size = (psect->size < max_size) ? psect->size : max_size;
+        if (hdr.flags & DUMP_FLAG_RLE)
+            data_size = dump_unpack_rle(packed + psect->offset, psect->packed, p, size);
+        else {
+            data_size = (psect->packed < size) ? psect->packed : size;
+            memcpy(p, packed + psect->offset, data_size);
+        }
+        printf(" section %u: addr=0x%08x size=%u packed=%u%s\n", i, psect->addr, psect->size, psect->packed,
+            (data_size < psect->size) ? " (incomplete)" : "");
+    }
+    free(packed);
+    //OTP and FLASH follow, aligned to sector size
+    fseek(fdump_bin, (hdr.size + DUMP_SECTOR_SIZE - 1) & ~(DUMP_SECTOR_SIZE - 1), SEEK_SET);
+    if (fread(pd->otp, 1, DUMP_OTP_SIZE, fdump_bin) != DUMP_OTP_SIZE)
+        return 0;
+    if (fread(pd->flash, 1, DUMP_FLASH_SIZE, fdump_bin) != DUMP_FLASH_SIZE)
+        return 0;
+    return 1;
+}
+
 dump_t *dump_load(const char *fn) {
     dump_t *pd;
+    uint32_t magic = 0;
     if ((pd = dump_alloc()) == 0)
         return 0;
     FILE *fdump_bin = fopen(fn, "rb");
     if (fdump_bin) {
+        fread(&magic, 1, sizeof(magic), fdump_bin);
+        fseek(fdump_bin, 0, SEEK_SET);
+        if (magic == DUMP_MAGIC) {
+            int ok = dump_load_v2(pd, fdump_bin);
+            fclose(fdump_bin);
+            if (ok) {
+                pd->regs_gen = (dump_regs_gen_t *)dump_get_data_ptr(pd, DUMP_REGS_GEN);
+                pd->regs_scb = dump_get_data_ptr(pd, DUMP_REGS_SCB);
+                return pd;
+            }
+            dump_free(pd);
+            return 0;
+        }
         int rd_ram = fread(pd->ram, 1, DUMP_RAM_SIZE, fdump_bin);
         int rd_ccram = fread(pd->ccram, 1, DUMP_CCRAM_SIZE, fdump_bin);
         int rd_otp = fread(pd->otp, 1, DUMP_OTP_SIZE, fdump_bin);
@@ -5,6 +5,10 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#ifndef MAX_PATH
+    #define MAX_PATH 260 // windows.h value
+#endif //MAX_PATH
+
 #define DUMP_RAM_ADDR   0x20000000
 #define DUMP_RAM_SIZE   0x00020000
 #define DUMP_CCRAM_ADDR 0x10000000
@@ -17,6 +21,19 @@
 #define DUMP_REGS_GEN 0x1000ff00
 #define DUMP_REGS_SCB 0x1000ff60
 
+// dump v2 (compressed, with section table)
+#define DUMP_MAGIC          0x32504d44 // "DMP2"
+#define DUMP_VERSION        0x0002
+#define DUMP_INCOMPLETE     0xffff // version of dump interrupted by fault, header not programmed
+#define DUMP_SLOT_SIZE      0x10000
+#define DUMP_SECTOR_SIZE    0x200
+#define DUMP_SECT_MAX       8
+#define DUMP_FLAG_RLE       0x01
+#define DUMP_FLAG_TRUNCATED 0x02
+#define DUMP_RLE_RUN_MIN    3
+#define DUMP_RLE_RUN_MAX    (0x7f + DUMP_RLE_RUN_MIN)
+#define DUMP_RLE_LIT_MAX    0x80
+
 #pragma pack(push)
 #pragma pack(1)
 
@@ -71,6 +88,25 @@ typedef struct _dump_tcb_t {
     char pcTaskName[16];
 } dump_tcb_t;
 
+typedef struct _dump_sect_t {
+    uint32_t addr;
+    uint32_t size;
+    uint32_t offset;
+    uint32_t packed;
+} dump_sect_t;
+
+typedef struct _dump_hdr_t {
+    uint32_t magic;
+    uint32_t seq;
+    uint16_t version;
+    uint8_t type;
+    uint8_t flags;
+    uint32_t tick;
+    uint32_t size;
+    uint32_t count;
+    dump_sect_t sect[DUMP_SECT_MAX];
+} dump_hdr_t;
+
 #pragma pack(pop)
 
 typedef struct _dump_t {
@@ -90,6 +126,8 @@ extern void dump_free(dump_t *pd);
 
 extern dump_t *dump_load(const char *fn);
 
+extern int dump_unpack_rle(const uint8_t *src, uint32_t src_size, uint8_t *dst, uint32_t dst_size);
+
 extern int dump_load_all_sections(dump_t *pd, const char *dir);
 
 extern int dump_save_all_sections(dump_t *pd, const char *dir);
@@ -7,7 +7,7 @@
 #include "dump.h"
 #include "mapfile.h"
 
-#define _TEST
+//#define _TEST
 //#define _PRINTER "MI"
 //#define _PRINTER "MQ"
 #define _PRINTER "ND"
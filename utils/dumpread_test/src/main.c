@@ -0,0 +1,175 @@
+//dumpread_test - main.c
+//host round-trip test of utils/dumpread/src/dump.c on generated v2 dumps:
+//memory areas are rle packed the same way as src/common/dump.c does, saved
+//like dump_save_to_usb (slot, OTP, FLASH) and loaded back with dump_load,
+//complete dump and dump interrupted after some sections are both checked
+//usage: dumpread_test [dump_file]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dump.h"
+
+#define PAGE_SIZE 0x100 // header page, packed data follows
+#define SECT_CNT  5
+#define DONE_CNT  3 // finished sections of incomplete dump
+
+static int errors = 0;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            errors++;                                                       \
+        }                                                                   \
+    } while (0)
+
+// dumped areas as in dump_to_xflash: registers, globals, heap, main stack, ccram
+static const uint32_t sect_addr[SECT_CNT] = { DUMP_REGS_GEN, DUMP_RAM_ADDR, 0x20006000, 0x2001e800, DUMP_CCRAM_ADDR };
+static const uint32_t sect_size[SECT_CNT] = { 0x100, 0x6000, 0x1800, 0x1800, 0x3000 };
+
+static uint8_t ram[DUMP_RAM_SIZE];
+static uint8_t ccram[DUMP_CCRAM_SIZE];
+static uint8_t slot[DUMP_SLOT_SIZE];
+static uint32_t slot_pos;
+
+static uint8_t *mem_ptr(uint32_t addr) {
+    return (addr < DUMP_RAM_ADDR) ? (ccram + addr - DUMP_CCRAM_ADDR) : (ram + addr - DUMP_RAM_ADDR);
+}
+
+// random data, zeroed globals, 0xa5 stack fill - literal and repeat runs of all lengths
+static void mem_fill(void) {
+    uint32_t i;
+    srand(1);
+    for (i = 0; i < DUMP_RAM_SIZE; i++)
+        ram[i] = ((i / 0x400) % 3 == 0) ? (uint8_t)rand() : (((i / 0x400) % 3 == 1) ? 0 : (((rand() % 7) == 0) ? (uint8_t)rand() : 0xa5));
+    for (i = 0; i < DUMP_CCRAM_SIZE; i++)
+        ccram[i] = (uint8_t)((rand() % 3) ? i : 0xff);
+}
+
+static void put(uint8_t b) {
+    slot[slot_pos++] = b;
+}
+
+// same as dump_rle in src/common/dump.c
+static void pack_rle(const uint8_t *p, uint32_t size) {
+    uint32_t i = 0;
+    uint32_t run;
+    uint32_t lit;
+    while (i < size) {
+        run = 1;
+        while ((i + run < size) && (run < DUMP_RLE_RUN_MAX) && (p[i + run] == p[i]))
+            run++;
+        if (run >= DUMP_RLE_RUN_MIN) {
+            put(0x80 | (run - DUMP_RLE_RUN_MIN));
+            put(p[i]);
+            i += run;
+        } else {
+            lit = 0;
+            while ((i + lit < size) && (lit < DUMP_RLE_LIT_MAX)) {
+                if ((i + lit + 2 < size) && (p[i + lit] == p[i + lit + 1]) && (p[i + lit] == p[i + lit + 2]))
+                    break;
+                lit++;
+            }
+            put(lit - 1);
+            while (lit--)
+                put(p[i++]);
+        }
+    }
+}
+
+// slot content after dump_to_xflash, done - number of finished sections (SECT_CNT = complete dump)
+static void pack(int done) {
+    dump_hdr_t hdr;
+    int i;
+    memset(slot, 0xff, sizeof(slot));
+    memset(&hdr, 0xff, sizeof(hdr));
+    hdr.magic = DUMP_MAGIC;
+    hdr.seq = 7;
+    slot_pos = PAGE_SIZE;
+    for (i = 0; i < SECT_CNT; i++) {
+        uint32_t offset = slot_pos;
+        pack_rle(mem_ptr(sect_addr[i]), sect_size[i]);
+        if (i >= done) {
+            // unfinished section - part of its data is programmed, entry and rest of slot are erased
+            memset(slot + offset + (slot_pos - offset) / 2, 0xff, sizeof(slot) - offset - (slot_pos - offset) / 2);
+            break;
+        }
+        hdr.sect[i].addr = sect_addr[i];
+        hdr.sect[i].size = sect_size[i];
+        hdr.sect[i].offset = offset;
+        hdr.sect[i].packed = slot_pos - offset;
+    }
+    if (done == SECT_CNT) {
+        hdr.version = DUMP_VERSION;
+        hdr.type = 2;
+        hdr.flags = DUMP_FLAG_RLE;
+        hdr.tick = 12345;
+        hdr.size = slot_pos;
+        hdr.count = SECT_CNT;
+    }
+    memcpy(slot, &hdr, sizeof(hdr));
+}
+
+// as dump_save_to_usb: used part of slot (whole slot when incomplete) padded to sector, OTP, FLASH
+static int save(const char *fn, int done) {
+    uint32_t size = (done == SECT_CNT) ? ((slot_pos + DUMP_SECTOR_SIZE - 1) & ~(DUMP_SECTOR_SIZE - 1)) : DUMP_SLOT_SIZE;
+    uint8_t *p = (uint8_t *)malloc(DUMP_FLASH_SIZE);
+    uint32_t i;
+    FILE *f;
+    int ret = 0;
+    if (p == 0)
+        return 0;
+    if ((f = fopen(fn, "wb")) != 0) {
+        ret = (fwrite(slot, 1, size, f) == size);
+        for (i = 0; i < DUMP_FLASH_SIZE; i++)
+            p[i] = (uint8_t)(i ^ (i >> 8));
+        ret = ret && (fwrite(p, 1, DUMP_OTP_SIZE, f) == DUMP_OTP_SIZE);
+        ret = ret && (fwrite(p, 1, DUMP_FLASH_SIZE, f) == DUMP_FLASH_SIZE);
+        fclose(f);
+    }
+    free(p);
+    return ret;
+}
+
+static int mem_zero(const uint8_t *p, uint32_t size) {
+    while (size--)
+        if (*(p++))
+            return 0;
+    return 1;
+}
+
+static void test_dump(const char *fn, int done) {
+    dump_t *pd;
+    int i;
+    printf("%s dump, %d of %d sections\n", (done == SECT_CNT) ? "complete" : "incomplete", done, SECT_CNT);
+    pack(done);
+    CHECK(save(fn, done));
+    pd = dump_load(fn);
+    CHECK(pd != 0);
+    if (pd == 0)
+        return;
+    for (i = 0; i < SECT_CNT; i++) {
+        const uint8_t *p = dump_get_data_ptr(pd, sect_addr[i]);
+        if (i < done)
+            CHECK(memcmp(p, mem_ptr(sect_addr[i]), sect_size[i]) == 0);
+        else
+            CHECK(mem_zero(p, sect_size[i]));
+    }
+    CHECK(pd->regs_gen == (dump_regs_gen_t *)(pd->ccram + DUMP_REGS_GEN - DUMP_CCRAM_ADDR));
+    CHECK(pd->otp[0x1234] == (uint8_t)(0x1234 ^ 0x12));
+    CHECK(pd->flash[0xfedcb] == (uint8_t)(0xfedcb ^ 0xfed));
+    dump_free(pd);
+    free(pd);
+}
+
+int main(int argc, char **argv) {
+    const char *fn = (argc > 1) ? argv[1] : "dumpread_test.bin";
+    mem_fill();
+    test_dump(fn, SECT_CNT);
+    test_dump(fn, DONE_CNT);
+    test_dump(fn, 0);
+    remove(fn);
+    printf("dumpread_test: %d errors\n", errors);
+    return errors ? 1 : 0;
+}
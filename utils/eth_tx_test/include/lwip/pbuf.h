@@ -0,0 +1,19 @@
+// lwip/pbuf.h - host stub, reference counted pbufs of the test driver
+#ifndef _LWIP_PBUF_H
+#define _LWIP_PBUF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct pbuf {
+    struct pbuf *next;
+    void *payload;
+    uint16_t tot_len;
+    uint16_t len;
+    uint16_t ref;
+};
+
+extern void pbuf_ref(struct pbuf *p);
+extern uint8_t pbuf_free(struct pbuf *p);
+
+#endif //_LWIP_PBUF_H
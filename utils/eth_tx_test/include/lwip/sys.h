@@ -0,0 +1,12 @@
+// lwip/sys.h - host stub, leaving the critical section lets the model preempt
+#ifndef _LWIP_SYS_H
+#define _LWIP_SYS_H
+
+extern int sys_arch_protect(void);
+extern void sys_arch_unprotect(int lev);
+
+#define SYS_ARCH_DECL_PROTECT(lev) int lev
+#define SYS_ARCH_PROTECT(lev)      lev = sys_arch_protect()
+#define SYS_ARCH_UNPROTECT(lev)    sys_arch_unprotect(lev)
+
+#endif //_LWIP_SYS_H
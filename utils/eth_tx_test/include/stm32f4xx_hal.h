@@ -0,0 +1,31 @@
+// stm32f4xx_hal.h - host stub, ETH DMA tx descriptor (stm32f4xx_hal_eth.h)
+#ifndef _STM32F4XX_HAL_H
+#define _STM32F4XX_HAL_H
+
+#include <stdint.h>
+
+#define __IO  volatile
+#define RESET 0
+
+#define ETH_TXBUFNB ((uint32_t)4U) // stm32f4xx_hal_conf.h
+
+#define ETH_DMATXDESC_OWN  0x80000000U
+#define ETH_DMATXDESC_IC   0x40000000U
+#define ETH_DMATXDESC_LS   0x20000000U
+#define ETH_DMATXDESC_FS   0x10000000U
+#define ETH_DMATXDESC_TCH  0x00100000U
+#define ETH_DMATXDESC_TBS1 0x00001FFFU
+
+// addresses are uintptr_t instead of uint32_t on 64-bit host
+typedef struct {
+    __IO uint32_t Status;
+    uint32_t ControlBufferSize;
+    uintptr_t Buffer1Addr;
+    uintptr_t Buffer2NextDescAddr;
+} ETH_DMADescTypeDef;
+
+typedef struct {
+    ETH_DMADescTypeDef *TxDesc;
+} ETH_HandleTypeDef;
+
+#endif //_STM32F4XX_HAL_H
@@ -0,0 +1,230 @@
+//eth_tx_test - main.c
+//host model of the ETH DMA tx descriptor ring for src/common/eth_tx.c
+//tcpip thread sends frames, DMA and ethernetif thread (eth_tx_reclaim) run
+//whenever a critical section is left; DMA reads of freed pbufs are reported
+//usage: eth_tx_test [frames]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "eth_tx.h"
+
+#define DMA_RAM_START  0x20000000U // eth_tx.c accepts payloads in SRAM1 + SRAM2 only
+#define DMA_RAM_SIZE   0x20000U
+#define PBUF_SIZE      1536
+#define PBUF_COUNT     (DMA_RAM_SIZE / PBUF_SIZE)
+#define FRAME_PBUFS    5 // max. pbufs per frame (more than ETH_TXBUFNB)
+#define DEFAULT_FRAMES 100000
+
+static int errors = 0;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            errors++;                                                       \
+        }                                                                   \
+    } while (0)
+
+ETH_DMADescTypeDef DMATxDscrTab[ETH_TXBUFNB];
+static ETH_HandleTypeDef heth;
+
+//-----------------------------------------------------------------------------
+// pbufs, payloads in DMA accessible RAM or in host heap (flash/CCM)
+
+static struct pbuf pbufs[PBUF_COUNT];
+static uint8_t *dma_ram = NULL;
+static int pbufs_used = 0;
+
+static struct pbuf *pbuf_get(uint16_t len, uint8_t fill, int accessible) {
+    int i;
+    for (i = 0; i < PBUF_COUNT; i++)
+        if (pbufs[i].ref == 0) {
+            struct pbuf *p = &pbufs[i];
+            p->next = NULL;
+            p->payload = accessible ? (dma_ram + i * PBUF_SIZE) : malloc(len ? len : 1);
+            p->len = len;
+            p->tot_len = len;
+            p->ref = 1;
+            memset(p->payload, fill, len);
+            pbufs_used++;
+            return p;
+        }
+    printf("out of pbufs\n");
+    exit(1);
+}
+
+void pbuf_ref(struct pbuf *p) {
+    CHECK(p->ref > 0);
+    p->ref++;
+}
+
+uint8_t pbuf_free(struct pbuf *p) {
+    uint8_t cnt = 0;
+    while (p != NULL) {
+        struct pbuf *next = p->next;
+        if (p->ref == 0) {
+            printf("pbuf %d freed twice\n", (int)(p - pbufs));
+            errors++;
+            break;
+        }
+        if (--p->ref)
+            break;
+        if (((uint8_t *)p->payload < dma_ram) || ((uint8_t *)p->payload >= (dma_ram + DMA_RAM_SIZE)))
+            free(p->payload);
+        p->payload = NULL;
+        pbufs_used--;
+        cnt++;
+        p = next;
+    }
+    return cnt;
+}
+
+//-----------------------------------------------------------------------------
+// DMA, transmits descriptors owned by DMA and clears OWN
+
+static uint32_t dma_desc = 0;   // next descriptor processed by DMA
+static int dma_frame = -1;      // id of frame being transmitted (first byte)
+static uint32_t dma_frames = 0; // frames transmitted
+
+static void dma_run(int count) {
+    while (count-- && (DMATxDscrTab[dma_desc].Status & ETH_DMATXDESC_OWN)) {
+        ETH_DMADescTypeDef *desc = &DMATxDscrTab[dma_desc];
+        const uint8_t *data = (const uint8_t *)desc->Buffer1Addr;
+        const uint32_t len = desc->ControlBufferSize & ETH_DMATXDESC_TBS1;
+        const int i = (int)((data - dma_ram) / PBUF_SIZE);
+        uint32_t j;
+        CHECK((data >= dma_ram) && (data < (dma_ram + DMA_RAM_SIZE)));
+        if (pbufs[i].ref == 0) {
+            printf("DMA reads freed pbuf %d (descriptor %u)\n", i, dma_desc);
+            errors++;
+        }
+        if (desc->Status & ETH_DMATXDESC_FS) {
+            CHECK(dma_frame < 0);
+            dma_frame = data[0];
+        }
+        for (j = 0; j < len; j++)
+            if (data[j] != dma_frame) {
+                printf("frame %d corrupted (descriptor %u)\n", dma_frame, dma_desc);
+                errors++;
+                break;
+            }
+        if (desc->Status & ETH_DMATXDESC_LS) {
+            dma_frame = -1;
+            dma_frames++;
+        }
+        desc->Status &= ~ETH_DMATXDESC_OWN;
+        dma_desc = (dma_desc + 1) % ETH_TXBUFNB;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// critical section, DMA and ethernetif thread run when it is left
+
+static int protect_level = 0;
+static int preempting = 0;
+
+int sys_arch_protect(void) {
+    return protect_level++;
+}
+
+void sys_arch_unprotect(int lev) {
+    protect_level = lev;
+    if ((protect_level == 0) && !preempting) {
+        preempting = 1;
+        dma_run(rand() % (ETH_TXBUFNB + 1));
+        if (rand() & 1)
+            eth_tx_reclaim();
+        preempting = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void ring_init(void) {
+    uint32_t i;
+    for (i = 0; i < ETH_TXBUFNB; i++) {
+        DMATxDscrTab[i].Status = ETH_DMATXDESC_TCH;
+        DMATxDscrTab[i].Buffer2NextDescAddr = (uintptr_t)&DMATxDscrTab[(i + 1) % ETH_TXBUFNB];
+    }
+    heth.TxDesc = DMATxDscrTab;
+}
+
+static uint32_t ring_free(void) {
+    const ETH_DMADescTypeDef *desc = heth.TxDesc;
+    uint32_t n = 0;
+    while ((n < ETH_TXBUFNB) && !(desc->Status & ETH_DMATXDESC_OWN)) {
+        n++;
+        desc = (const ETH_DMADescTypeDef *)desc->Buffer2NextDescAddr;
+    }
+    return n;
+}
+
+// random pbuf chain, count of non-empty pbufs is 0 when some payload is not DMA accessible
+static struct pbuf *frame_get(uint8_t id, uint32_t *count) {
+    struct pbuf *p = NULL;
+    struct pbuf *last = NULL;
+    int accessible = 1;
+    int n = 1 + rand() % FRAME_PBUFS;
+    *count = 0;
+    while (n--) {
+        const uint16_t len = (rand() % 8) ? (1 + rand() % 1400) : 0;
+        const int in_ram = (rand() % 16) != 0;
+        struct pbuf *q = pbuf_get(len, id, in_ram);
+        if (len) {
+            (*count)++;
+            accessible &= in_ram;
+        }
+        if (last)
+            last->next = q;
+        else
+            p = q;
+        last = q;
+    }
+    for (last = p->next; last; last = last->next)
+        p->tot_len += last->len;
+    if (!accessible)
+        *count = 0;
+    return p;
+}
+
+int main(int argc, char **argv) {
+    const long frames = (argc > 1) ? atol(argv[1]) : DEFAULT_FRAMES;
+    uint32_t zero_copy = 0;
+    long n;
+    dma_ram = mmap((void *)(uintptr_t)DMA_RAM_START, DMA_RAM_SIZE, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (dma_ram != (uint8_t *)(uintptr_t)DMA_RAM_START) {
+        printf("can't map DMA RAM at 0x%08x\n", DMA_RAM_START);
+        return 1;
+    }
+    srand(1);
+    ring_init();
+    for (n = 0; n < frames; n++) {
+        const uint8_t id = (uint8_t)n;
+        uint32_t count;
+        uint32_t free_desc;
+        struct pbuf *p = frame_get(id, &count);
+        // tcpip thread, low_level_output
+        eth_tx_reclaim();
+        free_desc = ring_free(); // DMA may free more during the call
+        if (eth_tx_zero_copy(&heth, p)) {
+            CHECK(count && (count <= ETH_TXBUFNB));
+            zero_copy++;
+        } else
+            CHECK(!count || (count > free_desc));
+        pbuf_free(p); // sent, reference of the caller is released
+        // ethernetif thread
+        if (rand() & 1) {
+            dma_run(rand() % (ETH_TXBUFNB + 1));
+            eth_tx_reclaim();
+        }
+    }
+    dma_run(ETH_TXBUFNB);
+    eth_tx_reclaim();
+    CHECK(dma_frames == zero_copy);
+    CHECK(pbufs_used == 0);
+    printf("eth_tx_test: %u of %ld frames zero-copy, %d errors\n", zero_copy, frames, errors);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,8 @@
+// cmsis_os.h - host stub, single thread
+#ifndef _CMSIS_OS_H
+#define _CMSIS_OS_H
+
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+#endif //_CMSIS_OS_H
@@ -0,0 +1,138 @@
+//fast_seek_bench - main.c
+//host benchmark of src/common/gcode_fast_seek.cpp on the FatFS RAM disk:
+//gcode files with few and with many fragments are read at random positions
+//without and with a cluster link map, sector reads of both are compared, then
+//the map pool is checked (exhaustion, reuse after close without detach)
+//usage: fast_seek_bench [seeks]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "config.h"
+#include "gcode_file.h"
+#include "ramdisk.h"
+
+#define FILE_SIZE     (6 * 1024 * 1024)
+#define BLOCK_SIZE    4096
+#define DEFAULT_SEEKS 1000
+
+static int errors = 0;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            errors++;                                                       \
+        }                                                                   \
+    } while (0)
+
+static uint8_t pattern(FSIZE_t pos) {
+    return (uint8_t)(pos * 7 + pos / 997);
+}
+
+// gcode file of FILE_SIZE, one block of other file is written after every
+// interleave blocks so clusters of gcode file are not contiguous (0 - contiguous)
+static void create(const char *path, const char *other, int interleave) {
+    static uint8_t block[BLOCK_SIZE];
+    FIL fil;
+    FIL oth;
+    UINT bw;
+    FSIZE_t pos;
+    int i;
+    CHECK(f_open(&fil, path, FA_WRITE | FA_CREATE_ALWAYS) == FR_OK);
+    if (interleave)
+        CHECK(f_open(&oth, other, FA_WRITE | FA_CREATE_ALWAYS) == FR_OK);
+    for (pos = 0; pos < FILE_SIZE; pos += BLOCK_SIZE) {
+        for (i = 0; i < BLOCK_SIZE; i++)
+            block[i] = pattern(pos + i);
+        CHECK((f_write(&fil, block, BLOCK_SIZE, &bw) == FR_OK) && (bw == BLOCK_SIZE));
+        if (interleave && (((pos / BLOCK_SIZE) % interleave) == 0))
+            CHECK((f_write(&oth, block, BLOCK_SIZE, &bw) == FR_OK) && (bw == BLOCK_SIZE));
+    }
+    CHECK(f_close(&fil) == FR_OK);
+    if (interleave)
+        CHECK(f_close(&oth) == FR_OK);
+}
+
+// sector reads of random seek + one byte read
+static unsigned long bench(FIL *fil, int seeks) {
+    const unsigned long reads = ramdisk_reads;
+    int n;
+    srand(1);
+    for (n = 0; n < seeks; n++) {
+        const FSIZE_t pos = ((FSIZE_t)rand() * 4096 + rand() % 4096) % FILE_SIZE;
+        uint8_t byte;
+        UINT br;
+        if ((f_lseek(fil, pos) != FR_OK) || (f_read(fil, &byte, 1, &br) != FR_OK) || (br != 1) || (byte != pattern(pos))) {
+            printf("read at %lu failed\n", (unsigned long)pos);
+            errors++;
+            break;
+        }
+    }
+    return ramdisk_reads - reads;
+}
+
+// returns 1 when map was attached
+static int test_file(const char *path, int seeks) {
+    FIL fil;
+    unsigned long normal;
+    unsigned long build;
+    unsigned long fast;
+    int attached;
+    CHECK(f_open(&fil, path, FA_READ) == FR_OK);
+    normal = bench(&fil, seeks);
+    build = ramdisk_reads;
+    attached = f_gcode_fast_seek_attach(&fil);
+    build = ramdisk_reads - build;
+    CHECK(attached == (fil.cltbl != NULL));
+    fast = bench(&fil, seeks);
+    if (attached) {
+        printf("%s: %u fragments, map built from %lu sectors, %d seeks: %lu sectors normal, %lu with map\n",
+            path, (unsigned)((fil.cltbl[0] - 1) / 2), build, seeks, normal, fast);
+        CHECK(fast <= (unsigned long)seeks); // data sector only, FAT is not read
+        CHECK(fast < normal);
+    } else
+        printf("%s: too fragmented for map, %d seeks: %lu sectors normal\n", path, seeks, normal);
+    f_gcode_fast_seek_detach(&fil);
+    CHECK(fil.cltbl == NULL);
+    CHECK(f_close(&fil) == FR_OK);
+    return attached;
+}
+
+// pool of GCODE_FAST_SEEK_MAPS maps is shared, map of file closed without detach is reused
+static void test_pool(const char *path) {
+    FIL fil[GCODE_FAST_SEEK_MAPS + 1];
+    int attached = 0;
+    int i;
+    for (i = 0; i <= GCODE_FAST_SEEK_MAPS; i++) {
+        CHECK(f_open(&fil[i], path, FA_READ) == FR_OK);
+        attached += f_gcode_fast_seek_attach(&fil[i]);
+    }
+    CHECK(attached == GCODE_FAST_SEEK_MAPS);
+    CHECK(fil[GCODE_FAST_SEEK_MAPS].cltbl == NULL);
+    CHECK(f_close(&fil[0]) == FR_OK);
+    CHECK(f_gcode_fast_seek_attach(&fil[GCODE_FAST_SEEK_MAPS]));
+    CHECK(bench(&fil[GCODE_FAST_SEEK_MAPS], 100) <= 100);
+    for (i = 1; i <= GCODE_FAST_SEEK_MAPS; i++) {
+        f_gcode_fast_seek_detach(&fil[i]);
+        CHECK(f_close(&fil[i]) == FR_OK);
+    }
+}
+
+int main(int argc, char **argv) {
+    static FATFS fs;
+    const int seeks = (argc > 1) ? atoi(argv[1]) : DEFAULT_SEEKS;
+    if (!ramdisk_format(&fs)) {
+        printf("can't format RAM disk\n");
+        return 1;
+    }
+    create("/cont.gco", NULL, 0);
+    create("/frag.gco", "/frag.tmp", 256);
+    create("/many.gco", "/many.tmp", 16);
+    CHECK(test_file("/cont.gco", seeks));
+    CHECK(test_file("/frag.gco", seeks));
+    CHECK(!test_file("/many.gco", seeks));
+    test_pool("/frag.gco");
+    printf("fast_seek_bench: %d errors\n", errors);
+    return errors ? 1 : 0;
+}
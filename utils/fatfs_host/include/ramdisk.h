@@ -0,0 +1,24 @@
+// ramdisk.h - FatFS disk in host memory for utils tests
+#ifndef _RAMDISK_H
+#define _RAMDISK_H
+
+#include "ff.h"
+
+#define RAMDISK_SECTORS (32 * 1024 * 2) // 32MB, 512 byte sectors
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern unsigned long ramdisk_reads;  // sectors read since format
+extern unsigned long ramdisk_writes; // sectors written since format
+extern unsigned ramdisk_fail_writes;  // number of next disk_write calls that fail (USB error)
+
+// create empty FAT volume and mount it as default drive, returns 0 on error
+extern int ramdisk_format(FATFS *fs);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //_RAMDISK_H
@@ -0,0 +1,73 @@
+// ramdisk.c - FatFS disk in host memory for utils tests
+// implements diskio.h for drive 0, counts sector accesses and can simulate
+// write errors (USB stick removed or failing)
+
+#include <string.h>
+#include "ramdisk.h"
+#include "diskio.h"
+
+#define RAMDISK_SECTOR_SIZE 512
+
+static BYTE ramdisk_image[RAMDISK_SECTORS][RAMDISK_SECTOR_SIZE];
+
+unsigned long ramdisk_reads = 0;
+unsigned long ramdisk_writes = 0;
+unsigned ramdisk_fail_writes = 0;
+
+int ramdisk_format(FATFS *fs) {
+    static BYTE work[_MAX_SS];
+    memset(ramdisk_image, 0, sizeof(ramdisk_image));
+    ramdisk_fail_writes = 0;
+    if ((f_mkfs("", FM_ANY, 0, work, sizeof(work)) != FR_OK) || (f_mount(fs, "", 1) != FR_OK))
+        return 0;
+    ramdisk_reads = 0;
+    ramdisk_writes = 0;
+    return 1;
+}
+
+DSTATUS disk_initialize(BYTE pdrv) {
+    return pdrv ? STA_NOINIT : 0;
+}
+
+DSTATUS disk_status(BYTE pdrv) {
+    return pdrv ? STA_NOINIT : 0;
+}
+
+DRESULT disk_read(BYTE pdrv, BYTE *buff, DWORD sector, UINT count) {
+    if (pdrv || ((sector + count) > RAMDISK_SECTORS))
+        return RES_PARERR;
+    memcpy(buff, ramdisk_image[sector], count * RAMDISK_SECTOR_SIZE);
+    ramdisk_reads += count;
+    return RES_OK;
+}
+
+DRESULT disk_write(BYTE pdrv, const BYTE *buff, DWORD sector, UINT count) {
+    if (pdrv || ((sector + count) > RAMDISK_SECTORS))
+        return RES_PARERR;
+    if (ramdisk_fail_writes) {
+        ramdisk_fail_writes--;
+        return RES_ERROR;
+    }
+    memcpy(ramdisk_image[sector], buff, count * RAMDISK_SECTOR_SIZE);
+    ramdisk_writes += count;
+    return RES_OK;
+}
+
+DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void *buff) {
+    if (pdrv)
+        return RES_PARERR;
+    switch (cmd) {
+    case CTRL_SYNC:
+        return RES_OK;
+    case GET_SECTOR_COUNT:
+        *(DWORD *)buff = RAMDISK_SECTORS;
+        return RES_OK;
+    case GET_SECTOR_SIZE:
+        *(WORD *)buff = RAMDISK_SECTOR_SIZE;
+        return RES_OK;
+    case GET_BLOCK_SIZE:
+        *(DWORD *)buff = 1;
+        return RES_OK;
+    }
+    return RES_PARERR;
+}
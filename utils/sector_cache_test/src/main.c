@@ -0,0 +1,268 @@
+//sector_cache_test - main.c
+//host test of src/common/sector_cache.c on a file-backed block device:
+//random transfers through the cache are compared with a shadow copy of the
+//device, then FatFS runs on top of the cache (as in usbh_diskio.c) and the
+//image is checked again without the cache
+//usage: sector_cache_test [image]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sector_cache.h"
+#include "ff.h"
+#include "diskio.h"
+
+#define SECTOR_SIZE  SECTOR_CACHE_SECTOR_SIZE
+#define DEV_SECTORS  (8192 + 3) // last line of device is incomplete
+#define CACHE_LINES  4          // config_a3ides2209_02.h
+#define LINE_SECTORS 4
+#define RANDOM_OPS   20000
+#define DEV_ERROR    3   // error code of failed device transfer (RES_NOTRDY)
+#define FATFS_CHUNK  300 // f_write size in FatFS test
+
+static int errors = 0;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            errors++;                                                       \
+        }                                                                   \
+    } while (0)
+
+//-----------------------------------------------------------------------------
+// file-backed block device
+
+static FILE *dev_file = NULL;
+static uint32_t dev_transfers = 0; // read/write calls
+static int dev_fail = 0;           // next transfers fail
+
+static int dev_read(uint8_t *buff, uint32_t sector, uint32_t count) {
+    CHECK(count && ((sector + count) <= DEV_SECTORS));
+    dev_transfers++;
+    if (dev_fail)
+        return DEV_ERROR;
+    if ((fseek(dev_file, (long)sector * SECTOR_SIZE, SEEK_SET) != 0) || (fread(buff, SECTOR_SIZE, count, dev_file) != count))
+        return DEV_ERROR;
+    return 0;
+}
+
+static int dev_write(uint8_t *buff, uint32_t sector, uint32_t count) {
+    CHECK(count && ((sector + count) <= DEV_SECTORS));
+    dev_transfers++;
+    if (dev_fail)
+        return DEV_ERROR;
+    if ((fseek(dev_file, (long)sector * SECTOR_SIZE, SEEK_SET) != 0) || (fwrite(buff, SECTOR_SIZE, count, dev_file) != count))
+        return DEV_ERROR;
+    return 0;
+}
+
+static void dev_create(const char *path) {
+    static uint8_t zero[SECTOR_SIZE];
+    uint32_t i;
+    dev_file = path ? fopen(path, "w+b") : tmpfile();
+    if (dev_file == NULL) {
+        perror("can't create image");
+        exit(1);
+    }
+    for (i = 0; i < DEV_SECTORS; i++)
+        fwrite(zero, SECTOR_SIZE, 1, dev_file);
+}
+
+//-----------------------------------------------------------------------------
+// cache, diskio.h for FatFS (usbh_diskio.c with USBH_CACHE)
+
+static sector_cache_t cache;
+static sector_cache_line_t cache_line[CACHE_LINES];
+static uint8_t cache_data[CACHE_LINES * LINE_SECTORS * SECTOR_SIZE];
+static int use_cache = 1;
+
+DSTATUS disk_initialize(BYTE pdrv) {
+    if (pdrv)
+        return STA_NOINIT;
+    sector_cache_init(&cache, cache_line, cache_data, CACHE_LINES, LINE_SECTORS, dev_read, dev_write);
+    sector_cache_reset(&cache, use_cache ? DEV_SECTORS : 0);
+    return 0;
+}
+
+DSTATUS disk_status(BYTE pdrv) {
+    return pdrv ? STA_NOINIT : 0;
+}
+
+DRESULT disk_read(BYTE pdrv, BYTE *buff, DWORD sector, UINT count) {
+    return pdrv ? RES_PARERR : (DRESULT)sector_cache_read(&cache, buff, sector, count);
+}
+
+DRESULT disk_write(BYTE pdrv, const BYTE *buff, DWORD sector, UINT count) {
+    return pdrv ? RES_PARERR : (DRESULT)sector_cache_write(&cache, buff, sector, count);
+}
+
+DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void *buff) {
+    if (pdrv)
+        return RES_PARERR;
+    switch (cmd) {
+    case CTRL_SYNC:
+        return (DRESULT)sector_cache_flush(&cache);
+    case GET_SECTOR_COUNT:
+        *(DWORD *)buff = DEV_SECTORS;
+        return RES_OK;
+    case GET_SECTOR_SIZE:
+        *(WORD *)buff = SECTOR_SIZE;
+        return RES_OK;
+    case GET_BLOCK_SIZE:
+        *(DWORD *)buff = 1;
+        return RES_OK;
+    }
+    return RES_PARERR;
+}
+
+//-----------------------------------------------------------------------------
+// tests
+
+static uint8_t shadow[DEV_SECTORS * SECTOR_SIZE]; // expected device content
+
+static void fill(uint8_t *buff, uint32_t sector, uint32_t count, uint32_t seed) {
+    uint32_t i;
+    for (i = 0; i < count * SECTOR_SIZE; i++)
+        buff[i] = (uint8_t)((sector * SECTOR_SIZE + i) * 31 + seed);
+}
+
+// device content without cache equals shadow
+static int dev_matches(void) {
+    static uint8_t buff[SECTOR_SIZE];
+    uint32_t i;
+    for (i = 0; i < DEV_SECTORS; i++)
+        if ((dev_read(buff, i, 1) != 0) || memcmp(buff, shadow + i * SECTOR_SIZE, SECTOR_SIZE)) {
+            printf("device sector %u differs\n", i);
+            return 0;
+        }
+    return 1;
+}
+
+// random reads and writes of 1 to 2 lines, reads must return last written data
+static void test_random(void) {
+    static uint8_t buff[3 * LINE_SECTORS * SECTOR_SIZE];
+    int n;
+    disk_initialize(0);
+    for (n = 0; n < RANDOM_OPS; n++) {
+        const uint32_t count = 1 + rand() % (2 * LINE_SECTORS);
+        const uint32_t sector = (rand() % 8) ? (rand() % 64) : (rand() % (DEV_SECTORS - count + 1)); // mostly small area, lines are reused
+        if (rand() % 3) {
+            CHECK(sector_cache_read(&cache, buff, sector, count) == 0);
+            if (memcmp(buff, shadow + sector * SECTOR_SIZE, count * SECTOR_SIZE)) {
+                printf("read %u+%u differs (op %d)\n", sector, count, n);
+                errors++;
+            }
+        } else {
+            fill(buff, sector, count, n);
+            memcpy(shadow + sector * SECTOR_SIZE, buff, count * SECTOR_SIZE);
+            CHECK(sector_cache_write(&cache, buff, sector, count) == 0);
+        }
+        if ((rand() % 500) == 0)
+            CHECK(sector_cache_flush(&cache) == 0);
+    }
+    CHECK(sector_cache_flush(&cache) == 0);
+    CHECK(dev_matches());
+}
+
+// sequential single sector reads fill whole lines (one transfer per line)
+static void test_read_ahead(void) {
+    static uint8_t buff[SECTOR_SIZE];
+    const uint32_t start = 1024;
+    const uint32_t lines = 64;
+    uint32_t i;
+    disk_initialize(0);
+    dev_transfers = 0;
+    for (i = 0; i < lines * LINE_SECTORS; i++)
+        CHECK(sector_cache_read(&cache, buff, start + i, 1) == 0);
+    CHECK(dev_transfers == lines);
+    CHECK(cache.hits == lines * (LINE_SECTORS - 1));
+}
+
+// consecutive modified sectors of a line are written in one transfer
+static void test_write_coalescing(void) {
+    static uint8_t buff[SECTOR_SIZE];
+    const uint32_t start = 2048;
+    uint32_t i;
+    disk_initialize(0);
+    for (i = 0; i < LINE_SECTORS; i++) {
+        fill(buff, start + i, 1, 7);
+        memcpy(shadow + (start + i) * SECTOR_SIZE, buff, SECTOR_SIZE);
+        CHECK(sector_cache_write(&cache, buff, start + i, 1) == 0);
+    }
+    dev_transfers = 0;
+    CHECK(sector_cache_flush(&cache) == 0);
+    CHECK(dev_transfers == 1);
+    CHECK(dev_matches());
+}
+
+// device error is returned, modified sectors stay in cache until written
+static void test_error(void) {
+    static uint8_t buff[SECTOR_SIZE];
+    const uint32_t sector = 3000;
+    disk_initialize(0);
+    fill(buff, sector, 1, 99);
+    memcpy(shadow + sector * SECTOR_SIZE, buff, SECTOR_SIZE);
+    CHECK(sector_cache_write(&cache, buff, sector, 1) == 0);
+    dev_fail = 1;
+    CHECK(sector_cache_read(&cache, buff, 4000, 1) == DEV_ERROR);
+    CHECK(sector_cache_flush(&cache) == DEV_ERROR);
+    dev_fail = 0;
+    CHECK(sector_cache_flush(&cache) == 0);
+    CHECK(dev_matches());
+}
+
+// FatFS through cache, files are read back without cache after remount
+static void test_fatfs(void) {
+    static BYTE work[_MAX_SS];
+    static uint8_t data[40 * SECTOR_SIZE];
+    static uint8_t back[sizeof(data)];
+    static FATFS fs;
+    char name[16];
+    FIL fil;
+    UINT bw;
+    UINT pos;
+    int i;
+    use_cache = 1;
+    CHECK(f_mkfs("", FM_ANY, 0, work, sizeof(work)) == FR_OK);
+    CHECK(f_mount(&fs, "", 1) == FR_OK);
+    for (i = 0; i < 20; i++) {
+        const UINT len = 1 + (i * 997) % sizeof(data);
+        fill(data, i, sizeof(data) / SECTOR_SIZE, i);
+        snprintf(name, sizeof(name), "/f%02d.gcode", i);
+        CHECK(f_open(&fil, name, FA_WRITE | FA_CREATE_ALWAYS) == FR_OK);
+        for (pos = 0; pos < len; pos += bw) { // partial sectors go through cache
+            const UINT n = ((len - pos) < FATFS_CHUNK) ? (len - pos) : FATFS_CHUNK;
+            CHECK((f_write(&fil, data + pos, n, &bw) == FR_OK) && (bw == n));
+            if (bw != n)
+                break;
+        }
+        CHECK(f_close(&fil) == FR_OK);
+    }
+    CHECK(f_mount(NULL, "", 0) == FR_OK);
+    use_cache = 0;
+    CHECK(f_mount(&fs, "", 1) == FR_OK);
+    for (i = 0; i < 20; i++) {
+        const UINT len = 1 + (i * 997) % sizeof(data);
+        fill(data, i, sizeof(data) / SECTOR_SIZE, i);
+        snprintf(name, sizeof(name), "/f%02d.gcode", i);
+        CHECK(f_open(&fil, name, FA_READ) == FR_OK);
+        CHECK((f_read(&fil, back, sizeof(back), &bw) == FR_OK) && (bw == len));
+        CHECK(memcmp(back, data, len) == 0);
+        f_close(&fil);
+    }
+    CHECK(f_mount(NULL, "", 0) == FR_OK);
+}
+
+int main(int argc, char **argv) {
+    dev_create((argc > 1) ? argv[1] : NULL);
+    srand(1);
+    test_random();
+    test_read_ahead();
+    test_write_coalescing();
+    test_error();
+    test_fatfs();
+    fclose(dev_file);
+    printf("sector_cache_test: %d errors\n", errors);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,88 @@
+"""Decode sim_motion step trace (SIM_MOTION_TRACE) to per-axis timeline CSV.
+
+The trace is recorded with putslave commands "!smtr 1" (start) and
+"!smtr 0 [file]" (stop and save to usb flash, default smtrace.bin).
+"""
+from argparse import ArgumentParser
+import struct
+import sys
+
+MAGIC = 0x52544d53  # "SMTR"
+HDR_FMT = '<II4i'
+FLG_DIR = 0x04
+FLG_SYNC = 0x08
+AXES = 'XYZE'
+
+
+def read_records(data):
+    """Yield raw varint values from trace data."""
+    val = 0
+    shift = 0
+    for byte in data:
+        val |= (byte & 0x7f) << shift
+        shift += 7
+        if not byte & 0x80:
+            yield val
+            val = 0
+            shift = 0
+
+
+def decode(data, tick_bits):
+    """Yield (tick, axis, direction) tuples, tick is monotonic."""
+    tick_range = 1 << tick_bits
+    tick = None
+    for val in read_records(data):
+        axis = val & 0x03
+        direction = 1 if val & FLG_DIR else -1
+        if val & FLG_SYNC:
+            abs_tick = val >> 4
+            if tick is None:
+                tick = abs_tick
+            else:
+                # time between records before sync is unknown beyond one wrap
+                delta = (abs_tick - tick) % tick_range
+                tick += delta
+        else:
+            if tick is None:
+                continue
+            tick += val >> 4
+        yield tick, axis, direction
+
+
+def main():
+    parser = ArgumentParser(description=__doc__)
+    parser.add_argument('trace', help='trace file written by sim_motion_trace_save')
+    parser.add_argument('-o', '--output', help='output csv (default stdout)')
+    parser.add_argument('--shift', type=int, default=4,
+                        help='SIM_MOTION_TRACE_SHIFT used in firmware')
+    args = parser.parse_args()
+
+    with open(args.trace, 'rb') as f:
+        data = f.read()
+    hdr_size = struct.calcsize(HDR_FMT)
+    if len(data) < hdr_size:
+        sys.exit('file too short')
+    magic, tick_freq, *pos = struct.unpack_from(HDR_FMT, data)
+    if magic != MAGIC:
+        sys.exit('invalid magic 0x%08x' % magic)
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    out.write('time,axis,pos,velocity\n')
+    t0 = None
+    last = [None] * 4
+    for tick, axis, direction in decode(data[hdr_size:], 32 - args.shift):
+        if t0 is None:
+            t0 = tick
+        pos[axis] += direction
+        t = (tick - t0) / tick_freq
+        vel = 0.0
+        if last[axis] is not None and t > last[axis]:
+            vel = direction / (t - last[axis])
+        last[axis] = t
+        out.write('%.7f,%s,%d,%.1f\n' % (t, AXES[axis], pos[axis], vel))
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,230 @@
+"""Generate fsdata_custom.c (lwIP httpd file system) from WUI resources.
+
+Every file is stored with complete HTTP/1.1 headers for persistent connections
+(as makefsdata -11 does), except the "Connection:" line which httpd adds per
+request (keep-alive only when requested). In addition to makefsdata, a gzip
+variant is stored when it is significantly smaller, and every resource gets an
+entity tag (content hash) together with prepared 304 Not Modified responses. The httpd selects the variant by the
+Accept-Encoding and If-None-Match request headers.
+"""
+from argparse import ArgumentParser
+from hashlib import sha256
+from pathlib import Path
+
+import gzip
+import re
+
+SERVER = 'lwIP/2.1.2 (http://savannah.nongnu.org/projects/lwip)'
+ETAG_LEN = 16  # hex digits of content hash, FS_ASSET_ETAG_LEN
+GZIP_RATIO = 0.9  # gzip variant is stored only when smaller than this ratio
+
+CONTENT_TYPES = {
+    '.html': 'text/html',
+    '.htm': 'text/html',
+    '.css': 'text/css',
+    '.js': 'application/javascript',
+    '.json': 'application/json',
+    '.svg': 'image/svg+xml',
+    '.ico': 'image/x-icon',
+    '.gif': 'image/gif',
+    '.png': 'image/png',
+    '.jpg': 'image/jpeg',
+    '.txt': 'text/plain',
+}
+
+PREAMBLE = '''#include "lwip/apps/fs.h"
+#include "lwip/def.h"
+
+#define file_NULL (struct fsdata_file *)NULL
+
+#ifndef FS_FILE_FLAGS_HEADER_INCLUDED
+    #define FS_FILE_FLAGS_HEADER_INCLUDED 1
+#endif
+#ifndef FS_FILE_FLAGS_HEADER_PERSISTENT
+    #define FS_FILE_FLAGS_HEADER_PERSISTENT 0
+#endif
+/* FSDATA_FILE_ALIGNMENT: 0=off, 1=by variable, 2=by include */
+#ifndef FSDATA_FILE_ALIGNMENT
+    #define FSDATA_FILE_ALIGNMENT 0
+#endif
+#ifndef FSDATA_ALIGN_PRE
+    #define FSDATA_ALIGN_PRE
+#endif
+#ifndef FSDATA_ALIGN_POST
+    #define FSDATA_ALIGN_POST
+#endif
+#if FSDATA_FILE_ALIGNMENT == 2
+    #include "fsdata_alignment.h"
+#endif
+'''
+
+
+class Variant:
+    def __init__(self, varname, uri, headers, payload):
+        self.varname = varname
+        self.uri = uri
+        self.headers = headers
+        self.payload = payload
+
+    @property
+    def name_bytes(self):
+        # zero terminated, padded to 4 bytes (makefsdata compatible)
+        name = self.uri.encode() + b'\0'
+        return name + b'\0' * (-len(name) % 4)
+
+
+def c_var(name):
+    return re.sub(r'[^A-Za-z0-9_]', '_', name)
+
+
+def c_string(text):
+    return '"' + text.replace('\\', '\\\\').replace('"', '\\"').replace(
+        '\r', '\\r').replace('\n', '\\n') + '"'
+
+
+def response_headers(status, length, ctype, etag, vary, encoding=None):
+    headers = ['HTTP/1.1 %s\r\n' % status, 'Server: %s\r\n' % SERVER]
+    if length is not None:
+        headers.append('Content-Length: %d\r\n' % length)
+    if etag:
+        headers.append('ETag: "%s"\r\n' % etag)
+        headers.append('Cache-Control: no-cache\r\n')
+    if vary:
+        headers.append('Vary: Accept-Encoding\r\n')
+    if encoding:
+        headers.append('Content-Encoding: %s\r\n' % encoding)
+    if ctype:
+        headers.append('Content-Type: %s\r\n' % ctype)
+    headers[-1] += '\r\n'
+    return headers
+
+
+def write_variant(out, index, var):
+    out.write('#if FSDATA_FILE_ALIGNMENT == 1\n')
+    out.write('static const unsigned int dummy_align__%s = %d;\n' %
+              (var.varname, index))
+    out.write('#endif\n')
+    out.write(
+        'static const unsigned char FSDATA_ALIGN_PRE data__%s[] FSDATA_ALIGN_POST = {\n'
+        % var.varname)
+
+    def put(data):
+        for b in data:
+            out.write('    0x%02x,\n' % b)
+
+    out.write('    /* %s (%d chars) */\n' %
+              (var.uri, len(var.uri.encode()) + 1))
+    put(var.name_bytes)
+    out.write('\n    /* HTTP header */\n')
+    for header in var.headers:
+        out.write('    /* %s (%d bytes) */\n' %
+                  (c_string(header), len(header)))
+        put(header.encode())
+    out.write('    /* raw file data (%d bytes) */\n' % len(var.payload))
+    put(var.payload)
+    out.write('};\n\n')
+
+
+def write_file_struct(out, var, next_var):
+    offset = len(var.name_bytes)
+    out.write('const struct fsdata_file file__%s[] = { {\n' % var.varname)
+    out.write('    %s,\n' % (('file__' + next_var) if next_var else 'file_NULL'))
+    out.write('    data__%s,\n' % var.varname)
+    out.write('    data__%s + %d,\n' % (var.varname, offset))
+    out.write('    sizeof(data__%s) - %d,\n' % (var.varname, offset))
+    out.write(
+        '    FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT,\n'
+    )
+    out.write('} };\n\n')
+
+
+def generate(src_dir: Path, out_path: Path, verbose=False):
+    files = sorted(p for p in src_dir.rglob('*') if p.is_file())
+    plain = []  # all files, linked list for fs_open
+    encoded = []  # gzip variants, not linked (opened via fs_assets)
+    assets = []
+    for path in files:
+        uri = '/' + path.relative_to(src_dir).as_posix()
+        data = path.read_bytes()
+        ctype = CONTENT_TYPES.get(path.suffix.lower(), 'text/plain')
+        varname = c_var(uri[1:])
+        if path.name == '404.html':
+            plain.append(
+                Variant(
+                    varname, uri,
+                    response_headers('404 File not found', len(data), ctype,
+                                     None, False), data))
+            continue
+        etag = sha256(data).hexdigest()[:ETAG_LEN]
+        packed = gzip.compress(data, 9, mtime=0)
+        gz = len(packed) < len(data) * GZIP_RATIO
+        plain.append(
+            Variant(
+                varname, uri,
+                response_headers('200 OK', len(data), ctype, etag, gz), data))
+        if gz:
+            encoded.append(
+                Variant(
+                    varname + '_gz', uri,
+                    response_headers('200 OK', len(packed), ctype, etag + '-gz',
+                                     True, 'gzip'), packed))
+        assets.append((uri, varname, etag, gz))
+        if verbose:
+            print('%-28s %7d -> %7d %s' %
+                  (uri, len(data), len(packed) if gz else len(data), etag))
+
+    with open(out_path, 'w', newline='\n') as out:
+        out.write(PREAMBLE)
+        for index, var in enumerate(plain + encoded):
+            write_variant(out, index, var)
+        for index, var in enumerate(plain):
+            write_file_struct(out, var,
+                              plain[index - 1].varname if index else None)
+        for var in encoded:
+            write_file_struct(out, var, None)
+        out.write('const struct fsdata_asset fs_assets[] = {\n')
+        for uri, varname, etag, gz in assets:
+            vary = gz
+            not_modified = ''.join(
+                response_headers('304 Not Modified', None, None, etag, vary))
+            not_modified_gz = ''.join(
+                response_headers('304 Not Modified', None, None, etag + '-gz',
+                                 vary)) if gz else None
+            out.write('    {\n')
+            out.write('        %s,\n' % c_string(uri))
+            out.write('        %s,\n' % c_string(etag))
+            out.write('        file__%s,\n' % varname)
+            out.write('        %s,\n' %
+                      (('file__%s_gz' % varname) if gz else 'file_NULL'))
+            out.write('        %s,\n' % c_string(not_modified))
+            out.write('        %s,\n' %
+                      (c_string(not_modified_gz) if gz else 'NULL'))
+            out.write('    },\n')
+        out.write('};\n\n')
+        out.write('#define FS_ROOT      file__%s\n' % plain[-1].varname)
+        out.write('#define FS_NUMFILES  %d\n' % len(plain))
+        out.write('#define FS_NUMASSETS %d\n' % len(assets))
+
+
+def main():
+    root = Path(__file__).resolve().parent.parent
+    parser = ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--src',
+                        type=Path,
+                        default=root / 'src' / 'wui' / 'resources' / 'src',
+                        help='resource directory')
+    parser.add_argument('--output',
+                        type=Path,
+                        default=root / 'src' / 'wui' / 'resources' /
+                        'fsdata_custom.c',
+                        help='generated C file')
+    parser.add_argument('-v',
+                        '--verbose',
+                        action='store_true',
+                        help='print sizes and entity tags')
+    args = parser.parse_args()
+    generate(args.src, args.output, args.verbose)
+
+
+if __name__ == '__main__':
+    main()
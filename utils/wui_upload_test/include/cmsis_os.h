@@ -0,0 +1,38 @@
+// cmsis_os.h - host stub, message queue is a ring buffer without blocking
+#ifndef _CMSIS_OS_H
+#define _CMSIS_OS_H
+
+#include <stdint.h>
+
+typedef enum {
+    osOK = 0,
+    osEventMessage = 0x10,
+    osEventTimeout = 0x40,
+    osErrorResource = 0x81,
+} osStatus;
+
+typedef struct {
+    osStatus status;
+    union {
+        uint32_t v;
+        void *p;
+    } value;
+} osEvent;
+
+typedef struct os_messageQ_def {
+    uint32_t queue_sz;
+    uint32_t item_sz;
+} osMessageQDef_t;
+
+typedef struct os_messageQ_cb *osMessageQId;
+
+#define osMessageQDef(name, queue_sz, type) \
+    const osMessageQDef_t os_messageQ_def_##name = { (queue_sz), sizeof(type) }
+#define osMessageQ(name) &os_messageQ_def_##name
+
+extern osMessageQId osMessageCreate(const osMessageQDef_t *queue_def, void *thread_id);
+extern osStatus osMessagePut(osMessageQId queue_id, uint32_t info, uint32_t millisec);
+extern osEvent osMessageGet(osMessageQId queue_id, uint32_t millisec);
+extern osStatus osDelay(uint32_t millisec);
+
+#endif //_CMSIS_OS_H
@@ -0,0 +1,15 @@
+// httpd.h - host stub, POST callbacks of lwIP httpd
+#ifndef _HTTPD_H
+#define _HTTPD_H
+
+#include "lwip/def.h"
+#include "lwip/pbuf.h"
+
+extern err_t httpd_post_begin(void *connection, const char *uri, const char *http_request,
+    u16_t http_request_len, int content_len, char *response_uri,
+    u16_t response_uri_len, u8_t *post_auto_wnd);
+extern err_t httpd_post_receive_data(void *connection, struct pbuf *p);
+extern void httpd_post_finished(void *connection, char *response_uri, u16_t response_uri_len);
+extern void httpd_post_data_recved(void *connection, u16_t recved_len);
+
+#endif //_HTTPD_H
@@ -0,0 +1,21 @@
+// lwip/def.h - host stub (types and macros used by src/wui)
+#ifndef _LWIP_DEF_H
+#define _LWIP_DEF_H
+
+#include <stdint.h>
+
+typedef uint8_t u8_t;
+typedef uint16_t u16_t;
+typedef uint32_t u32_t;
+typedef int8_t err_t;
+
+#define ERR_OK         0
+#define ERR_MEM        -1
+#define ERR_INPROGRESS -5
+#define ERR_VAL        -6
+#define ERR_ARG        -16
+
+#define LWIP_MIN(x, y)     (((x) < (y)) ? (x) : (y))
+#define LWIP_UNUSED_ARG(x) (void)x
+
+#endif //_LWIP_DEF_H
@@ -0,0 +1,20 @@
+// lwip/pbuf.h - host stub, pbufs are malloc'ed by the test driver
+#ifndef _LWIP_PBUF_H
+#define _LWIP_PBUF_H
+
+#include <stddef.h>
+#include "lwip/def.h"
+
+struct pbuf {
+    struct pbuf *next;
+    void *payload;
+    u16_t tot_len;
+    u16_t len;
+};
+
+extern struct pbuf *pbuf_alloc_data(const u8_t *data, u16_t len);
+extern u8_t pbuf_free(struct pbuf *p);
+extern void pbuf_cat(struct pbuf *head, struct pbuf *tail);
+extern u8_t pbuf_remove_header(struct pbuf *p, size_t header_size);
+
+#endif //_LWIP_PBUF_H
@@ -0,0 +1,11 @@
+// lwip/tcpip.h - host stub, callbacks run immediately (single thread)
+#ifndef _LWIP_TCPIP_H
+#define _LWIP_TCPIP_H
+
+#include "lwip/def.h"
+
+typedef void (*tcpip_callback_fn)(void *ctx);
+
+extern err_t tcpip_callback(tcpip_callback_fn function, void *ctx);
+
+#endif //_LWIP_TCPIP_H
@@ -0,0 +1,9 @@
+// stm32f4xx_hal.h - host stub
+#ifndef _STM32F4XX_HAL_H
+#define _STM32F4XX_HAL_H
+
+#include <stdint.h>
+
+extern uint32_t HAL_GetTick(void);
+
+#endif //_STM32F4XX_HAL_H
@@ -0,0 +1,336 @@
+//wui_upload_test - main.c
+//host test of src/wui/wui_upload.c, the http server and the writer thread are
+//simulated in one thread, files are written by FatFS to a RAM disk
+//usage: wui_upload_test
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ramdisk.h"
+#include "wui_upload.h"
+#include "httpd.h"
+#include "lwip/tcpip.h"
+#include "cmsis_os.h"
+#include "stm32f4xx_hal.h"
+
+#define TCP_MSS      536           // lwIP opt.h default (not set in lwipopts.h)
+#define TCP_WND      (4 * TCP_MSS) // lwIP opt.h default
+#define WUI_BUFFERED (2 * 4096)    // wui_upload.c buffers
+#define RESPONSE_LEN 64
+#define QUEUE_LEN    16
+
+static int errors = 0;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            errors++;                                                       \
+        }                                                                   \
+    } while (0)
+
+//-----------------------------------------------------------------------------
+// stubs
+
+static uint32_t queue[QUEUE_LEN];
+static unsigned queue_head = 0;
+static unsigned queue_tail = 0;
+static int pbufs = 0; // allocated pbufs
+
+osMessageQId osMessageCreate(const osMessageQDef_t *queue_def, void *thread_id) {
+    (void)thread_id;
+    return (queue_def->queue_sz <= QUEUE_LEN) ? (osMessageQId)queue : NULL;
+}
+
+osStatus osMessagePut(osMessageQId queue_id, uint32_t info, uint32_t millisec) {
+    (void)queue_id;
+    (void)millisec;
+    if ((queue_tail - queue_head) == QUEUE_LEN)
+        return osErrorResource;
+    queue[queue_tail++ % QUEUE_LEN] = info;
+    return osOK;
+}
+
+osEvent osMessageGet(osMessageQId queue_id, uint32_t millisec) {
+    osEvent event = { osEventTimeout, { 0 } };
+    (void)queue_id;
+    (void)millisec;
+    if (queue_head != queue_tail) {
+        event.status = osEventMessage;
+        event.value.v = queue[queue_head++ % QUEUE_LEN];
+    }
+    return event;
+}
+
+osStatus osDelay(uint32_t millisec) {
+    (void)millisec;
+    return osOK;
+}
+
+uint32_t HAL_GetTick(void) {
+    static uint32_t tick = 0;
+    return tick++;
+}
+
+err_t tcpip_callback(tcpip_callback_fn function, void *ctx) {
+    function(ctx);
+    return ERR_OK;
+}
+
+struct pbuf *pbuf_alloc_data(const u8_t *data, u16_t len) {
+    struct pbuf *p = malloc(sizeof(struct pbuf) + len);
+    p->next = NULL;
+    p->payload = p + 1;
+    p->tot_len = len;
+    p->len = len;
+    memcpy(p->payload, data, len);
+    pbufs++;
+    return p;
+}
+
+u8_t pbuf_free(struct pbuf *p) {
+    u8_t cnt = 0;
+    while (p) {
+        struct pbuf *next = p->next;
+        free(p);
+        pbufs--;
+        cnt++;
+        p = next;
+    }
+    return cnt;
+}
+
+void pbuf_cat(struct pbuf *head, struct pbuf *tail) {
+    for (; head->next; head = head->next)
+        head->tot_len += tail->tot_len;
+    head->tot_len += tail->tot_len;
+    head->next = tail;
+}
+
+u8_t pbuf_remove_header(struct pbuf *p, size_t header_size) {
+    if (header_size > p->len)
+        return 1;
+    p->payload = (u8_t *)p->payload + header_size;
+    p->len -= header_size;
+    p->tot_len -= header_size;
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// simulated http connection (lwIP httpd POST handling)
+
+typedef struct {
+    int content_len;
+    int sent;    // body bytes passed to httpd_post_receive_data
+    int acked;   // bytes acknowledged by httpd_post_data_recved
+    int max_wnd; // max. unacknowledged bytes
+    int finished;
+    char response[RESPONSE_LEN];
+} connection_t;
+
+void httpd_post_data_recved(void *connection, u16_t recved_len) {
+    connection_t *conn = (connection_t *)connection;
+    conn->acked += recved_len;
+    if ((conn->acked == conn->content_len) && !conn->finished) {
+        conn->finished = 1;
+        httpd_post_finished(conn, conn->response, RESPONSE_LEN);
+    }
+}
+
+static uint8_t body_byte(int i) {
+    return (uint8_t)(i * 7 + (i >> 9));
+}
+
+// send body segments that fit in receive window
+static void conn_send(connection_t *conn) {
+    uint8_t seg[TCP_MSS];
+    while ((conn->sent < conn->content_len) && ((conn->sent - conn->acked) < TCP_WND)) {
+        int len = conn->content_len - conn->sent;
+        int i;
+        if (len > TCP_MSS)
+            len = TCP_MSS;
+        if (len > (TCP_WND - (conn->sent - conn->acked)))
+            len = TCP_WND - (conn->sent - conn->acked);
+        for (i = 0; i < len; i++)
+            seg[i] = body_byte(conn->sent + i);
+        conn->sent += len;
+        httpd_post_receive_data(conn, pbuf_alloc_data(seg, len));
+        if ((conn->sent - conn->acked) > conn->max_wnd)
+            conn->max_wnd = conn->sent - conn->acked;
+    }
+}
+
+// run writer until its queue is empty
+static void writer_run(void) {
+    while (queue_head != queue_tail)
+        wui_upload_cycle(0);
+}
+
+static err_t conn_begin(connection_t *conn, const char *name, int content_len) {
+    char uri[96];
+    u8_t auto_wnd = 1;
+    memset(conn, 0, sizeof(connection_t));
+    conn->content_len = content_len;
+    snprintf(uri, sizeof(uri), WUI_UPLOAD_URI "%s", name);
+    return httpd_post_begin(conn, uri, "", 0, content_len, conn->response, RESPONSE_LEN, &auto_wnd);
+}
+
+// send rest of body and run writer until response, returns response uri
+static const char *conn_finish(connection_t *conn) {
+    while (!conn->finished) {
+        const int acked = conn->acked;
+        conn_send(conn);
+        writer_run();
+        if (!conn->finished && (conn->acked == acked)) {
+            printf("upload stalled at %d/%d bytes\n", conn->acked, conn->content_len);
+            errors++;
+            break;
+        }
+    }
+    return conn->response;
+}
+
+// whole upload, returns response uri
+static const char *upload(connection_t *conn, const char *name, int content_len) {
+    if (conn_begin(conn, name, content_len) != ERR_OK)
+        return conn->response;
+    return conn_finish(conn);
+}
+
+//-----------------------------------------------------------------------------
+// checks
+
+static int file_size(const char *name) {
+    FILINFO finfo;
+    char path[64];
+    snprintf(path, sizeof(path), "/%s", name);
+    return (f_stat(path, &finfo) == FR_OK) ? (int)finfo.fsize : -1;
+}
+
+static int file_matches(const char *name, int size) {
+    static uint8_t data[4096];
+    char path[64];
+    FIL fil;
+    UINT br;
+    int pos = 0;
+    int ok;
+    snprintf(path, sizeof(path), "/%s", name);
+    if (f_open(&fil, path, FA_READ) != FR_OK)
+        return 0;
+    while ((ok = (f_read(&fil, data, sizeof(data), &br) == FR_OK)) && br) {
+        UINT i;
+        for (i = 0; ok && (i < br); i++)
+            ok = (data[i] == body_byte(pos + i));
+        if (!ok)
+            break;
+        pos += br;
+    }
+    f_close(&fil);
+    return ok && (pos == size);
+}
+
+static void test_upload_ok(int size) {
+    connection_t conn;
+    wui_upload_status_t status;
+    CHECK(strcmp(upload(&conn, "part.gcode", size), WUI_UPLOAD_RESPONSE_OK) == 0);
+    wui_upload_get_status(&status);
+    CHECK(status.state == WUI_UPLOAD_DONE);
+    CHECK(status.received == (uint32_t)size);
+    CHECK(status.written == (uint32_t)size);
+    CHECK(conn.max_wnd <= TCP_WND);
+    CHECK(file_matches("part.gcode", size));
+}
+
+static void test_invalid(void) {
+    connection_t conn;
+    CHECK(conn_begin(&conn, "..", 100) == ERR_ARG);
+    CHECK(strcmp(conn.response, WUI_UPLOAD_RESPONSE_INVALID) == 0);
+    CHECK(conn_begin(&conn, "a/b.gcode", 100) == ERR_ARG);
+    CHECK(strcmp(conn.response, WUI_UPLOAD_RESPONSE_INVALID) == 0);
+    CHECK(conn_begin(&conn, "empty.gcode", 0) == ERR_ARG);
+    CHECK(strcmp(conn.response, WUI_UPLOAD_RESPONSE_INVALID) == 0);
+    CHECK(file_size("empty.gcode") < 0);
+}
+
+// second upload while first one is receiving
+static void test_busy(void) {
+    connection_t first;
+    connection_t second;
+    CHECK(conn_begin(&first, "first.gcode", 50000) == ERR_OK);
+    conn_send(&first);
+    CHECK(conn_begin(&second, "second.gcode", 100) == ERR_INPROGRESS);
+    CHECK(strcmp(second.response, WUI_UPLOAD_RESPONSE_BUSY) == 0);
+    CHECK(strcmp(conn_finish(&first), WUI_UPLOAD_RESPONSE_OK) == 0);
+    CHECK(file_matches("first.gcode", 50000));
+    CHECK(file_size("second.gcode") < 0);
+}
+
+// buffers are not released while the writer is blocked, window stays closed
+static void test_throttle(void) {
+    connection_t conn;
+    int acked;
+    CHECK(conn_begin(&conn, "slow.gcode", 100000) == ERR_OK);
+    conn_send(&conn); // writer does not run, not even open
+    acked = conn.acked;
+    CHECK(acked <= WUI_BUFFERED);
+    conn_send(&conn);
+    CHECK(conn.acked == acked);
+    CHECK((conn.sent - conn.acked) <= TCP_WND);
+    CHECK(strcmp(conn_finish(&conn), WUI_UPLOAD_RESPONSE_OK) == 0);
+    CHECK(file_matches("slow.gcode", 100000));
+}
+
+// USB write error, rest of data is discarded and file is removed
+static void test_write_error(void) {
+    connection_t conn;
+    wui_upload_status_t status;
+    CHECK(conn_begin(&conn, "fail.gcode", 60000) == ERR_OK);
+    conn_send(&conn);
+    writer_run(); // open
+    ramdisk_fail_writes = 1;
+    CHECK(strcmp(conn_finish(&conn), WUI_UPLOAD_RESPONSE_FAILED) == 0);
+    wui_upload_get_status(&status);
+    CHECK(status.state == WUI_UPLOAD_ERROR);
+    CHECK(status.result == FR_DISK_ERR);
+    CHECK(status.received == 60000);
+    CHECK(file_size("fail.gcode") < 0);
+}
+
+// connection closed by client in the middle of upload
+static void test_connection_lost(void) {
+    connection_t conn;
+    wui_upload_status_t status;
+    char response[RESPONSE_LEN];
+    CHECK(conn_begin(&conn, "lost.gcode", 80000) == ERR_OK);
+    conn_send(&conn);
+    writer_run();
+    conn_send(&conn);
+    httpd_post_finished(&conn, response, RESPONSE_LEN);
+    CHECK(strcmp(response, WUI_UPLOAD_RESPONSE_FAILED) == 0);
+    writer_run();
+    wui_upload_get_status(&status);
+    CHECK(status.state == WUI_UPLOAD_ABORTED);
+    CHECK(file_size("lost.gcode") < 0);
+    CHECK(conn_begin(&conn, "next.gcode", 10) == ERR_OK); // not busy any more
+    CHECK(strcmp(conn_finish(&conn), WUI_UPLOAD_RESPONSE_OK) == 0);
+}
+
+int main(void) {
+    static FATFS fs;
+    if (!ramdisk_format(&fs)) {
+        printf("ramdisk format failed\n");
+        return 1;
+    }
+    wui_upload_init();
+    test_upload_ok(1);
+    test_upload_ok(4096);
+    test_upload_ok(100 * 1024 + 7);
+    test_invalid();
+    test_busy();
+    test_throttle();
+    test_write_error();
+    test_connection_lost();
+    CHECK(pbufs == 0);
+    printf("wui_upload_test: %d errors\n", errors);
+    return errors ? 1 : 0;
+}